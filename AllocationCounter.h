@@ -0,0 +1,98 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_ALLOCATIONCOUNTER_H
+#define OPENGL_REVIEW_ALLOCATIONCOUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Counts every global operator new / delete of the program, to check that a frame doesn't touch the heap.
+ *  > #define ALLOCATION_COUNTER_IMPLEMENTATION in exactly one .cpp before including this (like stb_image), that file
+ *    replaces the global operators; the other files only read the counters
+ *  > AllocationCounter::Snapshot taken before a frame, .allocations() after it: what the frame allocated
+ * Only new/delete are counted (malloc from C code isn't), the over-aligned forms go to the library's own versions.
+ */
+class AllocationCounter {
+public:
+    static std::atomic<uint64_t> &allocationCount() {
+        static std::atomic<uint64_t> count{0};
+        return count;
+    }
+    static std::atomic<uint64_t> &byteCount() {
+        static std::atomic<uint64_t> bytes{0};
+        return bytes;
+    }
+    static std::atomic<uint64_t> &freeCount() {
+        static std::atomic<uint64_t> count{0};
+        return count;
+    }
+
+    struct Snapshot {
+        uint64_t allocationsAt = allocationCount().load(std::memory_order_relaxed);
+        uint64_t bytesAt = byteCount().load(std::memory_order_relaxed);
+
+        uint64_t allocations() const {
+            return allocationCount().load(std::memory_order_relaxed) - allocationsAt;
+        }
+        uint64_t bytes() const {
+            return byteCount().load(std::memory_order_relaxed) - bytesAt;
+        }
+    };
+};
+
+#ifdef ALLOCATION_COUNTER_IMPLEMENTATION
+#include <cstdlib>
+#include <new>
+
+static void *countedAllocate(size_t size) {
+    AllocationCounter::allocationCount().fetch_add(1, std::memory_order_relaxed);
+    AllocationCounter::byteCount().fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+static void countedFree(void *pointer) {
+    if (pointer)
+        AllocationCounter::freeCount().fetch_add(1, std::memory_order_relaxed);
+    std::free(pointer);
+}
+
+void *operator new(size_t size) {
+    if (void *pointer = countedAllocate(size))
+        return pointer;
+    throw std::bad_alloc();
+}
+void *operator new[](size_t size) {
+    if (void *pointer = countedAllocate(size))
+        return pointer;
+    throw std::bad_alloc();
+}
+void *operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+void *operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+void operator delete(void *pointer) noexcept {
+    countedFree(pointer);
+}
+void operator delete[](void *pointer) noexcept {
+    countedFree(pointer);
+}
+void operator delete(void *pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+void operator delete[](void *pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+void operator delete(void *pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+void operator delete[](void *pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+#endif
+
+#endif //OPENGL_REVIEW_ALLOCATIONCOUNTER_H
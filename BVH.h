@@ -0,0 +1,291 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_BVH_H
+#define OPENGL_REVIEW_BVH_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#include "Frustum.h"
+#include "Mesh.h"
+#include "OcclusionCuller.h"
+
+/*
+ * Bounding volume hierarchy over world space object boxes, for visibility and picking queries that don't scan every
+ * object.
+ *  > build(): top down, each node split where the binned surface area heuristic says (16 bins over the centroids)
+ *  > nodes are flattened depth first into one array of 32 byte nodes: an inner node's left child comes right after it,
+ *    the right child is at `index`; a leaf's objects are objects[index .. index + count)
+ *  > refit(): moved objects only grow and shrink the boxes (children come after parents, so one backwards pass);
+ *    the tree shape stays, so rebuild once objects have moved far
+ *  > visible(): frustum (subtrees fully inside skip the plane tests) and optionally the Hi-Z buffer of an
+ *    OcclusionCuller, which drops whole subtrees at once
+ *  > pick(): nearest object box hit by a ray, near child first so far subtrees get skipped
+ */
+class BVH {
+public:
+    struct Node {
+        float min[3];
+        uint32_t index; // inner: right child, leaf: first object
+        float max[3];
+        uint32_t count; // 0 for inner nodes
+    };
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> objects; // object ids, in leaf order
+
+    void build(const std::vector<Mesh::Bounds> &bounds) {
+        nodes.clear();
+        objects.resize(bounds.size());
+        for (uint32_t i = 0; i < objects.size(); ++i)
+            objects[i] = i;
+        if (bounds.empty())
+            return;
+        centroids.resize(bounds.size());
+        for (size_t i = 0; i < bounds.size(); ++i)
+            centroids[i] = (bounds[i].min + bounds[i].max) * 0.5f;
+        nodes.reserve(bounds.size() * 2);
+        buildNode(bounds, 0, uint32_t(bounds.size()));
+    }
+
+    void refit(const std::vector<Mesh::Bounds> &bounds) {
+        for (size_t n = nodes.size(); n-- > 0;) {
+            Node &node = nodes[n];
+            Mesh::Bounds box;
+            if (node.count > 0) {
+                box = bounds[objects[node.index]];
+                for (uint32_t i = 0; i < node.count; ++i) {
+                    leafBounds[node.index + i] = bounds[objects[node.index + i]];
+                    box = merge(box, leafBounds[node.index + i]);
+                }
+            } else {
+                box = merge(nodeBounds(nodes[n + 1]), nodeBounds(nodes[node.index]));
+            }
+            setBounds(node, box);
+        }
+    }
+
+    // ids of the objects in the frustum of viewProjection and, given occlusion (rasterized this frame), not behind it;
+    // one query at a time, the traversal stack is kept between calls
+    void visible(const glm::mat4 &viewProjection, std::vector<uint32_t> &out, OcclusionCuller *occlusion = nullptr) {
+        out.clear();
+        if (nodes.empty())
+            return;
+        Frustum frustum = Frustum::fromMatrix(viewProjection);
+        visitStack.assign(1, Entry{0, false});
+        while (!visitStack.empty()) {
+            Entry entry = visitStack.back();
+            visitStack.pop_back();
+            const Node &node = nodes[entry.node];
+            Mesh::Bounds box = nodeBounds(node);
+            bool inside = entry.inside;
+            if (!inside) {
+                Frustum::Result result = frustum.box(box.min, box.max);
+                if (result == Frustum::OUTSIDE)
+                    continue;
+                inside = result == Frustum::INSIDE;
+            }
+            if (occlusion && !occlusion->visible(box, viewProjection))
+                continue;
+            if (node.count > 0) {
+                for (uint32_t i = 0; i < node.count; ++i) {
+                    // leaf boxes hold several objects, test them one by one once the leaf is in
+                    if (node.count > 1) {
+                        const Mesh::Bounds &b = objectBounds(node, i);
+                        if (!inside && frustum.box(b.min, b.max) == Frustum::OUTSIDE)
+                            continue;
+                        if (occlusion && !occlusion->visible(b, viewProjection))
+                            continue;
+                    }
+                    out.push_back(objects[node.index + i]);
+                }
+            } else {
+                visitStack.push_back({node.index, inside});
+                visitStack.push_back({entry.node + 1, inside});
+            }
+        }
+    }
+
+    // nearest object whose box the ray hits (-1 for none); distance in units of direction
+    int pick(const glm::vec3 &origin, const glm::vec3 &direction, float *distance = nullptr,
+             float maxDistance = FLT_MAX) const {
+        if (nodes.empty())
+            return -1;
+        glm::vec3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        int best = -1;
+        float nearest = maxDistance;
+        std::vector<uint32_t> stack(1, 0);
+        while (!stack.empty()) {
+            const Node &node = nodes[stack.back()];
+            stack.pop_back();
+            float t;
+            if (!hit(nodeBounds(node), origin, inverse, nearest, t))
+                continue;
+            if (node.count > 0) {
+                for (uint32_t i = 0; i < node.count; ++i) {
+                    uint32_t object = objects[node.index + i];
+                    if (hit(objectBounds(node, i), origin, inverse, nearest, t)) {
+                        nearest = t;
+                        best = int(object);
+                    }
+                }
+                continue;
+            }
+            // push the far child first so the near one is searched first and shrinks nearest
+            uint32_t left = uint32_t(&node - nodes.data()) + 1, right = node.index;
+            float tLeft = FLT_MAX, tRight = FLT_MAX;
+            bool hitLeft = hit(nodeBounds(nodes[left]), origin, inverse, nearest, tLeft);
+            bool hitRight = hit(nodeBounds(nodes[right]), origin, inverse, nearest, tRight);
+            if (tLeft > tRight) {
+                std::swap(left, right);
+                std::swap(hitLeft, hitRight);
+            }
+            if (hitRight)
+                stack.push_back(right);
+            if (hitLeft)
+                stack.push_back(left);
+        }
+        if (distance && best >= 0)
+            *distance = nearest;
+        return best;
+    }
+
+    // object space box moved by model, as the box around its eight corners
+    static Mesh::Bounds transform(const Mesh::Bounds &bounds, const glm::mat4 &model) {
+        Mesh::Bounds result = {glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX)};
+        for (int i = 0; i < 8; ++i) {
+            glm::vec4 corner = model * glm::vec4(i & 1 ? bounds.max.x : bounds.min.x, i & 2 ? bounds.max.y : bounds.min.y,
+                                                 i & 4 ? bounds.max.z : bounds.min.z, 1.0f);
+            result.min = glm::min(result.min, glm::vec3(corner));
+            result.max = glm::max(result.max, glm::vec3(corner));
+        }
+        return result;
+    }
+
+private:
+    static constexpr int BINS = 16;
+    static constexpr uint32_t MAX_LEAF = 4;
+
+    std::vector<glm::vec3> centroids;
+    struct Entry {
+        uint32_t node;
+        bool inside; // parent was fully inside the frustum
+    };
+    std::vector<Entry> visitStack; // visible()'s
+    // object boxes in leaf order, for the per object tests in leaves; filled by build and refit
+    std::vector<Mesh::Bounds> leafBounds;
+
+    static Mesh::Bounds merge(const Mesh::Bounds &a, const Mesh::Bounds &b) {
+        return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+    }
+    static float area(const Mesh::Bounds &b) {
+        glm::vec3 e = glm::max(b.max - b.min, glm::vec3(0.0f));
+        return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+    }
+    static Mesh::Bounds nodeBounds(const Node &node) {
+        return {glm::vec3(node.min[0], node.min[1], node.min[2]), glm::vec3(node.max[0], node.max[1], node.max[2])};
+    }
+    static void setBounds(Node &node, const Mesh::Bounds &b) {
+        for (int k = 0; k < 3; ++k) {
+            node.min[k] = b.min[k];
+            node.max[k] = b.max[k];
+        }
+    }
+    const Mesh::Bounds &objectBounds(const Node &node, uint32_t i) const {
+        return leafBounds[node.index + i];
+    }
+
+    // slab test; t is the entry distance
+    static bool hit(const Mesh::Bounds &b, const glm::vec3 &origin, const glm::vec3 &inverse, float maxT, float &t) {
+        float tMin = 0.0f, tMax = maxT;
+        for (int k = 0; k < 3; ++k) {
+            float t0 = (b.min[k] - origin[k]) * inverse[k], t1 = (b.max[k] - origin[k]) * inverse[k];
+            if (t0 > t1)
+                std::swap(t0, t1);
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+        }
+        t = tMin;
+        return tMin <= tMax;
+    }
+
+    uint32_t buildNode(const std::vector<Mesh::Bounds> &bounds, uint32_t first, uint32_t count) {
+        uint32_t index = uint32_t(nodes.size());
+        nodes.push_back(Node());
+        Mesh::Bounds box = bounds[objects[first]];
+        Mesh::Bounds centroidBox = {centroids[objects[first]], centroids[objects[first]]};
+        for (uint32_t i = first + 1; i < first + count; ++i) {
+            box = merge(box, bounds[objects[i]]);
+            centroidBox.min = glm::min(centroidBox.min, centroids[objects[i]]);
+            centroidBox.max = glm::max(centroidBox.max, centroids[objects[i]]);
+        }
+        setBounds(nodes[index], box);
+
+        // best binned SAH split over the three axes
+        int bestAxis = -1, bestBin = 0;
+        float bestCost = FLT_MAX;
+        for (int axis = 0; axis < 3 && count > MAX_LEAF; ++axis) {
+            float lo = centroidBox.min[axis], extent = centroidBox.max[axis] - lo;
+            if (extent <= 0.0f)
+                continue;
+            Mesh::Bounds binBounds[BINS];
+            uint32_t binCount[BINS] = {};
+            for (uint32_t i = first; i < first + count; ++i) {
+                int bin = std::min(BINS - 1, int((centroids[objects[i]][axis] - lo) / extent * BINS));
+                binBounds[bin] = binCount[bin]++ ? merge(binBounds[bin], bounds[objects[i]]) : bounds[objects[i]];
+            }
+            // areas and counts left of every split, then sweep from the right
+            float leftArea[BINS - 1];
+            uint32_t leftCount[BINS - 1];
+            Mesh::Bounds running = {};
+            uint32_t n = 0;
+            for (int b = 0; b < BINS - 1; ++b) {
+                if (binCount[b])
+                    running = n ? merge(running, binBounds[b]) : binBounds[b];
+                n += binCount[b];
+                leftCount[b] = n;
+                leftArea[b] = n ? area(running) : 0.0f;
+            }
+            n = 0;
+            for (int b = BINS - 1; b > 0; --b) {
+                if (binCount[b])
+                    running = n ? merge(running, binBounds[b]) : binBounds[b];
+                n += binCount[b];
+                float cost = leftArea[b - 1] * leftCount[b - 1] + (n ? area(running) : 0.0f) * n;
+                if (leftCount[b - 1] > 0 && n > 0 && cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+
+        // a leaf when small, or when no split beats testing every object (traversal counted as one object test)
+        if (bestAxis < 0 || bestCost / area(box) + 1.0f >= float(count)) {
+            nodes[index].index = first;
+            nodes[index].count = count;
+            if (leafBounds.size() < objects.size())
+                leafBounds.resize(objects.size());
+            for (uint32_t i = first; i < first + count; ++i)
+                leafBounds[i] = bounds[objects[i]];
+            return index;
+        }
+        float lo = centroidBox.min[bestAxis], extent = centroidBox.max[bestAxis] - lo;
+        uint32_t *middle = std::partition(&objects[first], &objects[first] + count, [&](uint32_t object) {
+            return std::min(BINS - 1, int((centroids[object][bestAxis] - lo) / extent * BINS)) < bestBin;
+        });
+        uint32_t leftCount = uint32_t(middle - &objects[first]);
+        buildNode(bounds, first, leftCount);
+        uint32_t right = buildNode(bounds, first + leftCount, count - leftCount);
+        nodes[index].index = right;
+        nodes[index].count = 0;
+        return index;
+    }
+};
+
+#endif //OPENGL_REVIEW_BVH_H
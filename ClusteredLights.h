@@ -0,0 +1,295 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_CLUSTEREDLIGHTS_H
+#define OPENGL_REVIEW_CLUSTEREDLIGHTS_H
+
+#include <glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "GLObjects.h"
+#include "Shader.h"
+#include "ThreadPool.h"
+
+/*
+ * Point lights binned into a grid of view space clusters (froxels), for shaders that only look at the lights of the
+ * fragment's own cluster instead of every light in the scene.
+ *  > the grid is CLUSTERS_X x CLUSTERS_Y screen tiles by CLUSTERS_Z depth slices; slices grow exponentially from near
+ *    to far so every cluster is about as deep as it is wide
+ *  > update() on the CPU: every light gets its range of clusters (sphere against the tile planes, depth against the
+ *    slices) in parallel over lights, then the depth slices are filled in parallel, each worker owning whole slices
+ *  > upload() puts three texture buffers on the GPU (GL 3.3 has no SSBOs): the visible lights in view space (2 RGBA32F
+ *    texels each: position + radius, color + intensity), per cluster an offset and count (RG32UI) into a list of light
+ *    indices (R32UI)
+ *  > bind() sets the samplers and the uniforms that map gl_FragCoord and view space depth to a cluster; the grid size
+ *    is compiled into the shader (fragment_shader_clustered.glsl), keep both in step
+ * update() can run on any thread, upload() and bind() need the context. deleteObjects() before glfwTerminate.
+ */
+class ClusteredLights {
+public:
+    static constexpr int CLUSTERS_X = 16;
+    static constexpr int CLUSTERS_Y = 9;
+    static constexpr int CLUSTERS_Z = 24;
+    static constexpr int CLUSTER_COUNT = CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z;
+
+    struct PointLight {
+        glm::vec3 position = glm::vec3(0.0f); // world space
+        float radius = 1.0f; // no light at all past it
+        glm::vec3 color = glm::vec3(1.0f);
+        float intensity = 1.0f;
+    };
+
+    struct Stats {
+        size_t lights = 0, visible = 0;
+        size_t references = 0; // light indices over all clusters
+        size_t maxPerCluster = 0;
+        size_t emptyClusters = 0;
+        double binMicroseconds = 0.0;
+    };
+
+    ClusteredLights() : grid(2 * CLUSTER_COUNT, 0), sliceIndices(CLUSTERS_Z) {}
+    ClusteredLights(const ClusteredLights&) = delete;
+    ClusteredLights &operator=(const ClusteredLights&) = delete;
+
+    // bins the lights for a camera with a glm::perspective(fovY, aspect, near, far) projection
+    void update(const std::vector<PointLight> &lights, const glm::mat4 &view, float fovY, float aspect, float near,
+                float far, ThreadPool &pool = ThreadPool::shared()) {
+        auto start = std::chrono::steady_clock::now();
+        zNear = near;
+        zFar = far;
+        float tanY = std::tan(fovY * 0.5f), tanX = tanY * aspect;
+        // planes through the eye between the tiles: x + a * tanX * z = 0 for the tile edge at NDC x = a
+        glm::vec3 planesX[CLUSTERS_X + 1], planesY[CLUSTERS_Y + 1];
+        for (int i = 0; i <= CLUSTERS_X; ++i)
+            planesX[i] = glm::normalize(glm::vec3(1.0f, 0.0f, (-1.0f + 2.0f * i / CLUSTERS_X) * tanX));
+        for (int i = 0; i <= CLUSTERS_Y; ++i)
+            planesY[i] = glm::normalize(glm::vec3(0.0f, 1.0f, (-1.0f + 2.0f * i / CLUSTERS_Y) * tanY));
+        float sliceScale = CLUSTERS_Z / std::log(far / near);
+
+        // every light's view space sphere and cluster range
+        bounds.resize(lights.size());
+        pool.parallelFor(lights.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t l = begin; l < end; ++l) {
+                const PointLight &light = lights[l];
+                Bounds &bound = bounds[l];
+                glm::vec3 center = glm::vec3(view * glm::vec4(light.position, 1.0f));
+                float radius = light.radius, depth = -center.z;
+                bound.visible = depth + radius > near && depth - radius < far;
+                if (!bound.visible)
+                    continue;
+                bound.center = center;
+                bound.z0 = slice(std::max(depth - radius, near), sliceScale);
+                bound.z1 = slice(std::min(depth + radius, far), sliceScale);
+                // tile i is touched when the sphere reaches right of its left plane and left of its right plane
+                bound.x0 = CLUSTERS_X;
+                bound.x1 = -1;
+                for (int i = 0; i < CLUSTERS_X; ++i) {
+                    if (glm::dot(planesX[i], center) > -radius && glm::dot(planesX[i + 1], center) < radius) {
+                        bound.x0 = std::min(bound.x0, i);
+                        bound.x1 = i;
+                    }
+                }
+                bound.y0 = CLUSTERS_Y;
+                bound.y1 = -1;
+                for (int i = 0; i < CLUSTERS_Y; ++i) {
+                    if (glm::dot(planesY[i], center) > -radius && glm::dot(planesY[i + 1], center) < radius) {
+                        bound.y0 = std::min(bound.y0, i);
+                        bound.y1 = i;
+                    }
+                }
+                bound.visible = bound.x0 <= bound.x1 && bound.y0 <= bound.y1;
+            }
+        }, 64);
+
+        // the visible ones get consecutive indices, that's what the clusters refer to
+        visible.clear();
+        lightData.clear();
+        for (size_t l = 0; l < lights.size(); ++l) {
+            if (!bounds[l].visible)
+                continue;
+            visible.push_back(uint32_t(l));
+            lightData.push_back(glm::vec4(bounds[l].center, lights[l].radius));
+            lightData.push_back(glm::vec4(lights[l].color, lights[l].intensity));
+        }
+
+        // one worker per depth slice: count per cluster, offsets, fill; nothing shared between slices
+        const int perSlice = CLUSTERS_X * CLUSTERS_Y;
+        pool.parallelFor(CLUSTERS_Z, [&](size_t begin, size_t end, unsigned) {
+            for (size_t z = begin; z < end; ++z) {
+                uint32_t *cells = &grid[2 * z * perSlice];
+                std::fill(cells, cells + 2 * perSlice, 0u);
+                for (uint32_t l : visible)
+                    forEachCluster(bounds[l], int(z), [&](int cell) { cells[2 * cell + 1]++; });
+                uint32_t total = 0;
+                for (int cell = 0; cell < perSlice; ++cell) {
+                    cells[2 * cell] = total;
+                    total += cells[2 * cell + 1];
+                    cells[2 * cell + 1] = 0;
+                }
+                std::vector<uint32_t> &indices = sliceIndices[z];
+                indices.resize(total);
+                for (uint32_t v = 0; v < visible.size(); ++v)
+                    forEachCluster(bounds[visible[v]], int(z), [&](int cell) {
+                        indices[cells[2 * cell] + cells[2 * cell + 1]++] = v;
+                    });
+            }
+        });
+
+        // slices one after another in one index list
+        size_t references = 0;
+        uint32_t sliceBase[CLUSTERS_Z];
+        for (int z = 0; z < CLUSTERS_Z; ++z) {
+            sliceBase[z] = uint32_t(references);
+            references += sliceIndices[z].size();
+        }
+        lightIndices.resize(references);
+        pool.parallelFor(CLUSTERS_Z, [&](size_t begin, size_t end, unsigned) {
+            for (size_t z = begin; z < end; ++z) {
+                std::copy(sliceIndices[z].begin(), sliceIndices[z].end(), lightIndices.begin() + sliceBase[z]);
+                for (int cell = 0; cell < perSlice; ++cell)
+                    grid[2 * (z * perSlice + cell)] += sliceBase[z];
+            }
+        });
+
+        counters = Stats();
+        counters.lights = lights.size();
+        counters.visible = visible.size();
+        counters.references = references;
+        for (int cluster = 0; cluster < CLUSTER_COUNT; ++cluster) {
+            counters.maxPerCluster = std::max<size_t>(counters.maxPerCluster, grid[2 * cluster + 1]);
+            counters.emptyClusters += grid[2 * cluster + 1] == 0;
+        }
+        counters.binMicroseconds =
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // this frame's lists to the texture buffers (each buffer is respecified, so the driver can orphan last frame's)
+    void upload() {
+        if (!lightTexture)
+            createTextures();
+        if (lightIndices.size() > size_t(maxTexels)) {
+            std::cout << "ERROR::CLUSTERED_LIGHTS::TOO_MANY_REFERENCES " << lightIndices.size() << " > " << maxTexels
+                      << std::endl;
+            lightIndices.resize(maxTexels);
+            for (int cluster = 0; cluster < CLUSTER_COUNT; ++cluster) {
+                uint32_t offset = std::min<uint32_t>(grid[2 * cluster], maxTexels);
+                grid[2 * cluster + 1] = std::min<uint32_t>(grid[2 * cluster + 1], maxTexels - offset);
+            }
+        }
+        // never empty: a zero sized buffer store isn't a valid texture buffer everywhere
+        if (lightData.empty())
+            lightData.push_back(glm::vec4(0.0f));
+        if (lightIndices.empty())
+            lightIndices.push_back(0);
+        fill(lightBuffer, lightData.size() * sizeof(glm::vec4), lightData.data());
+        fill(gridBuffer, grid.size() * sizeof(uint32_t), grid.data());
+        fill(indexBuffer, lightIndices.size() * sizeof(uint32_t), lightIndices.data());
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    // the three buffers on texture units firstUnit .. firstUnit + 2, and the cluster mapping for a viewport
+    void bind(const Shader &shader, int firstUnit, int viewportWidth, int viewportHeight) const {
+        const unsigned int textures[3] = {lightTexture.id(), gridTexture.id(), indexTexture.id()};
+        for (int i = 0; i < 3; ++i) {
+            glActiveTexture(GL_TEXTURE0 + firstUnit + i);
+            glBindTexture(GL_TEXTURE_BUFFER, textures[i]);
+        }
+        shader.setInt("lights", firstUnit);
+        shader.setInt("clusters", firstUnit + 1);
+        shader.setInt("lightIndices", firstUnit + 2);
+        shader.setVec2("clusterTileSize", glm::vec2(float(viewportWidth) / CLUSTERS_X,
+                                                    float(viewportHeight) / CLUSTERS_Y));
+        // slice = log(depth) * x + y
+        float sliceScale = CLUSTERS_Z / std::log(zFar / zNear);
+        shader.setVec2("clusterDepth", glm::vec2(sliceScale, -std::log(zNear) * sliceScale));
+    }
+
+    Stats stats() const {
+        return counters;
+    }
+
+    void print() const {
+        std::cout << counters.visible << " of " << counters.lights << " lights visible, " << counters.references
+                  << " in clusters (max " << counters.maxPerCluster << ", " << counters.emptyClusters << " of "
+                  << CLUSTER_COUNT << " clusters empty), binned in " << counters.binMicroseconds << " us" << std::endl;
+    }
+
+    void deleteObjects() {
+        lightTexture.reset();
+        gridTexture.reset();
+        indexTexture.reset();
+        lightBuffer.reset();
+        gridBuffer.reset();
+        indexBuffer.reset();
+    }
+
+private:
+    struct Bounds {
+        glm::vec3 center;
+        int x0, x1, y0, y1, z0, z1; // inclusive cluster ranges
+        bool visible;
+    };
+
+    std::vector<Bounds> bounds;
+    std::vector<uint32_t> visible; // light index per visible light
+    std::vector<glm::vec4> lightData;
+    std::vector<uint32_t> grid; // offset, count per cluster
+    std::vector<std::vector<uint32_t>> sliceIndices;
+    std::vector<uint32_t> lightIndices;
+    float zNear = 0.1f, zFar = 100.0f;
+    Stats counters;
+
+    GLBuffer lightBuffer, gridBuffer, indexBuffer;
+    GLBufferTexture lightTexture, gridTexture, indexTexture;
+    GLint maxTexels = 65536; // the least GL 3.3 guarantees for a texture buffer
+
+    // depth in [near, far]
+    int slice(float depth, float sliceScale) const {
+        return std::clamp(int(std::log(depth / zNear) * sliceScale), 0, CLUSTERS_Z - 1);
+    }
+
+    template<class Fn>
+    static void forEachCluster(const Bounds &bound, int z, Fn &&fn) {
+        if (z < bound.z0 || z > bound.z1)
+            return;
+        for (int y = bound.y0; y <= bound.y1; ++y)
+            for (int x = bound.x0; x <= bound.x1; ++x)
+                fn(y * CLUSTERS_X + x);
+    }
+
+    void createTextures() {
+        glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+        lightBuffer = GLBuffer::create();
+        gridBuffer = GLBuffer::create();
+        indexBuffer = GLBuffer::create();
+        lightTexture = GLBufferTexture::create();
+        gridTexture = GLBufferTexture::create();
+        indexTexture = GLBufferTexture::create();
+        attach(lightTexture, GL_RGBA32F, lightBuffer);
+        attach(gridTexture, GL_RG32UI, gridBuffer);
+        attach(indexTexture, GL_R32UI, indexBuffer);
+    }
+
+    static void attach(const GLBufferTexture &texture, GLenum internalFormat, const GLBuffer &buffer) {
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer.id());
+        glBufferData(GL_TEXTURE_BUFFER, 16, nullptr, GL_STREAM_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, texture.id());
+        glTexBuffer(GL_TEXTURE_BUFFER, internalFormat, buffer.id());
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    static void fill(const GLBuffer &buffer, size_t bytes, const void *data) {
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer.id());
+        glBufferData(GL_TEXTURE_BUFFER, GLsizeiptr(bytes), data, GL_STREAM_DRAW);
+    }
+};
+
+#endif //OPENGL_REVIEW_CLUSTEREDLIGHTS_H
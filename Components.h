@@ -0,0 +1,181 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_COMPONENTS_H
+#define OPENGL_REVIEW_COMPONENTS_H
+
+#include <algorithm>
+#include <tuple>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "ECS.h"
+#include "FrameArena.h"
+#include "Shader.h"
+
+/*
+ * Components of the renderable objects in the demos, and the systems that work on them.
+ *  > Transform: position and a rotation about an axis; WorldMatrix is what the transform system makes of it
+ *  > Spin: the object turns about its axis, speed in radians per second (objects without one keep their angle)
+ *  > MeshRenderer: what to draw, a VAO and a glDrawArrays range
+ *  > Material: which program and which textures, texture i bound to unit i
+ * A component is a plain struct so the ECS can move it with memcpy; the program is held by pointer and owned
+ * elsewhere.
+ * Drawing either goes straight over the entities (render) or through a DrawList sorted nearest first
+ * (frontToBack), which can lay down depth alone first (renderDepth) and then shade with GL_EQUAL (renderShaded),
+ * so every pixel runs the material's fragment shader once.
+ */
+struct Transform {
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 axis = glm::vec3(0.0f, 1.0f, 0.0f);
+    float angle = 0.0f; // radians
+};
+
+struct WorldMatrix {
+    glm::mat4 model = glm::mat4(1.0f);
+};
+
+struct Spin {
+    float speed = 0.0f;
+};
+
+struct MeshRenderer {
+    unsigned int vertexArray = 0;
+    int first = 0;
+    int count = 0;
+};
+
+struct Material {
+    static constexpr int MAX_TEXTURES = 2;
+    Shader *shader = nullptr;
+    unsigned int textures[MAX_TEXTURES] = {};
+};
+
+class Systems {
+public:
+    // angle = time * speed, for everything that spins
+    static void animate(EntityWorld &world, float time) {
+        world.parallelEach<Spin, Transform>([time](size_t count, Spin *spin, Transform *transform) {
+            for (size_t i = 0; i < count; ++i)
+                transform[i].angle = time * spin[i].speed;
+        });
+    }
+
+    static void updateTransforms(EntityWorld &world) {
+        world.parallelEach<Transform, WorldMatrix>([](size_t count, Transform *transform, WorldMatrix *matrix) {
+            for (size_t i = 0; i < count; ++i) {
+                glm::mat4 model = glm::translate(glm::mat4(1.0f), transform[i].position);
+                matrix[i].model = glm::rotate(model, transform[i].angle, transform[i].axis);
+            }
+        });
+    }
+
+    // GL, so main thread only; program and texture bindings only change when they differ from the last object's
+    static void render(EntityWorld &world) {
+        BoundState bound;
+        world.each<WorldMatrix, MeshRenderer, Material>(
+                [&](size_t count, WorldMatrix *matrix, MeshRenderer *mesh, Material *material) {
+            for (size_t i = 0; i < count; ++i)
+                bound.draw(matrix[i].model, mesh[i], material[i]);
+        });
+    }
+
+    struct Draw {
+        const glm::mat4 *model;
+        const MeshRenderer *mesh;
+        const Material *material;
+        float depth; // view space distance in front of the camera
+    };
+    // this frame's, points into the entities: no creating/destroying until it's drawn
+    using DrawList = FrameVector<Draw>;
+
+    // everything drawable, nearest first by the depth of its origin
+    static DrawList frontToBack(EntityWorld &world, const glm::mat4 &view) {
+        DrawList draws;
+        draws.reserve(world.size());
+        world.each<WorldMatrix, MeshRenderer, Material>(
+                [&](size_t count, WorldMatrix *matrix, MeshRenderer *mesh, Material *material) {
+            for (size_t i = 0; i < count; ++i)
+                draws.push_back({&matrix[i].model, &mesh[i], &material[i], -(view * matrix[i].model[3]).z});
+        });
+        std::sort(draws.begin(), draws.end(), [](const Draw &a, const Draw &b) { return a.depth < b.depth; });
+        return draws;
+    }
+
+    // depth prepass: color writes off, one trivial program for everything (its vertex shader has to compute
+    // gl_Position exactly like the materials' do, see camera.glsl), only vertex arrays change
+    static void renderDepth(const DrawList &draws, Shader &depthShader) {
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDepthMask(GL_TRUE);
+        glDepthFunc(GL_LESS);
+        depthShader.use();
+        unsigned int boundVertexArray = 0;
+        for (const Draw &draw : draws) {
+            if (draw.mesh->vertexArray != boundVertexArray) {
+                boundVertexArray = draw.mesh->vertexArray;
+                glBindVertexArray(boundVertexArray);
+            }
+            depthShader.setMat4("model", *draw.model);
+            glDrawArrays(GL_TRIANGLES, draw.mesh->first, draw.mesh->count);
+        }
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    }
+
+    // after renderDepth only the nearest fragment passes GL_EQUAL, so the draws go by material (fewest binds)
+    // instead of by depth; without a prepass they stay nearest first and depth test against each other as usual.
+    // program replaces every material's own (textures stay the material's), e.g. to fill a G-buffer
+    static void renderShaded(DrawList &draws, bool afterDepthPrepass, Shader *program = nullptr) {
+        if (afterDepthPrepass) {
+            std::stable_sort(draws.begin(), draws.end(), [](const Draw &a, const Draw &b) {
+                return stateKey(a) < stateKey(b);
+            });
+            glDepthFunc(GL_EQUAL);
+            glDepthMask(GL_FALSE);
+        }
+        BoundState bound;
+        bound.program = program;
+        for (const Draw &draw : draws)
+            bound.draw(*draw.model, *draw.mesh, *draw.material);
+        if (afterDepthPrepass) {
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_TRUE);
+        }
+    }
+
+private:
+    struct BoundState {
+        Shader *shader = nullptr;
+        unsigned int textures[Material::MAX_TEXTURES] = {};
+        unsigned int vertexArray = 0;
+        Shader *program = nullptr; // instead of the materials'
+
+        void draw(const glm::mat4 &model, const MeshRenderer &mesh, const Material &material) {
+            Shader *wanted = program ? program : material.shader;
+            if (wanted != shader) {
+                shader = wanted;
+                shader->use();
+            }
+            for (int t = 0; t < Material::MAX_TEXTURES; ++t) {
+                if (material.textures[t] != textures[t]) {
+                    textures[t] = material.textures[t];
+                    glActiveTexture(GL_TEXTURE0 + t);
+                    glBindTexture(GL_TEXTURE_2D, textures[t]);
+                }
+            }
+            if (mesh.vertexArray != vertexArray) {
+                vertexArray = mesh.vertexArray;
+                glBindVertexArray(vertexArray);
+            }
+            shader->setMat4("model", model);
+            glDrawArrays(GL_TRIANGLES, mesh.first, mesh.count);
+        }
+    };
+
+    static std::tuple<const Shader *, unsigned int, unsigned int, unsigned int> stateKey(const Draw &draw) {
+        return std::make_tuple(draw.material->shader, draw.material->textures[0], draw.material->textures[1],
+                               draw.mesh->vertexArray);
+    }
+};
+
+#endif //OPENGL_REVIEW_COMPONENTS_H
@@ -0,0 +1,401 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_ECS_H
+#define OPENGL_REVIEW_ECS_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "FrameArena.h"
+#include "ThreadPool.h"
+
+/*
+ * Archetype based entity storage: entities with the same set of components live together, in 16 KB chunks that hold
+ * one contiguous array per component (struct of arrays), so a system touching two components streams two arrays.
+ *  > components are plain structs (trivially copyable, moved around with memcpy); at most 64 component types
+ *  > create(a, b, ...) puts an entity in the archetype of exactly those components; add()/remove() move it to another
+ *  > destroy() fills the hole with the archetype's last entity, so chunks stay dense and an Entity (index + generation)
+ *    is the only stable way to refer to one
+ *  > each<A, B>(fn) calls fn(count, A*, B*) once per chunk of every archetype that has A and B;
+ *    parallelEach() hands the chunks to the thread pool (its chunk list is frame scratch: FrameArena::resetAll() once
+ *    a frame)
+ * Adding or removing entities while iterating is not allowed.
+ */
+struct Entity {
+    uint32_t index = 0xFFFFFFFFu;
+    uint32_t generation = 0;
+};
+
+class EntityWorld {
+public:
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+    static constexpr uint32_t MAX_COMPONENTS = 64;
+
+    EntityWorld() = default;
+    EntityWorld(const EntityWorld&) = delete;
+    EntityWorld &operator=(const EntityWorld&) = delete;
+
+    template<class T>
+    static uint32_t componentId() {
+        static_assert(std::is_trivially_copyable<T>::value, "components are moved with memcpy");
+        static const uint32_t id = registerComponent(sizeof(T), alignof(T));
+        return id;
+    }
+    template<class... Ts>
+    static uint64_t mask() {
+        return (uint64_t(0) | ... | (uint64_t(1) << componentId<Ts>()));
+    }
+
+    template<class... Ts>
+    Entity create(const Ts &...components) {
+        Entity entity = allocate();
+        Archetype &archetype = archetypeFor(mask<Ts...>());
+        place(entity, archetype);
+        (set<Ts>(entity, components), ...);
+        return entity;
+    }
+
+    void destroy(Entity entity) {
+        if (!alive(entity))
+            return;
+        Record &record = records[entity.index];
+        erase(*archetypes[record.archetype], record.chunk, record.row);
+        record.generation++;
+        record.archetype = NONE;
+        freeList.push_back(entity.index);
+        living--;
+    }
+
+    bool alive(Entity entity) const {
+        return entity.index < records.size() && records[entity.index].generation == entity.generation &&
+               records[entity.index].archetype != NONE;
+    }
+
+    // nullptr when the entity is gone or doesn't have T
+    template<class T>
+    T *get(Entity entity) {
+        if (!alive(entity))
+            return nullptr;
+        const Record &record = records[entity.index];
+        Archetype &archetype = *archetypes[record.archetype];
+        int column = archetype.columnOf[componentId<T>()];
+        if (column < 0)
+            return nullptr;
+        return reinterpret_cast<T *>(archetype.column(record.chunk, column)) + record.row;
+    }
+
+    template<class T>
+    void add(Entity entity, const T &component) {
+        if (!alive(entity))
+            return;
+        if (!get<T>(entity))
+            move(entity, archetypes[records[entity.index].archetype]->mask | mask<T>());
+        set<T>(entity, component);
+    }
+
+    template<class T>
+    void remove(Entity entity) {
+        if (alive(entity) && get<T>(entity))
+            move(entity, archetypes[records[entity.index].archetype]->mask & ~mask<T>());
+    }
+
+    size_t size() const {
+        return living;
+    }
+    size_t archetypeCount() const {
+        return archetypes.size();
+    }
+
+    template<class... Ts, class Fn>
+    void each(Fn &&fn) {
+        uint64_t wanted = mask<Ts...>();
+        for (const std::unique_ptr<Archetype> &archetype : archetypes) {
+            if ((archetype->mask & wanted) != wanted)
+                continue;
+            for (uint32_t chunk = 0; chunk < archetype->chunks.size(); ++chunk)
+                callChunk<Ts...>(*archetype, chunk, fn);
+        }
+    }
+
+    template<class... Ts, class Fn>
+    void parallelEach(Fn &&fn, ThreadPool &pool = ThreadPool::shared()) {
+        uint64_t wanted = mask<Ts...>();
+        // the chunk list goes with the frame; systems of a batch get here side by side, each on its thread's arena
+        size_t count = 0;
+        for (const std::unique_ptr<Archetype> &archetype : archetypes)
+            if ((archetype->mask & wanted) == wanted)
+                count += archetype->chunks.size();
+        FrameVector<std::pair<Archetype *, uint32_t>> chunks;
+        chunks.reserve(count);
+        for (const std::unique_ptr<Archetype> &archetype : archetypes)
+            if ((archetype->mask & wanted) == wanted)
+                for (uint32_t chunk = 0; chunk < archetype->chunks.size(); ++chunk)
+                    chunks.emplace_back(archetype.get(), chunk);
+        pool.parallelFor(chunks.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i)
+                callChunk<Ts...>(*chunks[i].first, chunks[i].second, fn);
+        });
+    }
+
+private:
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    struct ComponentInfo {
+        uint32_t size, alignment;
+    };
+    static std::vector<ComponentInfo> &components() {
+        static std::vector<ComponentInfo> infos;
+        return infos;
+    }
+    static uint32_t registerComponent(size_t size, size_t alignment) {
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<ComponentInfo> &infos = components();
+        if (infos.size() == MAX_COMPONENTS) {
+            std::cout << "ERROR::ECS::TOO_MANY_COMPONENT_TYPES" << std::endl;
+            std::abort();
+        }
+        infos.push_back({uint32_t(size), uint32_t(alignment)});
+        return uint32_t(infos.size() - 1);
+    }
+
+    struct Chunk {
+        std::unique_ptr<unsigned char[]> data;
+        uint32_t count = 0;
+    };
+    struct Archetype {
+        uint64_t mask = 0;
+        std::vector<uint32_t> ids; // component ids, ascending
+        std::vector<uint32_t> offsets; // of each column inside a chunk; the entity column is at 0
+        std::array<int8_t, MAX_COMPONENTS> columnOf;
+        uint32_t capacity = 0; // entities per chunk
+        std::vector<Chunk> chunks; // all full except the last
+
+        Entity *entities(uint32_t chunk) {
+            return reinterpret_cast<Entity *>(chunks[chunk].data.get());
+        }
+        unsigned char *column(uint32_t chunk, int column) {
+            return chunks[chunk].data.get() + offsets[column];
+        }
+    };
+    struct Record {
+        uint32_t archetype = NONE, chunk = 0, row = 0;
+        uint32_t generation = 0;
+    };
+
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::vector<Record> records;
+    std::vector<uint32_t> freeList;
+    size_t living = 0;
+
+    Entity allocate() {
+        uint32_t index;
+        if (!freeList.empty()) {
+            index = freeList.back();
+            freeList.pop_back();
+        } else {
+            index = uint32_t(records.size());
+            records.emplace_back();
+        }
+        living++;
+        return {index, records[index].generation};
+    }
+
+    Archetype &archetypeFor(uint64_t mask) {
+        for (const std::unique_ptr<Archetype> &archetype : archetypes)
+            if (archetype->mask == mask)
+                return *archetype;
+        auto archetype = std::make_unique<Archetype>();
+        archetype->mask = mask;
+        archetype->columnOf.fill(-1);
+        for (uint32_t id = 0; id < MAX_COMPONENTS; ++id) {
+            if (mask & (uint64_t(1) << id)) {
+                archetype->columnOf[id] = int8_t(archetype->ids.size());
+                archetype->ids.push_back(id);
+            }
+        }
+        // as many entities as fit with every column aligned; new[] memory is aligned for any standard type
+        size_t perEntity = sizeof(Entity);
+        for (uint32_t id : archetype->ids)
+            perEntity += components()[id].size;
+        for (uint32_t capacity = uint32_t(CHUNK_BYTES / perEntity); capacity > 0; --capacity) {
+            std::vector<uint32_t> offsets;
+            size_t end = sizeof(Entity) * capacity;
+            for (uint32_t id : archetype->ids) {
+                const ComponentInfo &info = components()[id];
+                end = (end + info.alignment - 1) / info.alignment * info.alignment;
+                offsets.push_back(uint32_t(end));
+                end += size_t(info.size) * capacity;
+            }
+            if (end <= CHUNK_BYTES) {
+                archetype->capacity = capacity;
+                archetype->offsets = offsets;
+                break;
+            }
+        }
+        if (archetype->capacity == 0) {
+            std::cout << "ERROR::ECS::ENTITY_LARGER_THAN_CHUNK" << std::endl;
+            std::abort();
+        }
+        archetypes.push_back(std::move(archetype));
+        return *archetypes.back();
+    }
+
+    uint32_t archetypeIndex(const Archetype &archetype) const {
+        for (uint32_t i = 0; i < archetypes.size(); ++i)
+            if (archetypes[i].get() == &archetype)
+                return i;
+        return NONE;
+    }
+
+    // appends a row for entity (component values left as they are) and points its record there
+    void place(Entity entity, Archetype &archetype) {
+        if (archetype.chunks.empty() || archetype.chunks.back().count == archetype.capacity) {
+            archetype.chunks.emplace_back();
+            archetype.chunks.back().data.reset(new unsigned char[CHUNK_BYTES]);
+        }
+        uint32_t chunk = uint32_t(archetype.chunks.size() - 1);
+        uint32_t row = archetype.chunks[chunk].count++;
+        archetype.entities(chunk)[row] = entity;
+        Record &record = records[entity.index];
+        record.archetype = archetypeIndex(archetype);
+        record.chunk = chunk;
+        record.row = row;
+    }
+
+    // moves the archetype's last row into the hole
+    void erase(Archetype &archetype, uint32_t chunk, uint32_t row) {
+        uint32_t lastChunk = uint32_t(archetype.chunks.size() - 1);
+        uint32_t lastRow = archetype.chunks[lastChunk].count - 1;
+        if (chunk != lastChunk || row != lastRow) {
+            Entity moved = archetype.entities(lastChunk)[lastRow];
+            archetype.entities(chunk)[row] = moved;
+            for (size_t c = 0; c < archetype.ids.size(); ++c) {
+                uint32_t size = components()[archetype.ids[c]].size;
+                std::memcpy(archetype.column(chunk, int(c)) + size_t(size) * row,
+                            archetype.column(lastChunk, int(c)) + size_t(size) * lastRow, size);
+            }
+            records[moved.index].chunk = chunk;
+            records[moved.index].row = row;
+        }
+        if (--archetype.chunks[lastChunk].count == 0)
+            archetype.chunks.pop_back();
+    }
+
+    // to the archetype of newMask, taking along the components both have
+    void move(Entity entity, uint64_t newMask) {
+        Record old = records[entity.index];
+        Archetype &from = *archetypes[old.archetype];
+        Archetype &to = archetypeFor(newMask); // may grow archetypes, `from` stays put (it's owned by pointer)
+        place(entity, to);
+        const Record &now = records[entity.index];
+        for (size_t c = 0; c < from.ids.size(); ++c) {
+            int column = to.columnOf[from.ids[c]];
+            if (column < 0)
+                continue;
+            uint32_t size = components()[from.ids[c]].size;
+            std::memcpy(to.column(now.chunk, column) + size_t(size) * now.row,
+                        from.column(old.chunk, int(c)) + size_t(size) * old.row, size);
+        }
+        erase(from, old.chunk, old.row);
+    }
+
+    template<class T>
+    void set(Entity entity, const T &component) {
+        *get<T>(entity) = component;
+    }
+
+    template<class... Ts, class Fn>
+    void callChunk(Archetype &archetype, uint32_t chunk, Fn &fn) {
+        fn(size_t(archetype.chunks[chunk].count),
+           reinterpret_cast<Ts *>(archetype.column(chunk, archetype.columnOf[componentId<Ts>()]))...);
+    }
+};
+
+/*
+ * Systems with the components they read and write, run in order but batched: a system joins the batch after the
+ * last earlier system it conflicts with (one writes what the other reads or writes), and the systems of a batch run
+ * side by side on the thread pool. Inside a batch of several systems their own parallelEach() runs serially (the pool
+ * is busy with the batch); a system alone in its batch gets the whole pool.
+ * Systems that touch GL belong on the main thread: give them mainThread = true and they get a batch of their own,
+ * run by the caller.
+ */
+class SystemSchedule {
+public:
+    using Run = std::function<void(EntityWorld&)>;
+
+    SystemSchedule &add(std::string name, uint64_t reads, uint64_t writes, Run run, bool mainThread = false) {
+        systems.push_back({std::move(name), reads, writes, std::move(run), mainThread});
+        batches.clear();
+        return *this;
+    }
+
+    void run(EntityWorld &world, ThreadPool &pool = ThreadPool::shared()) {
+        if (batches.empty())
+            plan();
+        for (const std::vector<size_t> &batch : batches) {
+            if (batch.size() == 1) {
+                systems[batch[0]].run(world);
+                continue;
+            }
+            pool.parallelFor(batch.size(), [&](size_t begin, size_t end, unsigned) {
+                for (size_t i = begin; i < end; ++i)
+                    systems[batch[i]].run(world);
+            });
+        }
+    }
+
+    // system names per batch, for checking what actually runs together
+    void print() {
+        if (batches.empty())
+            plan();
+        for (size_t b = 0; b < batches.size(); ++b) {
+            std::cout << "batch " << b << ":";
+            for (size_t i : batches[b])
+                std::cout << " " << systems[i].name;
+            std::cout << std::endl;
+        }
+    }
+
+private:
+    struct System {
+        std::string name;
+        uint64_t reads, writes;
+        Run run;
+        bool mainThread;
+    };
+    std::vector<System> systems;
+    std::vector<std::vector<size_t>> batches;
+
+    static bool conflict(const System &a, const System &b) {
+        return (a.writes & (b.reads | b.writes)) || (b.writes & a.reads) || a.mainThread || b.mainThread;
+    }
+
+    void plan() {
+        std::vector<size_t> batchOf(systems.size());
+        for (size_t i = 0; i < systems.size(); ++i) {
+            size_t batch = 0;
+            for (size_t j = 0; j < i; ++j)
+                if (conflict(systems[i], systems[j]))
+                    batch = std::max(batch, batchOf[j] + 1);
+            batchOf[i] = batch;
+            if (batches.size() <= batch)
+                batches.resize(batch + 1);
+            batches[batch].push_back(i);
+        }
+    }
+};
+
+#endif //OPENGL_REVIEW_ECS_H
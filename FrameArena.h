@@ -0,0 +1,155 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_FRAMEARENA_H
+#define OPENGL_REVIEW_FRAMEARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Linear allocator for data that only lives until the end of the frame (draw lists, sort keys, uniform names).
+ *  > allocate() bumps a pointer; nothing is freed on its own, reset() at the end of the frame rewinds everything
+ *  > one arena per thread: FrameArena::local(), so workers allocate without locking; FrameArena::resetAll() rewinds
+ *    every thread's arena and must only run while no thread is using one (after the frame's parallel loops)
+ *  > a frame that doesn't fit spills into extra heap blocks; the next reset() replaces them by one block of the
+ *    high water mark, so after the first few frames a steady frame makes no heap allocations at all
+ *  > FrameAllocator / FrameVector put standard containers into the arena (reserve() them, every regrowth leaves the
+ *    old storage behind until reset)
+ * Destructors aren't run: only trivially destructible types go in (FrameVector's elements are destroyed by the
+ * vector as usual, only the storage is the arena's).
+ */
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacity = 256 * 1024) {
+        block.reset(new unsigned char[capacity]);
+        blockSize = capacity;
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(this);
+    }
+    ~FrameArena() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::vector<FrameArena *> &arenas = registry();
+        arenas.erase(std::remove(arenas.begin(), arenas.end(), this), arenas.end());
+    }
+    FrameArena(const FrameArena&) = delete;
+    FrameArena &operator=(const FrameArena&) = delete;
+
+    // this thread's arena
+    static FrameArena &local() {
+        thread_local FrameArena arena;
+        return arena;
+    }
+    static void resetAll() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (FrameArena *arena : registry())
+            arena->reset();
+    }
+
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        size_t offset = (used + alignment - 1) & ~(alignment - 1);
+        if (offset + bytes <= blockSize) {
+            used = offset + bytes;
+            peak = std::max(peak, used + spilledBytes);
+            return block.get() + offset;
+        }
+        // doesn't fit: an extra block just for this, counted so reset() can make room for it next time
+        spilled.emplace_back(new unsigned char[bytes + alignment]);
+        spilledBytes += bytes + alignment;
+        peak = std::max(peak, used + spilledBytes);
+        uintptr_t address = reinterpret_cast<uintptr_t>(spilled.back().get());
+        return reinterpret_cast<void *>((address + alignment - 1) & ~uintptr_t(alignment - 1));
+    }
+
+    // uninitialized storage for count T
+    template<class T>
+    T *allocate(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "the arena never runs destructors");
+        return static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // NUL terminated copy, for names that have to outlive a temporary buffer or be passed to GL
+    const char *copy(std::string_view text) {
+        char *out = allocate<char>(text.size() + 1);
+        std::memcpy(out, text.data(), text.size());
+        out[text.size()] = '\0';
+        return out;
+    }
+
+    void reset() {
+        if (!spilled.empty()) {
+            spilled.clear();
+            spilledBytes = 0;
+            blockSize = peak + peak / 4;
+            block.reset(new unsigned char[blockSize]);
+        }
+        used = 0;
+        peak = 0;
+    }
+
+    size_t bytesUsed() const {
+        return used + spilledBytes;
+    }
+    size_t capacity() const {
+        return blockSize;
+    }
+
+private:
+    std::unique_ptr<unsigned char[]> block;
+    size_t blockSize = 0, used = 0;
+    std::vector<std::unique_ptr<unsigned char[]>> spilled;
+    size_t spilledBytes = 0, peak = 0;
+
+    // never destroyed: pool threads' arenas can outlive any static (they go when ThreadPool::shared() does)
+    static std::vector<FrameArena *> &registry() {
+        static std::vector<FrameArena *> *arenas = new std::vector<FrameArena *>();
+        return *arenas;
+    }
+    static std::mutex &registryMutex() {
+        static std::mutex *mutex = new std::mutex();
+        return *mutex;
+    }
+};
+
+template<class T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    FrameAllocator() : arena(&FrameArena::local()) {}
+    explicit FrameAllocator(FrameArena &arena) : arena(&arena) {}
+    template<class U>
+    FrameAllocator(const FrameAllocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t count) {
+        return static_cast<T *>(arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+    void deallocate(T *, size_t) {}
+
+    template<class U>
+    bool operator==(const FrameAllocator<U> &other) const {
+        return arena == other.arena;
+    }
+    template<class U>
+    bool operator!=(const FrameAllocator<U> &other) const {
+        return arena != other.arena;
+    }
+
+private:
+    template<class U> friend class FrameAllocator;
+    FrameArena *arena;
+};
+
+template<class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+#endif //OPENGL_REVIEW_FRAMEARENA_H
@@ -0,0 +1,99 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_FRAMELOOP_H
+#define OPENGL_REVIEW_FRAMELOOP_H
+
+#include <GLFW/glfw3.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+/*
+ * Fixed time step simulation with a free running (or capped) render rate.
+ * Each frame, advance(time) says how many fixed updates to run; the time left over in the accumulator is returned by
+ * alpha() so rendering can interpolate between the previous and the current simulation state.
+ *  > --tick <hz>   simulation rate (default 60, so per-step speeds match the old per-frame ones at 60 fps)
+ *  > --fps <n>     cap the render rate, 0 = uncapped (default)
+ *  > --no-vsync    don't wait for the display between frames
+ */
+class FrameLoop {
+public:
+    double step = 1.0 / 60.0;
+    double maxFps = 0.0;
+    bool vsync = true;
+    // replays turn this off so frames run back to back
+    bool throttle = true;
+    // more updates than this in one frame means we can't keep up: drop the time instead of spiralling
+    int maxSteps = 8;
+
+    FrameLoop(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--tick" && i + 1 < argc) {
+                // atof gives 0 for garbage; a rate has to be positive and finite to make a usable step
+                double hz = std::atof(argv[++i]);
+                if (hz > 0.0 && std::isfinite(hz))
+                    step = 1.0 / hz;
+                else
+                    std::cout << "ERROR::FRAME_LOOP::INVALID_TICK " << argv[i] << std::endl;
+            } else if (arg == "--fps" && i + 1 < argc) {
+                double fps = std::atof(argv[++i]);
+                if (fps >= 0.0 && std::isfinite(fps))
+                    maxFps = fps;
+                else
+                    std::cout << "ERROR::FRAME_LOOP::INVALID_FPS " << argv[i] << std::endl;
+            }
+            else if (arg == "--no-vsync")
+                vsync = false;
+        }
+    }
+
+    // call once the context is current
+    void contextCreated() const {
+        glfwSwapInterval(vsync && throttle ? 1 : 0);
+    }
+
+    // number of fixed updates to run this frame
+    int advance(double now) {
+        frameStart = std::chrono::steady_clock::now();
+        if (previousTime < 0.0)
+            previousTime = now;
+        accumulator += now - previousTime;
+        previousTime = now;
+
+        int steps = 0;
+        while (accumulator >= step && steps < maxSteps) {
+            accumulator -= step;
+            steps++;
+        }
+        // still a whole step behind after maxSteps: drop the backlog, keep the fraction for alpha()
+        if (accumulator >= step)
+            accumulator = std::fmod(accumulator, step);
+        return steps;
+    }
+
+    // how far (0..1) rendering is between the previous and the current update
+    float alpha() const {
+        return float(accumulator / step);
+    }
+
+    // call after swapping buffers: sleeps off what's left of the frame when the render rate is capped
+    void endFrame() const {
+        if (!throttle || maxFps <= 0.0)
+            return;
+        std::this_thread::sleep_until(frameStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(1.0 / maxFps)));
+    }
+
+private:
+    double accumulator = 0.0;
+    double previousTime = -1.0;
+    std::chrono::steady_clock::time_point frameStart;
+};
+
+#endif //OPENGL_REVIEW_FRAMELOOP_H
@@ -0,0 +1,259 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_FRAMERECORDER_H
+#define OPENGL_REVIEW_FRAMERECORDER_H
+
+#include <glad.h>
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Records what a render loop reads from the outside world (time + tracked keys) so a run can be replayed exactly.
+ *  > --capture <log>   run normally, write one 6 byte record per frame (float time step + 16 bit key mask)
+ *  > --replay <log>    hidden window, no vsync, time and keys come from the log, loop ends with the log
+ *      --timings <csv>   write the measured frame times (ms, one per line)
+ *      --baseline <csv>  compare against timings written by another build and print the deltas
+ * The loop asks the recorder instead of GLFW: time() for glfwGetTime(), key() for glfwGetKey() == GLFW_PRESS.
+ */
+class FrameRecorder {
+public:
+    enum Mode { OFF, CAPTURE, REPLAY };
+    Mode mode = OFF;
+
+    // up to 16 keys are tracked; logs name them by key code, so a replay works after keys are added to the list
+    FrameRecorder(int argc, char** argv, std::initializer_list<int> trackedKeys) : keys(trackedKeys) {
+        if (keys.size() > 16) {
+            std::cout << "ERROR::RECORDER::TOO_MANY_KEYS" << std::endl;
+            keys.resize(16);
+        }
+        for (int i = 1; i + 1 < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--capture") {
+                mode = CAPTURE;
+                logPath = argv[++i];
+            } else if (arg == "--replay") {
+                mode = REPLAY;
+                logPath = argv[++i];
+            } else if (arg == "--timings") {
+                timingsPath = argv[++i];
+            } else if (arg == "--baseline") {
+                baselinePath = argv[++i];
+            }
+        }
+        if (mode == REPLAY && !readLog())
+            mode = OFF;
+    }
+    ~FrameRecorder() {
+        if (mode == CAPTURE)
+            writeLog();
+        else if (mode == REPLAY)
+            report();
+    }
+
+    // call before glfwCreateWindow: replays run in a hidden window
+    void windowHints() const {
+        if (mode == REPLAY)
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
+    // call after the context is current: replays must not be throttled by vsync
+    void contextCreated() const {
+        if (mode == REPLAY)
+            glfwSwapInterval(0);
+    }
+
+    // true once a replay has run out of frames
+    bool finished() const {
+        return mode == REPLAY && frame >= records.size();
+    }
+
+    // sample (or replay) time and keys for this frame
+    void beginFrame(GLFWwindow *window) {
+        frameStart = std::chrono::steady_clock::now();
+        if (mode == REPLAY) {
+            if (frame < records.size()) {
+                currentTime += records[frame].dt;
+                keyMask = records[frame].keys;
+            }
+            return;
+        }
+        // time steps are stored as float, accumulate the same rounded values the replay will see
+        float dt = float(glfwGetTime() - currentTime);
+        currentTime += dt;
+        keyMask = 0;
+        for (size_t i = 0; i < keys.size(); ++i)
+            if (glfwGetKey(window, keys[i]) == GLFW_PRESS)
+                keyMask |= uint16_t(1u << i);
+        if (mode == CAPTURE)
+            records.push_back({dt, keyMask});
+    }
+    // call after the frame's last GL call, before swapping
+    void endFrame() {
+        if (mode == REPLAY) {
+            // wait for the GPU so the frame time covers all of the frame's work
+            glFinish();
+            frameTimes.push_back(std::chrono::duration<float, std::milli>(
+                    std::chrono::steady_clock::now() - frameStart).count());
+        }
+        frame++;
+    }
+
+    double time() const {
+        return currentTime;
+    }
+    bool key(GLFWwindow *window, int key) const {
+        for (size_t i = 0; i < keys.size(); ++i)
+            if (keys[i] == key)
+                return (keyMask >> i) & 1u;
+        // keys nobody asked to track can't be replayed
+        return mode != REPLAY && glfwGetKey(window, key) == GLFW_PRESS;
+    }
+
+private:
+    struct Record {
+        float dt;
+        uint16_t keys;
+    };
+    static constexpr char MAGIC[4] = {'F', 'R', 'E', 'C'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t RECORD_BYTES = sizeof(float) + sizeof(uint16_t); // on disk, unpadded
+
+    std::vector<int> keys;
+    std::vector<Record> records;
+    std::vector<float> frameTimes;
+    std::string logPath, timingsPath, baselinePath;
+    size_t frame = 0;
+    double currentTime = 0.0;
+    uint16_t keyMask = 0;
+    std::chrono::steady_clock::time_point frameStart;
+
+    void writeLog() {
+        std::ofstream file(logPath, std::ios::binary);
+        if (!file) {
+            std::cout << "ERROR::RECORDER::CANNOT_WRITE " << logPath << std::endl;
+            return;
+        }
+        uint32_t header[3] = {VERSION, uint32_t(keys.size()), uint32_t(records.size())};
+        file.write(MAGIC, sizeof(MAGIC));
+        file.write((const char*)header, sizeof(header));
+        for (int key : keys) {
+            int32_t k = key;
+            file.write((const char*)&k, sizeof(k));
+        }
+        // field by field: sizeof(Record) is padded to 8
+        for (const Record &r : records) {
+            file.write((const char*)&r.dt, sizeof(r.dt));
+            file.write((const char*)&r.keys, sizeof(r.keys));
+        }
+        std::cout << "Captured " << records.size() << " frames to " << logPath << std::endl;
+    }
+
+    bool readLog() {
+        std::ifstream file(logPath, std::ios::binary);
+        char magic[4];
+        uint32_t header[3];
+        if (!file.read(magic, sizeof(magic)) || memcmp(magic, MAGIC, sizeof(magic)) != 0 ||
+            !file.read((char*)header, sizeof(header)) || header[0] != VERSION) {
+            std::cout << "ERROR::RECORDER::INVALID_LOG " << logPath << std::endl;
+            return false;
+        }
+        // the counts come from the file: check them against what's left of it before allocating anything
+        std::streamoff start = file.tellg();
+        file.seekg(0, std::ios::end);
+        uint64_t remaining = uint64_t(file.tellg() - start);
+        file.seekg(start);
+        if (header[1] > 16 || remaining < uint64_t(header[1]) * 4 ||
+            (remaining - uint64_t(header[1]) * 4) / RECORD_BYTES < header[2]) {
+            std::cout << "ERROR::RECORDER::TRUNCATED_LOG " << logPath << std::endl;
+            return false;
+        }
+        // bit i of a logged mask is the i-th logged key; move it to where that key is tracked now, so logs stay
+        // valid when a demo tracks more keys (keys it doesn't track any more are dropped)
+        uint16_t remap[16] = {};
+        for (uint32_t i = 0; i < header[1]; ++i) {
+            int32_t k;
+            file.read((char*)&k, sizeof(k));
+            auto tracked = std::find(keys.begin(), keys.end(), int(k));
+            if (tracked != keys.end())
+                remap[i] = uint16_t(1u << (tracked - keys.begin()));
+        }
+        records.resize(header[2]);
+        for (Record &r : records) {
+            uint16_t logged;
+            file.read((char*)&r.dt, sizeof(r.dt));
+            file.read((char*)&logged, sizeof(logged));
+            r.keys = 0;
+            for (uint32_t i = 0; i < header[1]; ++i)
+                if (logged & (1u << i))
+                    r.keys |= remap[i];
+        }
+        if (!file) {
+            std::cout << "ERROR::RECORDER::TRUNCATED_LOG " << logPath << std::endl;
+            return false;
+        }
+        frameTimes.reserve(records.size());
+        return true;
+    }
+
+    static float percentile(std::vector<float> values, float p) {
+        if (values.empty())
+            return 0.0f;
+        size_t n = std::min(values.size() - 1, size_t(p * values.size()));
+        std::nth_element(values.begin(), values.begin() + n, values.end());
+        return values[n];
+    }
+
+    void report() const {
+        float total = 0.0f;
+        for (float t : frameTimes)
+            total += t;
+        float mean = frameTimes.empty() ? 0.0f : total / frameTimes.size();
+        std::cout << "Replayed " << frameTimes.size() << " frames: mean " << mean << " ms, p50 "
+                  << percentile(frameTimes, 0.5f) << " ms, p95 " << percentile(frameTimes, 0.95f) << " ms" << std::endl;
+
+        if (!timingsPath.empty()) {
+            std::ofstream timings(timingsPath);
+            for (float t : frameTimes)
+                timings << t << "\n";
+        }
+        if (baselinePath.empty())
+            return;
+
+        std::ifstream baselineFile(baselinePath);
+        std::vector<float> baseline;
+        float t;
+        while (baselineFile >> t)
+            baseline.push_back(t);
+        size_t n = std::min(baseline.size(), frameTimes.size());
+        if (n == 0) {
+            std::cout << "ERROR::RECORDER::EMPTY_BASELINE " << baselinePath << std::endl;
+            return;
+        }
+        // same frames, same work: compare frame by frame
+        std::vector<float> deltas(n);
+        float baselineTotal = 0.0f, currentTotal = 0.0f;
+        int slower = 0;
+        for (size_t i = 0; i < n; ++i) {
+            deltas[i] = frameTimes[i] - baseline[i];
+            baselineTotal += baseline[i];
+            currentTotal += frameTimes[i];
+            if (frameTimes[i] > baseline[i] * 1.1f)
+                slower++;
+        }
+        std::cout << "vs baseline (" << n << " frames): total " << currentTotal - baselineTotal << " ms ("
+                  << 100.0f * (currentTotal - baselineTotal) / baselineTotal << "%), delta p50 "
+                  << percentile(deltas, 0.5f) << " ms, p95 " << percentile(deltas, 0.95f) << " ms, "
+                  << slower << " frames >10% slower" << std::endl;
+    }
+};
+
+#endif //OPENGL_REVIEW_FRAMERECORDER_H
@@ -0,0 +1,56 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_FRUSTUM_H
+#define OPENGL_REVIEW_FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+/*
+ * The six planes of a projection * view (* model) matrix (Gribb & Hartmann: row 3 +- row i), normalized, pointing in.
+ * Planes of a matrix that includes the model are in object space, so bounds can be tested without moving them.
+ */
+struct Frustum {
+    glm::vec4 planes[6];
+
+    enum Result { OUTSIDE, INTERSECTS, INSIDE };
+
+    static Frustum fromMatrix(const glm::mat4 &m) {
+        Frustum frustum;
+        glm::vec4 w(m[0][3], m[1][3], m[2][3], m[3][3]);
+        for (int i = 0; i < 3; ++i) {
+            glm::vec4 row(m[0][i], m[1][i], m[2][i], m[3][i]);
+            frustum.planes[i * 2] = w + row;
+            frustum.planes[i * 2 + 1] = w - row;
+        }
+        for (glm::vec4 &plane : frustum.planes)
+            plane = plane / glm::length(glm::vec3(plane));
+        return frustum;
+    }
+
+    bool sphereOutside(const glm::vec3 &center, float radius) const {
+        for (const glm::vec4 &plane : planes)
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+                return true;
+        return false;
+    }
+
+    // corners nearest and farthest along each plane's normal decide
+    Result box(const glm::vec3 &min, const glm::vec3 &max) const {
+        Result result = INSIDE;
+        for (const glm::vec4 &plane : planes) {
+            glm::vec3 far(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y,
+                          plane.z >= 0.0f ? max.z : min.z);
+            glm::vec3 near(plane.x >= 0.0f ? min.x : max.x, plane.y >= 0.0f ? min.y : max.y,
+                           plane.z >= 0.0f ? min.z : max.z);
+            if (glm::dot(glm::vec3(plane), far) + plane.w < 0.0f)
+                return OUTSIDE;
+            if (glm::dot(glm::vec3(plane), near) + plane.w < 0.0f)
+                result = INTERSECTS;
+        }
+        return result;
+    }
+};
+
+#endif //OPENGL_REVIEW_FRUSTUM_H
@@ -0,0 +1,99 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_GBUFFER_H
+#define OPENGL_REVIEW_GBUFFER_H
+
+#include <glad.h>
+#include <iostream>
+#include <glm/glm.hpp>
+
+#include "RenderGraph.h"
+#include "Shader.h"
+
+/*
+ * G-buffer for deferred shading, as RenderGraph transients, kept as small as the lighting allows.
+ *  > albedo RGBA8; normal octahedral encoded in two channels (octahedral.glsl); no position at all, the lighting pass
+ *    rebuilds the view space position from the depth buffer and the inverse projection
+ *  > Layout picks the precision: COMPACT (RG8 normal, 24 bit depth) or PRECISE (RG16F normal, 32 bit float depth)
+ *  > create() in the geometry pass's setup (albedo at location 0, normal at 1, depth), read() in the lighting pass's,
+ *    bind() in its execute: samplers gAlbedo / gNormal / gDepth and inverseProjection
+ * printReport() lists the bytes per pixel of every layout next to a G-buffer that stores position and normal as
+ * RGBA16F, the usual starting point.
+ */
+class GBuffer {
+public:
+    enum Layout { COMPACT, PRECISE, LAYOUT_COUNT };
+
+    struct Format {
+        const char *name;
+        GLenum albedo, normal, depth;
+    };
+
+    struct Targets {
+        RenderGraph::Resource albedo = RenderGraph::NONE, normal = RenderGraph::NONE, depth = RenderGraph::NONE;
+    };
+
+    static const Format &format(Layout layout) {
+        static const Format formats[LAYOUT_COUNT] = {
+                {"compact", GL_RGBA8, GL_RG8, GL_DEPTH_COMPONENT24},
+                {"precise", GL_RGBA8, GL_RG16F, GL_DEPTH_COMPONENT32F},
+        };
+        return formats[layout];
+    }
+
+    static Targets create(RenderGraph::Builder &builder, int width, int height, Layout layout) {
+        const Format &targetFormat = format(layout);
+        Targets targets;
+        targets.albedo = builder.create("gAlbedo", {width, height, targetFormat.albedo});
+        targets.normal = builder.create("gNormal", {width, height, targetFormat.normal});
+        targets.depth = builder.create("gDepth", {width, height, targetFormat.depth});
+        builder.write(targets.albedo);
+        builder.write(targets.normal);
+        builder.writeDepth(targets.depth);
+        return targets;
+    }
+
+    static void read(RenderGraph::Builder &builder, const Targets &targets) {
+        builder.read(targets.albedo);
+        builder.read(targets.normal);
+        builder.read(targets.depth);
+    }
+
+    // the targets on texture units firstUnit .. firstUnit + 2
+    static void bind(const RenderGraph &graph, const Targets &targets, const Shader &shader, int firstUnit,
+                     const glm::mat4 &projection) {
+        const RenderGraph::Resource resources[3] = {targets.albedo, targets.normal, targets.depth};
+        const char *samplers[3] = {"gAlbedo", "gNormal", "gDepth"};
+        for (int i = 0; i < 3; ++i) {
+            glActiveTexture(GL_TEXTURE0 + firstUnit + i);
+            glBindTexture(GL_TEXTURE_2D, graph.texture(resources[i]));
+            shader.setInt(samplers[i], firstUnit + i);
+        }
+        shader.setMat4("inverseProjection", glm::inverse(projection));
+    }
+
+    static size_t bytesPerPixel(Layout layout) {
+        const Format &targetFormat = format(layout);
+        return RenderGraph::bytesPerPixel(targetFormat.albedo) + RenderGraph::bytesPerPixel(targetFormat.normal) +
+               RenderGraph::bytesPerPixel(targetFormat.depth);
+    }
+
+    // bytes per pixel and per frame at this size, written once by the geometry pass and read once by the lighting
+    static void printReport(int width, int height) {
+        size_t pixels = size_t(width) * height;
+        size_t reference = RenderGraph::bytesPerPixel(GL_RGBA16F) * 2 + RenderGraph::bytesPerPixel(GL_RGBA8) +
+                           RenderGraph::bytesPerPixel(GL_DEPTH_COMPONENT24);
+        std::cout << "G-buffer at " << width << "x" << height << ":" << std::endl;
+        for (int layout = 0; layout < LAYOUT_COUNT; ++layout) {
+            size_t bytes = bytesPerPixel(Layout(layout));
+            std::cout << "  " << format(Layout(layout)).name << ": " << bytes << " bytes per pixel, "
+                      << pixels * bytes / 1024 << " KB" << std::endl;
+        }
+        std::cout << "  position + normal RGBA16F: " << reference << " bytes per pixel, " << pixels * reference / 1024
+                  << " KB" << std::endl;
+    }
+};
+
+#endif //OPENGL_REVIEW_GBUFFER_H
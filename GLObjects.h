@@ -0,0 +1,252 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_GLOBJECTS_H
+#define OPENGL_REVIEW_GLOBJECTS_H
+
+#include <glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+/*
+ * Buffers, textures and vertex arrays from a pool, for code that creates and drops them all the time.
+ *  > create() hands out a Handle (slot + generation) for a GL name; release() bumps the slot's generation, so a
+ *    stale handle reads as name 0 instead of as whatever object got the slot next
+ *  > released names aren't deleted: they wait for a fence placed at the end of the frame they were released in, and
+ *    once the GPU is past it they go back on a free list for the next create() (no glGen/glDelete on the way)
+ *  > a recycled name keeps its old contents/state: respecify buffers (glBufferData) and textures (glTexImage*),
+ *    set the attributes of a vertex array again (VertexLayout::createVertexArray does, and disables the rest)
+ *  > textures get a free list per target (TEXTURE for GL_TEXTURE_2D, TEXTURE_BUFFER): the first bind fixes a
+ *    texture name's target, a recycled name bound to another one is GL_INVALID_OPERATION
+ *  > more than KEEP free names of a type are deleted instead of kept, also only after their fence
+ * endFrame() once per frame places the fence and collects finished ones (never waits). shutdown() before
+ * glfwTerminate deletes everything; releases after that only free the slot.
+ * GLBuffer / GLTexture / GLBufferTexture / GLVertexArray own one handle each and release it when they go.
+ */
+class GLObjectPool {
+public:
+    enum Type { BUFFER, TEXTURE, TEXTURE_BUFFER, VERTEX_ARRAY, TYPE_COUNT };
+    static constexpr size_t KEEP = 256;
+
+    struct Handle {
+        uint32_t slot = 0xFFFFFFFFu;
+        uint32_t generation = 0;
+    };
+    struct Stats {
+        size_t live = 0, pending = 0, free = 0;
+        size_t generated = 0, recycled = 0, deleted = 0;
+    };
+
+    GLObjectPool() = default;
+    GLObjectPool(const GLObjectPool&) = delete;
+    GLObjectPool &operator=(const GLObjectPool&) = delete;
+
+    // one pool for the context the demos render with
+    static GLObjectPool &shared() {
+        static GLObjectPool pool;
+        return pool;
+    }
+
+    Handle create(Type type) {
+        unsigned int name = 0;
+        if (!freeNames[type].empty()) {
+            name = freeNames[type].back();
+            freeNames[type].pop_back();
+            counters.recycled++;
+        } else {
+            generate(type, name);
+            counters.generated++;
+        }
+        uint32_t slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = uint32_t(slots.size());
+            slots.emplace_back();
+        }
+        slots[slot].name = name;
+        slots[slot].type = type;
+        slots[slot].live = true;
+        counters.live++;
+        return {slot, slots[slot].generation};
+    }
+
+    // 0 for released (stale) handles
+    unsigned int name(Handle handle) const {
+        return valid(handle) ? slots[handle.slot].name : 0;
+    }
+    bool valid(Handle handle) const {
+        return handle.slot < slots.size() && slots[handle.slot].live && slots[handle.slot].generation == handle.generation;
+    }
+
+    void release(Handle handle) {
+        if (!valid(handle))
+            return;
+        Slot &slot = slots[handle.slot];
+        if (!stopped)
+            releasing.push_back({slot.type, slot.name});
+        slot.live = false;
+        slot.generation++;
+        freeSlots.push_back(handle.slot);
+        counters.live--;
+    }
+
+    void endFrame() {
+        if (stopped)
+            return;
+        if (!releasing.empty()) {
+            inFlight.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::move(releasing)});
+            releasing.clear();
+        }
+        while (!inFlight.empty()) {
+            GLenum status = glClientWaitSync(inFlight.front().fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break;
+            glDeleteSync(inFlight.front().fence);
+            for (const Released &released : inFlight.front().names)
+                recycle(released);
+            inFlight.pop_front();
+        }
+    }
+
+    void shutdown() {
+        for (Batch &batch : inFlight) {
+            glDeleteSync(batch.fence);
+            releasing.insert(releasing.end(), batch.names.begin(), batch.names.end());
+        }
+        inFlight.clear();
+        for (Slot &slot : slots)
+            if (slot.live)
+                releasing.push_back({slot.type, slot.name});
+        for (int type = 0; type < TYPE_COUNT; ++type)
+            for (unsigned int name : freeNames[type])
+                releasing.push_back({Type(type), name});
+        for (const Released &released : releasing)
+            destroy(released.type, released.name);
+        counters.deleted += releasing.size();
+        releasing.clear();
+        for (std::vector<unsigned int> &names : freeNames)
+            names.clear();
+        stopped = true;
+    }
+
+    Stats stats() const {
+        Stats stats = counters;
+        stats.pending = releasing.size();
+        for (const Batch &batch : inFlight)
+            stats.pending += batch.names.size();
+        for (const std::vector<unsigned int> &names : freeNames)
+            stats.free += names.size();
+        return stats;
+    }
+
+private:
+    struct Slot {
+        unsigned int name = 0;
+        uint32_t generation = 0;
+        Type type = BUFFER;
+        bool live = false;
+    };
+    struct Released {
+        Type type;
+        unsigned int name;
+    };
+    struct Batch {
+        GLsync fence;
+        std::vector<Released> names;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::vector<unsigned int> freeNames[TYPE_COUNT];
+    std::vector<Released> releasing; // this frame's, no fence yet
+    std::deque<Batch> inFlight; // oldest first
+    Stats counters;
+    bool stopped = false;
+
+    static void generate(Type type, unsigned int &name) {
+        switch (type) {
+            case BUFFER: glGenBuffers(1, &name); break;
+            case TEXTURE: case TEXTURE_BUFFER: glGenTextures(1, &name); break;
+            case VERTEX_ARRAY: glGenVertexArrays(1, &name); break;
+            default: break;
+        }
+    }
+    static void destroy(Type type, unsigned int name) {
+        switch (type) {
+            case BUFFER: glDeleteBuffers(1, &name); break;
+            case TEXTURE: case TEXTURE_BUFFER: glDeleteTextures(1, &name); break;
+            case VERTEX_ARRAY: glDeleteVertexArrays(1, &name); break;
+            default: break;
+        }
+    }
+
+    void recycle(const Released &released) {
+        if (freeNames[released.type].size() < KEEP) {
+            freeNames[released.type].push_back(released.name);
+        } else {
+            destroy(released.type, released.name);
+            counters.deleted++;
+        }
+    }
+};
+
+template<GLObjectPool::Type TYPE>
+class GLObject {
+public:
+    GLObject() = default;
+    ~GLObject() {
+        reset();
+    }
+    GLObject(GLObject &&other) noexcept : pool(other.pool), handle(other.handle) {
+        other.pool = nullptr;
+    }
+    GLObject &operator=(GLObject &&other) noexcept {
+        if (this != &other) {
+            reset();
+            pool = other.pool;
+            handle = other.handle;
+            other.pool = nullptr;
+        }
+        return *this;
+    }
+    GLObject(const GLObject&) = delete;
+    GLObject &operator=(const GLObject&) = delete;
+
+    static GLObject create(GLObjectPool &pool = GLObjectPool::shared()) {
+        GLObject object;
+        object.pool = &pool;
+        object.handle = pool.create(TYPE);
+        return object;
+    }
+
+    // the GL name, 0 when empty
+    unsigned int id() const {
+        return pool ? pool->name(handle) : 0;
+    }
+    explicit operator bool() const {
+        return id() != 0;
+    }
+
+    void reset() {
+        if (pool)
+            pool->release(handle);
+        pool = nullptr;
+    }
+
+private:
+    GLObjectPool *pool = nullptr;
+    GLObjectPool::Handle handle;
+};
+
+using GLBuffer = GLObject<GLObjectPool::BUFFER>;
+using GLTexture = GLObject<GLObjectPool::TEXTURE>;
+using GLBufferTexture = GLObject<GLObjectPool::TEXTURE_BUFFER>;
+using GLVertexArray = GLObject<GLObjectPool::VERTEX_ARRAY>;
+
+#endif //OPENGL_REVIEW_GLOBJECTS_H
@@ -0,0 +1,103 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESH_H
+#define OPENGL_REVIEW_MESH_H
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Triangle mesh on the CPU, what the mesh tools (packing, files, importers, simplification, meshlets) pass around.
+ * normals and uvs are either empty or one per position. Without indices the positions are triangles in order.
+ */
+struct Mesh {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> uvs;
+    std::vector<unsigned int> indices;
+
+    struct Bounds {
+        glm::vec3 min, max;
+    };
+
+    // interleaved float arrays like the ones typed into the demos, offsets in floats (-1 = not there)
+    static Mesh fromInterleaved(const float *data, size_t vertexCount, int stride, int positionOffset, int uvOffset,
+                                int normalOffset = -1) {
+        Mesh mesh;
+        for (size_t i = 0; i < vertexCount; ++i) {
+            const float *v = data + i * stride;
+            mesh.positions.push_back(glm::vec3(v[positionOffset], v[positionOffset + 1], v[positionOffset + 2]));
+            if (uvOffset >= 0)
+                mesh.uvs.push_back(glm::vec2(v[uvOffset], v[uvOffset + 1]));
+            if (normalOffset >= 0)
+                mesh.normals.push_back(glm::vec3(v[normalOffset], v[normalOffset + 1], v[normalOffset + 2]));
+        }
+        return mesh;
+    }
+
+    size_t vertexCount() const {
+        return positions.size();
+    }
+    size_t triangleCount() const {
+        return (indices.empty() ? positions.size() : indices.size()) / 3;
+    }
+    // index of the corner'th vertex of the triangle list, indexed or not
+    unsigned int index(size_t corner) const {
+        return indices.empty() ? (unsigned int)corner : indices[corner];
+    }
+
+    Bounds bounds() const {
+        if (positions.empty())
+            return {glm::vec3(0.0f), glm::vec3(0.0f)};
+        Bounds b = {positions[0], positions[0]};
+        for (const glm::vec3 &p : positions) {
+            b.min = glm::min(b.min, p);
+            b.max = glm::max(b.max, p);
+        }
+        return b;
+    }
+};
+
+/*
+ * Mesh split into small clusters that can be culled one by one, stored with the mesh in MeshFile.
+ * Each meshlet has its own small vertex list (indices into the mesh's vertices) and triangles made of byte indices into
+ * that list. The bounding sphere and normal cone are in object space; a cone cutoff above 1 means "never backfacing".
+ */
+struct Meshlet {
+    uint32_t vertexOffset;   // first entry in MeshletData::vertices
+    uint32_t triangleOffset; // first byte in MeshletData::triangles (3 per triangle)
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    float center[3];
+    float radius;
+    float coneAxis[3];
+    float coneCutoff;
+};
+
+struct MeshletData {
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> vertices;
+    std::vector<uint8_t> triangles;
+};
+
+/*
+ * One level of detail: a range of the mesh's index buffer, drawn with the same vertices as every other level.
+ * error is how far (object space) the level's surface may be from the full mesh, 0 for the full mesh.
+ */
+struct MeshLod {
+    uint32_t indexOffset;
+    uint32_t indexCount;
+    float error;
+};
+
+// all levels' indices back to back, finest first (MeshSimplifier::lodChain)
+struct LodChain {
+    std::vector<MeshLod> levels;
+    std::vector<uint32_t> indices;
+};
+
+#endif //OPENGL_REVIEW_MESH_H
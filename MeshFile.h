@@ -0,0 +1,436 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESHFILE_H
+#define OPENGL_REVIEW_MESHFILE_H
+
+#include <glad.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Mesh.h"
+#include "GLObjects.h"
+#include "Shader.h"
+#include "VertexLayout.h"
+#include "VertexPacking.h"
+
+/*
+ * Binary mesh file: everything already in the layout GL wants, so loading is mmap + glBufferData.
+ *  > Header (fixed size): counts, section offsets, bounds, dequantization range and the vertex attribute list
+ *  > vertices: one interleaved stream (float, or quantized by PackedMesh)
+ *  > indices: uint16 when there are few enough vertices, uint32 otherwise
+ *  > meshlets: Meshlet records, then their vertex indices (uint32), then their triangles (3 bytes each)
+ *  > lods: MeshLod records, ranges of the index section (which then holds every level, finest first)
+ * Sections start 16 byte aligned. Little endian only, like every GPU we target.
+ * Written by write() (tools/mesh_convert turns OBJ/PLY into these), read by load().
+ */
+class MeshFile {
+public:
+    enum Semantic : uint32_t { POSITION = 0, TEXCOORD = 1, NORMAL = 2 };
+    enum Flags : uint32_t { QUANTIZED = 1 };
+
+    struct Attribute {
+        uint32_t semantic;
+        uint32_t type;       // GL type enum
+        uint16_t components;
+        uint16_t normalized;
+        uint32_t offset;     // bytes into the vertex
+    };
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t flags;
+        uint32_t attributeCount;
+        Attribute attributes[4];
+        uint32_t vertexCount, vertexStride;
+        uint64_t vertexOffset;
+        uint32_t indexCount, indexType;
+        uint64_t indexOffset;
+        uint32_t meshletCount, meshletVertexCount, meshletTriangleCount, reserved;
+        uint64_t meshletOffset, meshletVertexOffset, meshletTriangleOffset;
+        uint32_t lodCount, lodReserved;
+        uint64_t lodOffset;
+        float boundsMin[3], boundsMax[3];
+        float dequantizeMin[3], dequantizeExtent[3];
+    };
+    static constexpr char MAGIC[4] = {'M', 'E', 'S', 'H'};
+    static constexpr uint32_t VERSION = 2;
+
+    // GL objects and what's needed to draw them
+    GLBuffer vertexBuffer, elementBuffer;
+    uint32_t vertexCount = 0, indexCount = 0;
+    GLenum indexType = GL_UNSIGNED_INT;
+    Mesh::Bounds bounds = {glm::vec3(0.0f), glm::vec3(0.0f)};
+    bool quantized = false;
+    glm::vec3 dequantizeMin = glm::vec3(0.0f), dequantizeExtent = glm::vec3(0.0f);
+    MeshletData meshlets;
+    std::vector<MeshLod> lods; // at least one, level 0 is the whole mesh
+
+    // with lodChain, its indices replace mesh.indices
+    static bool write(const std::string &path, const Mesh &mesh, bool quantize,
+                      const MeshletData *meshletData = nullptr, const LodChain *lodChain = nullptr) {
+        Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+
+        std::vector<uint8_t> vertices;
+        bool hasUVs = !mesh.uvs.empty(), hasNormals = !mesh.normals.empty();
+        if (quantize) {
+            PackedMesh packed = PackedMesh::pack(mesh);
+            packed.printReport();
+            vertices = std::move(packed.vertices);
+            header.flags |= QUANTIZED;
+            header.vertexStride = packed.vertexSize;
+            header.attributes[header.attributeCount++] = {POSITION, GL_UNSIGNED_SHORT, 3, 1, 0};
+            if (hasUVs)
+                header.attributes[header.attributeCount++] = {TEXCOORD, GL_HALF_FLOAT, 2, 0, 8};
+            if (hasNormals)
+                header.attributes[header.attributeCount++] = {NORMAL, GL_INT_2_10_10_10_REV, 4, 1, hasUVs ? 12u : 8u};
+            for (int i = 0; i < 3; ++i) {
+                header.dequantizeMin[i] = packed.boundsMin[i];
+                header.dequantizeExtent[i] = packed.boundsExtent[i];
+            }
+        } else {
+            header.vertexStride = 12 + (hasUVs ? 8 : 0) + (hasNormals ? 12 : 0);
+            header.attributes[header.attributeCount++] = {POSITION, GL_FLOAT, 3, 0, 0};
+            if (hasUVs)
+                header.attributes[header.attributeCount++] = {TEXCOORD, GL_FLOAT, 2, 0, 12};
+            if (hasNormals)
+                header.attributes[header.attributeCount++] = {NORMAL, GL_FLOAT, 3, 0, hasUVs ? 20u : 12u};
+            vertices.resize(mesh.positions.size() * header.vertexStride);
+            for (size_t i = 0; i < mesh.positions.size(); ++i) {
+                uint8_t *out = &vertices[i * header.vertexStride];
+                memcpy(out, &mesh.positions[i].x, 12);
+                if (hasUVs)
+                    memcpy(out + 12, &mesh.uvs[i].x, 8);
+                if (hasNormals)
+                    memcpy(out + (hasUVs ? 20 : 12), &mesh.normals[i].x, 12);
+            }
+        }
+        header.vertexCount = (uint32_t)mesh.positions.size();
+
+        // unindexed meshes get the trivial index buffer so every file draws the same way
+        std::vector<uint32_t> indices = lodChain != nullptr ? lodChain->indices : mesh.indices;
+        if (indices.empty())
+            for (uint32_t i = 0; i < header.vertexCount; ++i)
+                indices.push_back(i);
+        header.indexCount = (uint32_t)indices.size();
+        bool shortIndices = header.vertexCount <= 65536;
+        header.indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        Mesh::Bounds b = mesh.bounds();
+        for (int i = 0; i < 3; ++i) {
+            header.boundsMin[i] = b.min[i];
+            header.boundsMax[i] = b.max[i];
+        }
+
+        uint64_t offset = align(sizeof(Header));
+        header.vertexOffset = offset;
+        offset = align(offset + vertices.size());
+        header.indexOffset = offset;
+        offset = align(offset + indices.size() * (shortIndices ? 2 : 4));
+        if (meshletData != nullptr) {
+            header.meshletCount = (uint32_t)meshletData->meshlets.size();
+            header.meshletVertexCount = (uint32_t)meshletData->vertices.size();
+            header.meshletTriangleCount = (uint32_t)(meshletData->triangles.size() / 3);
+            header.meshletOffset = offset;
+            offset = align(offset + meshletData->meshlets.size() * sizeof(Meshlet));
+            header.meshletVertexOffset = offset;
+            offset = align(offset + meshletData->vertices.size() * sizeof(uint32_t));
+            header.meshletTriangleOffset = offset;
+            offset = align(offset + meshletData->triangles.size());
+        }
+        if (lodChain != nullptr) {
+            header.lodCount = (uint32_t)lodChain->levels.size();
+            header.lodOffset = offset;
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            std::cout << "ERROR::MESH::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        file.write((const char*)&header, sizeof(header));
+        pad(file, header.vertexOffset);
+        file.write((const char*)vertices.data(), vertices.size());
+        pad(file, header.indexOffset);
+        if (shortIndices) {
+            std::vector<uint16_t> shorts(indices.begin(), indices.end());
+            file.write((const char*)shorts.data(), shorts.size() * 2);
+        } else {
+            file.write((const char*)indices.data(), indices.size() * 4);
+        }
+        if (meshletData != nullptr) {
+            pad(file, header.meshletOffset);
+            file.write((const char*)meshletData->meshlets.data(), meshletData->meshlets.size() * sizeof(Meshlet));
+            pad(file, header.meshletVertexOffset);
+            file.write((const char*)meshletData->vertices.data(), meshletData->vertices.size() * sizeof(uint32_t));
+            pad(file, header.meshletTriangleOffset);
+            file.write((const char*)meshletData->triangles.data(), meshletData->triangles.size());
+        }
+        if (lodChain != nullptr) {
+            pad(file, header.lodOffset);
+            file.write((const char*)lodChain->levels.data(), lodChain->levels.size() * sizeof(MeshLod));
+        }
+        return bool(file);
+    }
+
+    // maps the file and uploads the vertex and index sections as they are; needs a current context
+    bool load(const std::string &path) {
+        size_t size = 0;
+        const uint8_t *data = map(path, size);
+        if (data == nullptr) {
+            std::cout << "ERROR::MESH::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+            return false;
+        }
+        bool ok = read(data, size);
+        if (!ok)
+            std::cout << "ERROR::MESH::INVALID_FILE " << path << std::endl;
+        unmap(data, size);
+        return ok;
+    }
+
+    VertexLayout layout() const {
+        static const char *names[] = {"aPos", "aTexCoord", "aNormal"};
+        VertexLayout layout;
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < header.attributeCount; ++i) {
+            const Attribute &attribute = header.attributes[i];
+            if (attribute.offset > offset)
+                layout.skip(attribute.offset - offset);
+            layout.attribute(names[attribute.semantic], attribute.components, attribute.type, attribute.normalized != 0);
+            offset = attribute.offset + attributeSize(attribute);
+        }
+        if (header.vertexStride > offset)
+            layout.skip(header.vertexStride - offset);
+        return layout;
+    }
+
+    // dequantization range for QUANTIZED shader variants, the shader has to be in use
+    void setUniforms(const Shader &shader) const {
+        shader.setVec3("boundsMin", dequantizeMin);
+        shader.setVec3("boundsExtent", dequantizeExtent);
+    }
+
+    void draw(size_t lod = 0) const {
+        const MeshLod &level = lods[std::min(lod, lods.size() - 1)];
+        size_t indexSize = indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+        glDrawElements(GL_TRIANGLES, level.indexCount, indexType, (void*)(level.indexOffset * indexSize));
+    }
+
+    /*
+     * Coarsest level whose error covers at most pixelError pixels on screen. The error is scaled by the model matrix
+     * and projected at the distance of the near side of the bounding sphere, with the same projection the shader gets:
+     * projection[1][1] is cot(fov / 2), so a length L at distance d spans L * projection[1][1] / d of half the
+     * viewport. Orthographic projections (projection[2][3] == 0) don't divide by the distance.
+     */
+    size_t selectLod(const glm::mat4 &model, const glm::mat4 &view, const glm::mat4 &projection,
+                     float viewportHeight, float pixelError = 1.0f) const {
+        if (lods.size() < 2)
+            return 0;
+        glm::vec3 center = (bounds.min + bounds.max) * 0.5f;
+        float scale = std::max(glm::length(glm::vec3(model[0])),
+                               std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+        float radius = glm::length(bounds.max - bounds.min) * 0.5f * scale;
+        glm::vec4 viewCenter = view * model * glm::vec4(center, 1.0f);
+        float pixelsPerUnit = projection[1][1] * viewportHeight * 0.5f;
+        if (projection[2][3] != 0.0f) {
+            float distance = -viewCenter.z - radius;
+            if (distance <= 0.0f)
+                return 0; // camera inside the bounds
+            pixelsPerUnit /= distance;
+        }
+        for (size_t lod = lods.size() - 1; lod > 0; --lod)
+            if (lods[lod].error * scale * pixelsPerUnit <= pixelError)
+                return lod;
+        return 0;
+    }
+
+    void deleteBuffers() {
+        vertexBuffer.reset();
+        elementBuffer.reset();
+    }
+
+private:
+    Header header = {};
+
+    static uint64_t align(uint64_t offset) {
+        return (offset + 15) & ~uint64_t(15);
+    }
+    static void pad(std::ofstream &file, uint64_t offset) {
+        static const char zeros[16] = {};
+        file.write(zeros, offset - uint64_t(file.tellp()));
+    }
+    static uint32_t attributeSize(const Attribute &attribute) {
+        switch (attribute.type) {
+            case GL_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_2_10_10_10_REV:
+                return 4;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+                return 2 * attribute.components;
+            case GL_UNSIGNED_BYTE: case GL_BYTE:
+                return attribute.components;
+            default:
+                return 4 * attribute.components;
+        }
+    }
+
+    // count elements of elementSize at offset fit in a file of size bytes (written so nothing can overflow), and
+    // start 16 byte aligned like the format says (the records are read in place)
+    static bool section(uint64_t offset, uint64_t count, uint64_t elementSize, size_t size) {
+        if (offset % 16 != 0 || offset > size)
+            return false;
+        return elementSize == 0 ? count == 0 : count <= (size - offset) / elementSize;
+    }
+
+    // check every section lies inside the file and every index inside its target before handing anything to GL
+    bool read(const uint8_t *data, size_t size) {
+        if (size < sizeof(Header))
+            return false;
+        memcpy(&header, data, sizeof(Header));
+        if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.attributeCount > 4)
+            return false;
+        for (uint32_t i = 0; i < header.attributeCount; ++i)
+            if (header.attributes[i].semantic > NORMAL ||
+                uint64_t(header.attributes[i].offset) + attributeSize(header.attributes[i]) > header.vertexStride)
+                return false;
+        if (header.indexType != GL_UNSIGNED_SHORT && header.indexType != GL_UNSIGNED_INT)
+            return false;
+        uint64_t indexElement = header.indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+        if (!section(header.vertexOffset, header.vertexCount, header.vertexStride, size) ||
+            !section(header.indexOffset, header.indexCount, indexElement, size) ||
+            !section(header.meshletOffset, header.meshletCount, sizeof(Meshlet), size) ||
+            !section(header.meshletVertexOffset, header.meshletVertexCount, sizeof(uint32_t), size) ||
+            !section(header.meshletTriangleOffset, header.meshletTriangleCount, 3, size) ||
+            !section(header.lodOffset, header.lodCount, sizeof(MeshLod), size))
+            return false;
+        uint64_t indexSize = uint64_t(header.indexCount) * indexElement;
+        uint64_t vertexSize = uint64_t(header.vertexCount) * header.vertexStride;
+
+        // every index GL or the culler will follow has to land on a vertex
+        const uint8_t *indexData = data + header.indexOffset;
+        for (uint32_t i = 0; i < header.indexCount; ++i) {
+            uint32_t index;
+            if (header.indexType == GL_UNSIGNED_SHORT) {
+                uint16_t shortIndex;
+                memcpy(&shortIndex, indexData + i * 2, 2);
+                index = shortIndex;
+            } else {
+                memcpy(&index, indexData + i * 4, 4);
+            }
+            if (index >= header.vertexCount)
+                return false;
+        }
+        const Meshlet *m = (const Meshlet*)(data + header.meshletOffset);
+        const uint32_t *v = (const uint32_t*)(data + header.meshletVertexOffset);
+        const uint8_t *t = data + header.meshletTriangleOffset;
+        for (uint32_t i = 0; i < header.meshletVertexCount; ++i)
+            if (v[i] >= header.vertexCount)
+                return false;
+        for (uint32_t i = 0; i < header.meshletCount; ++i) {
+            const Meshlet &meshlet = m[i];
+            if (meshlet.vertexOffset > header.meshletVertexCount ||
+                meshlet.vertexCount > header.meshletVertexCount - meshlet.vertexOffset ||
+                meshlet.triangleOffset % 3 != 0 || meshlet.triangleOffset / 3 > header.meshletTriangleCount ||
+                meshlet.triangleCount > header.meshletTriangleCount - meshlet.triangleOffset / 3)
+                return false;
+            for (uint64_t j = 0; j < uint64_t(meshlet.triangleCount) * 3; ++j)
+                if (t[meshlet.triangleOffset + j] >= meshlet.vertexCount)
+                    return false;
+        }
+        const MeshLod *l = (const MeshLod*)(data + header.lodOffset);
+        for (uint32_t i = 0; i < header.lodCount; ++i)
+            if (uint64_t(l[i].indexOffset) + l[i].indexCount > header.indexCount)
+                return false;
+        if (header.lodCount > 0)
+            lods.assign(l, l + header.lodCount);
+        else
+            lods.assign(1, MeshLod{0, header.indexCount, 0.0f});
+
+        vertexCount = header.vertexCount;
+        indexCount = header.indexCount;
+        indexType = header.indexType;
+        quantized = (header.flags & QUANTIZED) != 0;
+        for (int i = 0; i < 3; ++i) {
+            bounds.min[i] = header.boundsMin[i];
+            bounds.max[i] = header.boundsMax[i];
+            dequantizeMin[i] = header.dequantizeMin[i];
+            dequantizeExtent[i] = header.dequantizeExtent[i];
+        }
+
+        vertexBuffer = GLBuffer::create();
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.id());
+        glBufferData(GL_ARRAY_BUFFER, vertexSize, data + header.vertexOffset, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        // no VAO bound here, so binding the element buffer doesn't attach it to anything
+        elementBuffer = GLBuffer::create();
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer.id());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexSize, data + header.indexOffset, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+        // meshlets are culled on the CPU, so they're the one part that gets copied
+        meshlets.meshlets.assign(m, m + header.meshletCount);
+        meshlets.vertices.assign(v, v + header.meshletVertexCount);
+        meshlets.triangles.assign(t, t + header.meshletTriangleCount * 3);
+        return true;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    static const uint8_t *map(const std::string &path, size_t &size) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return nullptr;
+        struct stat info;
+        void *data = MAP_FAILED;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            size = size_t(info.st_size);
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        // the mapping stays valid without the descriptor
+        close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+        // read ahead: every byte of the vertex and index sections is about to be copied once, front to back
+        madvise(data, size, MADV_SEQUENTIAL);
+        madvise(data, size, MADV_WILLNEED);
+        return (const uint8_t*)data;
+    }
+    static void unmap(const uint8_t *data, size_t size) {
+        munmap((void*)data, size);
+    }
+#else
+    // no mmap: one read into memory, still no parsing
+    static const uint8_t *map(const std::string &path, size_t &size) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            return nullptr;
+        size = size_t(file.tellg());
+        uint8_t *data = new uint8_t[size];
+        file.seekg(0);
+        if (!file.read((char*)data, size)) {
+            delete[] data;
+            return nullptr;
+        }
+        return data;
+    }
+    static void unmap(const uint8_t *data, size_t) {
+        delete[] data;
+    }
+#endif
+};
+
+#endif //OPENGL_REVIEW_MESHFILE_H
@@ -0,0 +1,919 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESHIMPORTER_H
+#define OPENGL_REVIEW_MESHIMPORTER_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Mesh.h"
+#include "ThreadPool.h"
+
+/*
+ * OBJ and PLY into an indexed Mesh, on all cores (the inputs run to tens of millions of triangles).
+ *  > OBJ: v / vt / vn / f (polygons are fanned into triangles, negative indices count back from the face)
+ *    every distinct v/vt/vn corner becomes one vertex
+ *  > PLY: ascii or binary_little_endian; vertex x y z [nx ny nz] [u v | s t], face vertex_indices
+ * Text is cut into line aligned chunks that are parsed on their own and stitched back together in file order, numbers
+ * go through std::from_chars. Corners are deduplicated in hash buckets (one bucket per task) and vertices are numbered
+ * in order of first use, so the index buffer stays as cache friendly as the file was.
+ * load() welds the result: vertices with the same position, uv and normal become one (weld()).
+ */
+class MeshImporter {
+public:
+    // weldEpsilon: 0 merges only exact duplicates, < 0 skips welding
+    static bool load(const std::string &path, Mesh &mesh, float weldEpsilon = 0.0f,
+                     ThreadPool &pool = ThreadPool::shared()) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            std::cout << "ERROR::MESH::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+            return false;
+        }
+        std::string text(size_t(file.tellg()), '\0');
+        file.seekg(0);
+        file.read(&text[0], text.size());
+
+        std::string extension = path.substr(std::min(path.size(), path.find_last_of('.')));
+        for (char &c : extension)
+            c = char(std::tolower((unsigned char)c));
+        bool loaded;
+        if (extension == ".obj")
+            loaded = loadObj(text, mesh, pool);
+        else if (extension == ".ply")
+            loaded = loadPly(text, mesh, pool);
+        else {
+            std::cout << "ERROR::MESH::UNKNOWN_FORMAT " << path << std::endl;
+            return false;
+        }
+        if (loaded && weldEpsilon >= 0.0f)
+            weld(mesh, weldEpsilon, pool);
+        return loaded;
+    }
+
+    static bool loadObj(const std::string &text, Mesh &mesh, ThreadPool &pool = ThreadPool::shared()) {
+        mesh = Mesh();
+        std::vector<ObjChunk> chunks;
+        for (const Span &span : splitLines(text.data(), text.data() + text.size(), pool))
+            chunks.emplace_back(span.begin, span.end);
+        pool.parallelFor(chunks.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t c = begin; c < end; ++c)
+                parseObjChunk(chunks[c]);
+        });
+
+        // element counts before each chunk; the first error in file order wins
+        std::vector<std::array<size_t, 3>> base(chunks.size() + 1);
+        std::vector<size_t> cornerBase(chunks.size() + 1);
+        size_t line = 0;
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            const ObjChunk &chunk = chunks[c];
+            if (chunk.errorLine) {
+                std::cout << "ERROR::MESH::" << chunk.error << " line " << line + chunk.errorLine << std::endl;
+                return false;
+            }
+            line += chunk.lines;
+            base[c + 1] = {base[c][0] + chunk.positions.size(), base[c][1] + chunk.uvs.size(),
+                           base[c][2] + chunk.normals.size()};
+            cornerBase[c + 1] = cornerBase[c] + chunk.corners.size();
+        }
+        const std::array<size_t, 3> &total = base[chunks.size()];
+
+        std::vector<glm::vec3> positions(total[0]), normals(total[2]);
+        std::vector<glm::vec2> uvs(total[1]);
+        std::vector<Corner> corners(cornerBase[chunks.size()]);
+        std::atomic<bool> badIndex{false};
+        pool.parallelFor(chunks.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t c = begin; c < end; ++c) {
+                ObjChunk &chunk = chunks[c];
+                std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + base[c][0]);
+                std::copy(chunk.uvs.begin(), chunk.uvs.end(), uvs.begin() + base[c][1]);
+                std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + base[c][2]);
+                // negative indices were counted from the chunk start, wrapping around is fine in unsigned
+                for (size_t r : chunk.relative)
+                    chunk.corners[r / 3][r % 3] += uint32_t(base[c][r % 3]);
+                Corner *out = &corners[cornerBase[c]];
+                for (const Corner &corner : chunk.corners) {
+                    if (corner[0] >= total[0] || (corner[1] != NONE && corner[1] >= total[1]) ||
+                        (corner[2] != NONE && corner[2] >= total[2]))
+                        badIndex = true;
+                    *out++ = corner;
+                }
+                chunk = ObjChunk();
+            }
+        });
+        if (badIndex) {
+            std::cout << "ERROR::MESH::BAD_FACE index out of range" << std::endl;
+            return false;
+        }
+
+        std::vector<uint32_t> first;
+        deduplicate(corners, mesh.indices, first, pool);
+        bool hasUVs = false, hasNormals = false;
+        for (size_t i = 0; i < first.size() && !(hasUVs && hasNormals); ++i) {
+            hasUVs = hasUVs || corners[first[i]][1] != NONE;
+            hasNormals = hasNormals || corners[first[i]][2] != NONE;
+        }
+        mesh.positions.resize(first.size());
+        mesh.uvs.resize(hasUVs ? first.size() : 0);
+        mesh.normals.resize(hasNormals ? first.size() : 0);
+        pool.parallelFor(first.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) {
+                const Corner &corner = corners[first[i]];
+                mesh.positions[i] = positions[corner[0]];
+                if (hasUVs)
+                    mesh.uvs[i] = corner[1] != NONE ? uvs[corner[1]] : glm::vec2(0.0f);
+                if (hasNormals)
+                    mesh.normals[i] = corner[2] != NONE ? normals[corner[2]] : glm::vec3(0.0f);
+            }
+        }, 4096);
+        return true;
+    }
+
+    static bool loadPly(const std::string &text, Mesh &mesh, ThreadPool &pool = ThreadPool::shared()) {
+        mesh = Mesh();
+        PlyHeader header;
+        if (!parsePlyHeader(text, header))
+            return false;
+        if (!plyCountsFit(text, header))
+            return plyTruncated();
+        const PlyElement *vertices = nullptr, *faces = nullptr;
+        for (const PlyElement &element : header.elements) {
+            if (element.name == "vertex")
+                vertices = &element;
+            else if (element.name == "face")
+                faces = &element;
+        }
+        if (!vertices || vertices->slot[0] < 0 || vertices->slot[1] < 0 || vertices->slot[2] < 0) {
+            std::cout << "ERROR::MESH::PLY_HEADER no vertex x y z" << std::endl;
+            return false;
+        }
+        for (const PlyProperty &property : vertices->properties) {
+            if (property.countType != NONE_TYPE) {
+                std::cout << "ERROR::MESH::PLY_HEADER list property " << property.name << " in vertex" << std::endl;
+                return false;
+            }
+        }
+        if (faces && faces->indexList < 0) {
+            std::cout << "ERROR::MESH::PLY_HEADER no vertex_indices in face" << std::endl;
+            return false;
+        }
+
+        bool hasNormals = vertices->slot[3] >= 0 && vertices->slot[4] >= 0 && vertices->slot[5] >= 0;
+        bool hasUVs = vertices->slot[6] >= 0 && vertices->slot[7] >= 0;
+        mesh.positions.resize(vertices->count);
+        mesh.normals.resize(hasNormals ? vertices->count : 0);
+        mesh.uvs.resize(hasUVs ? vertices->count : 0);
+
+        bool parsed = header.binary ? parsePlyBinary(text, header, mesh, pool) : parsePlyAscii(text, header, mesh, pool);
+        if (!parsed)
+            return false;
+
+        std::atomic<bool> badIndex{false};
+        size_t vertexCount = mesh.positions.size();
+        pool.parallelFor(mesh.indices.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i)
+                if (mesh.indices[i] >= vertexCount)
+                    badIndex = true;
+        }, 1 << 16);
+        if (badIndex) {
+            std::cout << "ERROR::MESH::BAD_FACE index out of range" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    /*
+     * Merges vertices whose position, uv and normal agree, and drops the triangles that collapse because of it.
+     * epsilon 0 compares exactly; otherwise attributes are snapped to a grid of epsilon and vertices in the same cell
+     * merge (keeping the first one's values), so two vertices just either side of a cell border stay apart.
+     */
+    static void weld(Mesh &mesh, float epsilon, ThreadPool &pool = ThreadPool::shared()) {
+        size_t count = mesh.positions.size();
+        bool hasUVs = mesh.uvs.size() == count, hasNormals = mesh.normals.size() == count;
+        std::vector<std::array<uint32_t, 8>> keys(count);
+        pool.parallelFor(count, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) {
+                std::array<uint32_t, 8> &key = keys[i];
+                key.fill(0);
+                for (int k = 0; k < 3; ++k)
+                    key[k] = weldKey(mesh.positions[i][k], epsilon);
+                for (int k = 0; k < 2 && hasUVs; ++k)
+                    key[3 + k] = weldKey(mesh.uvs[i][k], epsilon);
+                for (int k = 0; k < 3 && hasNormals; ++k)
+                    key[5 + k] = weldKey(mesh.normals[i][k], epsilon);
+            }
+        }, 4096);
+        std::vector<uint32_t> ids, first;
+        deduplicate(keys, ids, first, pool);
+        keys = std::vector<std::array<uint32_t, 8>>();
+        if (first.size() == count)
+            return;
+
+        Mesh welded;
+        welded.positions.resize(first.size());
+        welded.uvs.resize(hasUVs ? first.size() : 0);
+        welded.normals.resize(hasNormals ? first.size() : 0);
+        pool.parallelFor(first.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) {
+                welded.positions[i] = mesh.positions[first[i]];
+                if (hasUVs)
+                    welded.uvs[i] = mesh.uvs[first[i]];
+                if (hasNormals)
+                    welded.normals[i] = mesh.normals[first[i]];
+            }
+        }, 4096);
+        size_t corners = mesh.triangleCount() * 3;
+        welded.indices.reserve(corners);
+        for (size_t i = 0; i < corners; i += 3) {
+            uint32_t a = ids[mesh.index(i)], b = ids[mesh.index(i + 1)], c = ids[mesh.index(i + 2)];
+            if (a != b && b != c && c != a) {
+                welded.indices.push_back(a);
+                welded.indices.push_back(b);
+                welded.indices.push_back(c);
+            }
+        }
+        mesh = std::move(welded);
+    }
+
+private:
+    using Corner = std::array<uint32_t, 3>; // v, vt, vn, 0-based
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    struct Span {
+        const char *begin, *end;
+    };
+
+    struct ObjChunk {
+        const char *begin = nullptr, *end = nullptr;
+        std::vector<glm::vec3> positions, normals;
+        std::vector<glm::vec2> uvs;
+        std::vector<Corner> corners;  // three per triangle
+        std::vector<size_t> relative; // corners[r / 3][r % 3] came from a negative index, still relative to the chunk
+        size_t lines = 0;
+        size_t errorLine = 0; // 1-based within the chunk, 0 = none
+        const char *error = nullptr;
+
+        ObjChunk() = default;
+        ObjChunk(const char *begin, const char *end) : begin(begin), end(end) {}
+    };
+
+    // about 1MB per chunk and up to 16 per thread, each ends after a '\n' (or at the end of the text)
+    static std::vector<Span> splitLines(const char *begin, const char *end, ThreadPool &pool) {
+        size_t size = end - begin;
+        size_t count = std::max<size_t>(1, std::min<size_t>(size >> 20, pool.size() * 16));
+        std::vector<Span> spans;
+        const char *p = begin;
+        for (size_t i = 1; i <= count && p < end; ++i) {
+            const char *split = i == count ? end : std::max(p, begin + size * i / count);
+            const char *newline = split < end ? (const char*)memchr(split, '\n', end - split) : nullptr;
+            split = newline ? newline + 1 : end;
+            spans.push_back({p, split});
+            p = split;
+        }
+        return spans;
+    }
+
+    static const char *lineEnd(const char *p, const char *end) {
+        const char *newline = (const char*)memchr(p, '\n', end - p);
+        return newline ? newline : end;
+    }
+
+    static const char *skipBlanks(const char *p, const char *end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+            p++;
+        return p;
+    }
+
+    // nullptr if there is no number; from_chars takes neither leading blanks nor '+'
+    static const char *parseFloat(const char *p, const char *end, float &out) {
+        p = skipBlanks(p, end);
+        if (p < end && *p == '+')
+            p++;
+        if (p >= end || *p == '\n')
+            return nullptr;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        std::from_chars_result result = std::from_chars(p, end, out);
+        if (result.ec == std::errc::result_out_of_range)
+            out = 0.0f; // denormals
+        else if (result.ec != std::errc())
+            return nullptr;
+        return result.ptr;
+#else
+        // the text is a std::string, so strtof stops at its terminating 0 at the latest
+        char *next;
+        out = std::strtof(p, &next);
+        return next == p ? nullptr : next;
+#endif
+    }
+
+    template<typename T>
+    static const char *parseInt(const char *p, const char *end, T &out) {
+        p = skipBlanks(p, end);
+        if (p < end && *p == '+')
+            p++;
+        std::from_chars_result result = std::from_chars(p, end, out);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+
+    static void parseObjChunk(ObjChunk &chunk) {
+        std::vector<Corner> polygon;
+        std::vector<uint8_t> polygonRelative;
+        for (const char *p = chunk.begin; p < chunk.end;) {
+            const char *end = lineEnd(p, chunk.end);
+            chunk.lines++;
+            const char *error = nullptr;
+            if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+                glm::vec3 v;
+                const char *q = p + 1;
+                for (int k = 0; k < 3 && q; ++k)
+                    q = parseFloat(q, end, v[k]);
+                if (q)
+                    chunk.positions.push_back(v);
+                else
+                    error = "BAD_VERTEX";
+            } else if (p[0] == 'v' && p[1] == 't') {
+                glm::vec2 v(0.0f); // "vt u" is allowed, v defaults to 0
+                const char *q = parseFloat(p + 2, end, v.x);
+                if (q && !parseFloat(q, end, v.y))
+                    v.y = 0.0f;
+                if (q)
+                    chunk.uvs.push_back(v);
+                else
+                    error = "BAD_VERTEX";
+            } else if (p[0] == 'v' && p[1] == 'n') {
+                glm::vec3 v;
+                const char *q = p + 2;
+                for (int k = 0; k < 3 && q; ++k)
+                    q = parseFloat(q, end, v[k]);
+                if (q)
+                    chunk.normals.push_back(v);
+                else
+                    error = "BAD_VERTEX";
+            } else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+                polygon.clear();
+                polygonRelative.clear();
+                const char *q = skipBlanks(p + 1, end);
+                size_t counts[3] = {chunk.positions.size(), chunk.uvs.size(), chunk.normals.size()};
+                while (q < end && !error) {
+                    // v, v/vt, v//vn or v/vt/vn
+                    Corner corner = {NONE, NONE, NONE};
+                    uint8_t relative = 0;
+                    for (int k = 0; k < 3; ++k) {
+                        if (k > 0) {
+                            if (q >= end || *q != '/')
+                                break;
+                            q++;
+                        }
+                        long index;
+                        std::from_chars_result result = std::from_chars(q, end, index);
+                        if (result.ec != std::errc()) {
+                            if (k == 0)
+                                error = "BAD_FACE";
+                            continue;
+                        }
+                        q = result.ptr;
+                        if (index > 0) {
+                            corner[k] = uint32_t(index - 1);
+                        } else if (index < 0) {
+                            corner[k] = uint32_t(long(counts[k]) + index);
+                            relative |= uint8_t(1 << k);
+                        } else {
+                            error = "BAD_FACE";
+                        }
+                    }
+                    if (q < end && *q != ' ' && *q != '\t' && *q != '\r')
+                        error = "BAD_FACE";
+                    polygon.push_back(corner);
+                    polygonRelative.push_back(relative);
+                    q = skipBlanks(q, end);
+                }
+                if (!error && polygon.size() < 3)
+                    error = "BAD_FACE";
+                for (size_t i = 2; i < polygon.size() && !error; ++i) {
+                    for (size_t k : {size_t(0), i - 1, i}) {
+                        for (int j = 0; j < 3; ++j)
+                            if (polygonRelative[k] & (1 << j))
+                                chunk.relative.push_back(chunk.corners.size() * 3 + j);
+                        chunk.corners.push_back(polygon[k]);
+                    }
+                }
+            }
+            if (error) {
+                chunk.error = error;
+                chunk.errorLine = chunk.lines;
+                return;
+            }
+            p = end + 1;
+        }
+    }
+
+    struct KeyHash {
+        template<size_t N>
+        size_t operator()(const std::array<uint32_t, N> &key) const {
+            uint64_t h = 0xcbf29ce484222325ull;
+            for (uint32_t word : key)
+                h = (h ^ word) * 0x100000001b3ull;
+            return size_t(h ^ (h >> 29));
+        }
+    };
+
+    /*
+     * ids[i] = vertex of keys[i], vertices numbered in order of first use; first[v] = i of v's first use.
+     *  1. keys are split into segments, each counts how many of its keys fall in which hash bucket
+     *  2. key numbers are scattered bucket by bucket (segments in order, so each bucket stays in key order)
+     *  3. each bucket gives its distinct keys local ids with a hash map of its own
+     *  4. first uses are counted per segment and numbered with a prefix sum, then every key looks its number up
+     */
+    template<size_t N>
+    static void deduplicate(const std::vector<std::array<uint32_t, N>> &keys, std::vector<uint32_t> &ids,
+                            std::vector<uint32_t> &first, ThreadPool &pool) {
+        size_t count = keys.size();
+        size_t buckets = pool.size() * 8, segments = pool.size() * 4;
+        ids.assign(count, 0);
+        std::vector<uint32_t> bucketOf(count), order(count);
+        std::vector<uint8_t> isFirst(count, 0);
+        std::vector<size_t> offsets(segments * buckets, 0);
+        auto segmentBegin = [&](size_t s) { return count * s / segments; };
+
+        pool.parallelFor(segments, [&](size_t begin, size_t end, unsigned) {
+            for (size_t s = begin; s < end; ++s) {
+                for (size_t i = segmentBegin(s); i < segmentBegin(s + 1); ++i) {
+                    bucketOf[i] = uint32_t((uint64_t(KeyHash()(keys[i])) >> 7) % buckets);
+                    offsets[s * buckets + bucketOf[i]]++;
+                }
+            }
+        });
+        std::vector<size_t> bucketBegin(buckets + 1, 0);
+        size_t running = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            bucketBegin[b] = running;
+            for (size_t s = 0; s < segments; ++s) {
+                size_t n = offsets[s * buckets + b];
+                offsets[s * buckets + b] = running;
+                running += n;
+            }
+        }
+        bucketBegin[buckets] = running;
+        pool.parallelFor(segments, [&](size_t begin, size_t end, unsigned) {
+            for (size_t s = begin; s < end; ++s)
+                for (size_t i = segmentBegin(s); i < segmentBegin(s + 1); ++i)
+                    order[offsets[s * buckets + bucketOf[i]]++] = uint32_t(i);
+        });
+
+        std::vector<std::vector<uint32_t>> renumber(buckets);
+        pool.parallelFor(buckets, [&](size_t begin, size_t end, unsigned) {
+            for (size_t b = begin; b < end; ++b) {
+                std::unordered_map<std::array<uint32_t, N>, uint32_t, KeyHash> local;
+                local.reserve(bucketBegin[b + 1] - bucketBegin[b]);
+                for (size_t o = bucketBegin[b]; o < bucketBegin[b + 1]; ++o) {
+                    uint32_t i = order[o];
+                    auto inserted = local.emplace(keys[i], uint32_t(local.size()));
+                    ids[i] = inserted.first->second;
+                    isFirst[i] = inserted.second;
+                }
+                renumber[b].resize(local.size());
+            }
+        });
+        order = std::vector<uint32_t>();
+
+        std::vector<size_t> segmentFirst(segments + 1, 0);
+        pool.parallelFor(segments, [&](size_t begin, size_t end, unsigned) {
+            for (size_t s = begin; s < end; ++s)
+                for (size_t i = segmentBegin(s); i < segmentBegin(s + 1); ++i)
+                    segmentFirst[s + 1] += isFirst[i];
+        });
+        for (size_t s = 0; s < segments; ++s)
+            segmentFirst[s + 1] += segmentFirst[s];
+        first.resize(segmentFirst[segments]);
+        pool.parallelFor(segments, [&](size_t begin, size_t end, unsigned) {
+            for (size_t s = begin; s < end; ++s) {
+                size_t next = segmentFirst[s];
+                for (size_t i = segmentBegin(s); i < segmentBegin(s + 1); ++i) {
+                    if (isFirst[i]) {
+                        first[next] = uint32_t(i);
+                        renumber[bucketOf[i]][ids[i]] = uint32_t(next++);
+                    }
+                }
+            }
+        });
+        pool.parallelFor(count, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i)
+                ids[i] = renumber[bucketOf[i]][ids[i]];
+        }, 1 << 16);
+    }
+
+    static uint32_t weldKey(float value, float epsilon) {
+        if (epsilon > 0.0f) {
+            // clamped before the conversion, which is undefined outside int32 (and for NaN, which maps to 0)
+            float cell = std::floor(value / epsilon + 0.5f);
+            if (std::isnan(cell))
+                return 0;
+            cell = std::min(std::max(cell, -2147483648.0f), 2147483520.0f); // largest float below 2^31
+            return uint32_t(int32_t(cell));
+        }
+        uint32_t bits;
+        value += 0.0f; // -0 -> +0
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    // ---- PLY ----
+
+    enum PlyType { NONE_TYPE, INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64 };
+    static constexpr int NONE_SLOT = -1;
+
+    struct PlyProperty {
+        std::string name;
+        PlyType type = NONE_TYPE;      // of the value, or of the list entries
+        PlyType countType = NONE_TYPE; // lists only
+    };
+    struct PlyElement {
+        std::string name;
+        size_t count = 0;
+        std::vector<PlyProperty> properties;
+        // vertex: property of x y z nx ny nz u v; face: property holding the index list
+        int slot[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+        int indexList = -1;
+    };
+    struct PlyHeader {
+        bool binary = false;
+        size_t bodyOffset = 0;
+        std::vector<PlyElement> elements;
+    };
+
+    static PlyType plyType(const std::string &name) {
+        static const std::unordered_map<std::string, PlyType> types = {
+                {"char", INT8}, {"int8", INT8}, {"uchar", UINT8}, {"uint8", UINT8},
+                {"short", INT16}, {"int16", INT16}, {"ushort", UINT16}, {"uint16", UINT16},
+                {"int", INT32}, {"int32", INT32}, {"uint", UINT32}, {"uint32", UINT32},
+                {"float", FLOAT32}, {"float32", FLOAT32}, {"double", FLOAT64}, {"float64", FLOAT64}};
+        auto found = types.find(name);
+        return found == types.end() ? NONE_TYPE : found->second;
+    }
+
+    static size_t plySize(PlyType type) {
+        static const size_t sizes[] = {0, 1, 1, 2, 2, 4, 4, 4, 8};
+        return sizes[type];
+    }
+
+    static double plyRead(const uint8_t *p, PlyType type) {
+        switch (type) {
+            case INT8: return double(int8_t(*p));
+            case UINT8: return double(*p);
+            case INT16: { int16_t v; memcpy(&v, p, 2); return v; }
+            case UINT16: { uint16_t v; memcpy(&v, p, 2); return v; }
+            case INT32: { int32_t v; memcpy(&v, p, 4); return v; }
+            case UINT32: { uint32_t v; memcpy(&v, p, 4); return v; }
+            case FLOAT32: { float v; memcpy(&v, p, 4); return v; }
+            case FLOAT64: { double v; memcpy(&v, p, 8); return v; }
+            default: return 0.0;
+        }
+    }
+
+    static bool parsePlyHeader(const std::string &text, PlyHeader &header) {
+        size_t end = text.find("end_header");
+        if (text.compare(0, 3, "ply") != 0 || end == std::string::npos) {
+            std::cout << "ERROR::MESH::PLY_HEADER not a ply file" << std::endl;
+            return false;
+        }
+        size_t bodyLine = text.find('\n', end);
+        header.bodyOffset = bodyLine == std::string::npos ? text.size() : bodyLine + 1;
+
+        static const char *slotNames[][8] = {{"x", "y", "z", "nx", "ny", "nz", "u", "v"},
+                                             {"x", "y", "z", "nx", "ny", "nz", "s", "t"},
+                                             {"x", "y", "z", "nx", "ny", "nz", "texture_u", "texture_v"}};
+        bool format = false;
+        size_t lineBegin = 0;
+        while (lineBegin < end) {
+            size_t lineStop = text.find('\n', lineBegin);
+            std::vector<std::string> words;
+            for (size_t i = lineBegin; i < lineStop;) {
+                while (i < lineStop && std::isspace((unsigned char)text[i]))
+                    i++;
+                size_t wordEnd = i;
+                while (wordEnd < lineStop && !std::isspace((unsigned char)text[wordEnd]))
+                    wordEnd++;
+                if (wordEnd > i)
+                    words.push_back(text.substr(i, wordEnd - i));
+                i = wordEnd;
+            }
+            lineBegin = lineStop + 1;
+            if (words.empty())
+                continue;
+            if (words[0] == "format" && words.size() >= 2) {
+                format = true;
+                if (words[1] == "binary_little_endian") {
+                    header.binary = true;
+                } else if (words[1] != "ascii") {
+                    std::cout << "ERROR::MESH::PLY_FORMAT " << words[1] << " is not supported" << std::endl;
+                    return false;
+                }
+            } else if (words[0] == "element" && words.size() >= 3) {
+                PlyElement element;
+                element.name = words[1];
+                element.count = std::strtoull(words[2].c_str(), nullptr, 10);
+                header.elements.push_back(element);
+            } else if (words[0] == "property" && !header.elements.empty()) {
+                PlyElement &element = header.elements.back();
+                PlyProperty property;
+                if (words.size() >= 5 && words[1] == "list") {
+                    property.countType = plyType(words[2]);
+                    property.type = plyType(words[3]);
+                    property.name = words[4];
+                } else if (words.size() >= 3) {
+                    property.type = plyType(words[1]);
+                    property.name = words[2];
+                }
+                if (property.type == NONE_TYPE || (words[1] == "list" && property.countType == NONE_TYPE)) {
+                    std::cout << "ERROR::MESH::PLY_HEADER bad property line " << words.size() << std::endl;
+                    return false;
+                }
+                int index = int(element.properties.size());
+                for (const auto &names : slotNames)
+                    for (int s = 0; s < 8; ++s)
+                        if (property.name == names[s] && property.countType == NONE_TYPE)
+                            element.slot[s] = index;
+                if (property.countType != NONE_TYPE &&
+                    (property.name == "vertex_indices" || property.name == "vertex_index"))
+                    element.indexList = index;
+                element.properties.push_back(property);
+            }
+        }
+        if (!format) {
+            std::cout << "ERROR::MESH::PLY_HEADER no format line" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // slot of every vertex property (-1 = not used), so vertex parsing is one switch-free loop
+    static std::vector<int> plyVertexSlots(const PlyElement &vertices) {
+        std::vector<int> slots(vertices.properties.size(), NONE_SLOT);
+        for (int s = 0; s < 8; ++s)
+            if (vertices.slot[s] >= 0)
+                slots[vertices.slot[s]] = s;
+        return slots;
+    }
+
+    static void plyStore(Mesh &mesh, size_t vertex, int slot, float value) {
+        if (slot < 3)
+            mesh.positions[vertex][slot] = value;
+        else if (slot < 6 && !mesh.normals.empty())
+            mesh.normals[vertex][slot - 3] = value;
+        else if (slot >= 6 && !mesh.uvs.empty())
+            mesh.uvs[vertex][slot - 6] = value;
+    }
+
+    // count records of recordSize bytes fit in available, without computing count * recordSize
+    static bool plyFits(size_t count, size_t recordSize, size_t available) {
+        return recordSize == 0 || count <= available / recordSize;
+    }
+
+    // every element's count against the body before anything is sized by it: a binary record takes at least the
+    // sizes of its properties (a list at least its count), an ASCII one a character and a separator per value
+    static bool plyCountsFit(const std::string &text, const PlyHeader &header) {
+        size_t available = text.size() - std::min(text.size(), header.bodyOffset);
+        for (const PlyElement &element : header.elements) {
+            size_t recordSize = 0;
+            for (const PlyProperty &property : element.properties)
+                recordSize += header.binary ? plySize(property.countType != NONE_TYPE ? property.countType
+                                                                                        : property.type) : 2;
+            recordSize = std::max<size_t>(recordSize, 1);
+            if (!plyFits(element.count, recordSize, available))
+                return false;
+            available -= element.count * recordSize;
+        }
+        return true;
+    }
+
+    static bool plyTruncated() {
+        std::cout << "ERROR::MESH::PLY_TRUNCATED" << std::endl;
+        return false;
+    }
+
+    // serial walk over one record whose size depends on its lists, returns its end or nullptr past end
+    static const uint8_t *plySkipRecord(const PlyElement &element, const uint8_t *p, const uint8_t *end) {
+        for (const PlyProperty &property : element.properties) {
+            if (property.countType == NONE_TYPE) {
+                p += plySize(property.type);
+            } else {
+                if (p + plySize(property.countType) > end)
+                    return nullptr;
+                size_t n = size_t(plyRead(p, property.countType));
+                p += plySize(property.countType) + n * plySize(property.type);
+            }
+            if (p > end)
+                return nullptr;
+        }
+        return p;
+    }
+
+    static bool parsePlyBinary(const std::string &text, const PlyHeader &header, Mesh &mesh, ThreadPool &pool) {
+        const uint8_t *p = (const uint8_t*)text.data() + header.bodyOffset;
+        const uint8_t *end = (const uint8_t*)text.data() + text.size();
+        for (const PlyElement &element : header.elements) {
+            bool fixed = true;
+            size_t stride = 0, listOffset = 0;
+            for (int i = 0; i < int(element.properties.size()); ++i) {
+                const PlyProperty &property = element.properties[i];
+                if (property.countType == NONE_TYPE) {
+                    stride += plySize(property.type);
+                } else if (i == element.indexList && element.name == "face" && fixed) {
+                    // fixed size as long as every face is a triangle, checked below
+                    listOffset = stride;
+                    stride += plySize(property.countType) + 3 * plySize(property.type);
+                } else {
+                    fixed = false;
+                }
+            }
+
+            if (element.name == "vertex") {
+                if (!plyFits(element.count, stride, size_t(end - p)))
+                    return plyTruncated();
+                std::vector<int> slots = plyVertexSlots(element);
+                std::vector<size_t> offsets;
+                for (size_t i = 0, offset = 0; i < slots.size(); offset += plySize(element.properties[i++].type))
+                    offsets.push_back(offset);
+                pool.parallelFor(element.count, [&](size_t begin, size_t stop, unsigned) {
+                    for (size_t v = begin; v < stop; ++v)
+                        for (size_t i = 0; i < slots.size(); ++i)
+                            if (slots[i] != NONE_SLOT)
+                                plyStore(mesh, v, slots[i],
+                                         float(plyRead(p + v * stride + offsets[i], element.properties[i].type)));
+                }, 4096);
+                p += element.count * stride;
+            } else if (element.name == "face") {
+                const PlyProperty &list = element.properties[element.indexList];
+                std::atomic<bool> triangles{fixed && plyFits(element.count, stride, size_t(end - p))};
+                if (triangles) {
+                    pool.parallelFor(element.count, [&](size_t begin, size_t stop, unsigned) {
+                        for (size_t f = begin; f < stop && triangles; ++f)
+                            if (plyRead(p + f * stride + listOffset, list.countType) != 3.0)
+                                triangles = false;
+                    }, 1 << 14);
+                }
+                if (triangles) {
+                    // every record's count is 3, so by induction every record starts where the fixed stride says
+                    mesh.indices.resize(element.count * 3);
+                    size_t first = listOffset + plySize(list.countType), size = plySize(list.type);
+                    pool.parallelFor(element.count, [&](size_t begin, size_t stop, unsigned) {
+                        for (size_t f = begin; f < stop; ++f)
+                            for (size_t k = 0; k < 3; ++k)
+                                mesh.indices[f * 3 + k] =
+                                        (unsigned int)plyRead(p + f * stride + first + k * size, list.type);
+                    }, 4096);
+                    p += element.count * stride;
+                } else {
+                    for (size_t f = 0; f < element.count; ++f) {
+                        const uint8_t *record = p;
+                        if (!(p = plySkipRecord(element, p, end)))
+                            return plyTruncated();
+                        const uint8_t *q = record;
+                        for (int i = 0; i < element.indexList; ++i)
+                            q = plySkipProperty(element.properties[i], q);
+                        size_t n = size_t(plyRead(q, list.countType)), size = plySize(list.type);
+                        q += plySize(list.countType);
+                        for (size_t k = 2; k < n; ++k) {
+                            mesh.indices.push_back((unsigned int)plyRead(q, list.type));
+                            mesh.indices.push_back((unsigned int)plyRead(q + (k - 1) * size, list.type));
+                            mesh.indices.push_back((unsigned int)plyRead(q + k * size, list.type));
+                        }
+                    }
+                }
+            } else if (fixed) {
+                if (!plyFits(element.count, stride, size_t(end - p)))
+                    return plyTruncated();
+                p += element.count * stride;
+            } else {
+                for (size_t i = 0; i < element.count; ++i)
+                    if (!(p = plySkipRecord(element, p, end)))
+                        return plyTruncated();
+            }
+        }
+        return true;
+    }
+
+    static const uint8_t *plySkipProperty(const PlyProperty &property, const uint8_t *p) {
+        if (property.countType == NONE_TYPE)
+            return p + plySize(property.type);
+        return p + plySize(property.countType) + size_t(plyRead(p, property.countType)) * plySize(property.type);
+    }
+
+    /*
+     * One record per line. Lines are counted per chunk first (in parallel), a prefix sum then tells every chunk which
+     * record its first line is, and the chunks parse in parallel: vertices straight into the mesh, triangles into
+     * per chunk lists that are concatenated in order.
+     */
+    static bool parsePlyAscii(const std::string &text, const PlyHeader &header, Mesh &mesh, ThreadPool &pool) {
+        std::vector<Span> spans = splitLines(text.data() + header.bodyOffset, text.data() + text.size(), pool);
+        std::vector<size_t> lines(spans.size() + 1, 0);
+        pool.parallelFor(spans.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t c = begin; c < end; ++c)
+                for (const char *p = spans[c].begin; p < spans[c].end; p = lineEnd(p, spans[c].end) + 1)
+                    lines[c + 1]++;
+        });
+        for (size_t c = 0; c < spans.size(); ++c)
+            lines[c + 1] += lines[c];
+
+        // records [elementBegin[e], elementBegin[e + 1]) belong to element e
+        std::vector<size_t> elementBegin(1, 0);
+        for (const PlyElement &element : header.elements)
+            elementBegin.push_back(elementBegin.back() + element.count);
+        if (lines[spans.size()] < elementBegin.back())
+            return plyTruncated();
+
+        std::vector<std::vector<unsigned int>> triangles(spans.size());
+        std::vector<size_t> errorLine(spans.size(), 0);
+        pool.parallelFor(spans.size(), [&](size_t begin, size_t end, unsigned) {
+            std::vector<unsigned int> polygon;
+            for (size_t c = begin; c < end; ++c) {
+                size_t record = lines[c];
+                size_t e = std::upper_bound(elementBegin.begin(), elementBegin.end(), record) - elementBegin.begin() - 1;
+                for (const char *p = spans[c].begin; p < spans[c].end && e < header.elements.size(); ++record) {
+                    const char *stop = lineEnd(p, spans[c].end);
+                    while (e < header.elements.size() && record >= elementBegin[e + 1])
+                        e++;
+                    if (e < header.elements.size() && !parsePlyAsciiRecord(header.elements[e], record - elementBegin[e],
+                                                                           p, stop, mesh, triangles[c], polygon)) {
+                        errorLine[c] = record - lines[c] + 1;
+                        break;
+                    }
+                    p = stop + 1;
+                }
+            }
+        });
+        size_t bodyLine = std::count(text.begin(), text.begin() + header.bodyOffset, '\n');
+        for (size_t c = 0; c < spans.size(); ++c) {
+            if (errorLine[c]) {
+                std::cout << "ERROR::MESH::PLY_BAD_RECORD line " << bodyLine + lines[c] + errorLine[c] << std::endl;
+                return false;
+            }
+        }
+
+        std::vector<size_t> offsets(spans.size() + 1, 0);
+        for (size_t c = 0; c < spans.size(); ++c)
+            offsets[c + 1] = offsets[c] + triangles[c].size();
+        mesh.indices.resize(offsets[spans.size()]);
+        pool.parallelFor(spans.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t c = begin; c < end; ++c)
+                std::copy(triangles[c].begin(), triangles[c].end(), mesh.indices.begin() + offsets[c]);
+        });
+        return true;
+    }
+
+    static bool parsePlyAsciiRecord(const PlyElement &element, size_t index, const char *p, const char *end,
+                                    Mesh &mesh, std::vector<unsigned int> &triangles,
+                                    std::vector<unsigned int> &polygon) {
+        bool vertex = element.name == "vertex", face = element.name == "face";
+        if (!vertex && !face)
+            return true;
+        for (int i = 0; i < int(element.properties.size()); ++i) {
+            const PlyProperty &property = element.properties[i];
+            if (property.countType == NONE_TYPE) {
+                float value;
+                if (!(p = parseFloat(p, end, value)))
+                    return false;
+                if (vertex) {
+                    for (int s = 0; s < 8; ++s)
+                        if (element.slot[s] == i)
+                            plyStore(mesh, index, s, value);
+                }
+                continue;
+            }
+            size_t n;
+            if (!(p = parseInt(p, end, n)))
+                return false;
+            polygon.clear();
+            for (size_t k = 0; k < n; ++k) {
+                unsigned int value;
+                if (!(p = parseInt(p, end, value)))
+                    return false;
+                polygon.push_back(value);
+            }
+            if (i == element.indexList) {
+                for (size_t k = 2; k < polygon.size(); ++k) {
+                    triangles.push_back(polygon[0]);
+                    triangles.push_back(polygon[k - 1]);
+                    triangles.push_back(polygon[k]);
+                }
+            }
+        }
+        return true;
+    }
+};
+
+#endif //OPENGL_REVIEW_MESHIMPORTER_H
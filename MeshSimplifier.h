@@ -0,0 +1,258 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESHSIMPLIFIER_H
+#define OPENGL_REVIEW_MESHSIMPLIFIER_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Mesh.h"
+
+/*
+ * Quadric error (Garland & Heckbert) edge collapse, run offline to build LOD chains (tools/mesh_convert).
+ *  > every vertex gets the area weighted sum of the plane quadrics of its triangles; collapsing u into v costs u's
+ *    quadric evaluated at v, i.e. the mean squared distance of v from u's planes
+ *  > collapses are endpoint collapses (u's corners move onto v), so every level indexes the original vertex buffer
+ *    and a LOD is just another range of the index buffer
+ *  > vertices on an attribute seam (same position, different uv/normal) or an open border never move, collapses that
+ *    would flip a triangle are skipped
+ * Each pass sorts the candidate edges by cost and takes the cheapest ones that don't touch each other, until the
+ * triangle target or the error limit is reached.
+ */
+class MeshSimplifier {
+public:
+    // triangles of indices (into mesh's vertices) reduced to about targetTriangles; error gets the object space error
+    static std::vector<uint32_t> simplify(const Mesh &mesh, const std::vector<uint32_t> &indices,
+                                          size_t targetTriangles, float maxError = FLT_MAX, float *error = nullptr) {
+        MeshSimplifier simplifier(mesh, indices);
+        simplifier.run(targetTriangles * 3, maxError);
+        if (error)
+            *error = simplifier.error;
+        return simplifier.indices;
+    }
+
+    /*
+     * Level 0 is the mesh itself, every next level has about ratio times the triangles of the one before. The chain
+     * stops early when a level doesn't get at least 10% smaller (locked seams, or the error limit).
+     * Errors add up along the chain, since each level is simplified from the previous one.
+     */
+    static LodChain lodChain(const Mesh &mesh, int maxLevels = 4, float ratio = 0.5f, float maxError = FLT_MAX) {
+        LodChain chain;
+        std::vector<uint32_t> level = mesh.indices;
+        if (level.empty())
+            for (uint32_t i = 0; i < mesh.positions.size(); ++i)
+                level.push_back(i);
+        float error = 0.0f;
+        for (int i = 0; i < maxLevels; ++i) {
+            chain.levels.push_back({uint32_t(chain.indices.size()), uint32_t(level.size()), error});
+            chain.indices.insert(chain.indices.end(), level.begin(), level.end());
+
+            float levelError = 0.0f;
+            std::vector<uint32_t> next = simplify(mesh, level, size_t(level.size() / 3 * ratio), maxError, &levelError);
+            if (next.empty() || next.size() > level.size() * 9 / 10)
+                break;
+            error += levelError;
+            level = std::move(next);
+        }
+        return chain;
+    }
+
+private:
+    // symmetric 4x4 matrix as its upper triangle: xx xy xz xw yy yz yw zz zw ww
+    struct Quadric {
+        double m[10] = {};
+        double weight = 0.0;
+
+        static Quadric plane(const glm::vec3 &n, double d, double w) {
+            Quadric q;
+            double a = n.x, b = n.y, c = n.z;
+            double values[10] = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+            for (int i = 0; i < 10; ++i)
+                q.m[i] = values[i] * w;
+            q.weight = w;
+            return q;
+        }
+        void add(const Quadric &other) {
+            for (int i = 0; i < 10; ++i)
+                m[i] += other.m[i];
+            weight += other.weight;
+        }
+        // mean squared distance of p from the planes
+        double evaluate(const glm::vec3 &p) const {
+            double x = p.x, y = p.y, z = p.z;
+            double sum = m[0] * x * x + 2 * m[1] * x * y + 2 * m[2] * x * z + 2 * m[3] * x
+                       + m[4] * y * y + 2 * m[5] * y * z + 2 * m[6] * y
+                       + m[7] * z * z + 2 * m[8] * z
+                       + m[9];
+            return weight > 0.0 ? std::max(sum, 0.0) / weight : 0.0;
+        }
+    };
+
+    struct Collapse {
+        uint32_t from, to;
+        double cost;
+    };
+
+    const std::vector<glm::vec3> &positions;
+    std::vector<uint32_t> indices;
+    std::vector<Quadric> quadrics;
+    std::vector<uint8_t> locked;
+    std::vector<uint32_t> remap;
+    float error = 0.0f;
+
+    MeshSimplifier(const Mesh &mesh, const std::vector<uint32_t> &indices)
+            : positions(mesh.positions), indices(indices), quadrics(mesh.positions.size()),
+              locked(mesh.positions.size(), 0), remap(mesh.positions.size()) {
+        for (uint32_t v = 0; v < remap.size(); ++v)
+            remap[v] = v;
+        lockSeamsAndBorders();
+        for (size_t t = 0; t < this->indices.size(); t += 3) {
+            uint32_t a = this->indices[t], b = this->indices[t + 1], c = this->indices[t + 2];
+            glm::vec3 normal = glm::cross(positions[b] - positions[a], positions[c] - positions[a]);
+            float length = glm::length(normal);
+            if (length <= 0.0f)
+                continue;
+            normal /= length;
+            Quadric q = Quadric::plane(normal, -glm::dot(normal, positions[a]), 0.5 * length);
+            quadrics[a].add(q);
+            quadrics[b].add(q);
+            quadrics[c].add(q);
+        }
+    }
+
+    void lockSeamsAndBorders() {
+        // vertices sharing a position: the first one stands for all of them
+        struct PositionHash {
+            size_t operator()(const std::array<uint32_t, 3> &key) const {
+                return (size_t(key[0]) * 73856093u) ^ (size_t(key[1]) * 19349663u) ^ (size_t(key[2]) * 83492791u);
+            }
+        };
+        std::unordered_map<std::array<uint32_t, 3>, uint32_t, PositionHash> byPosition;
+        std::vector<uint32_t> position(positions.size());
+        std::vector<uint8_t> used(positions.size(), 0);
+        for (uint32_t index : indices)
+            used[index] = 1;
+        for (uint32_t v = 0; v < positions.size(); ++v) {
+            if (!used[v])
+                continue;
+            std::array<uint32_t, 3> key;
+            memcpy(key.data(), &positions[v].x, sizeof(key));
+            auto inserted = byPosition.emplace(key, v);
+            position[v] = inserted.first->second;
+            if (!inserted.second)
+                locked[v] = locked[inserted.first->second] = 1;
+        }
+        // a directed edge without its reverse is on a border
+        std::unordered_set<uint64_t> edges;
+        auto edge = [&](uint32_t a, uint32_t b) { return uint64_t(position[a]) << 32 | position[b]; };
+        for (size_t t = 0; t < indices.size(); t += 3)
+            for (int k = 0; k < 3; ++k)
+                edges.insert(edge(indices[t + k], indices[t + (k + 1) % 3]));
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            for (int k = 0; k < 3; ++k) {
+                uint32_t a = indices[t + k], b = indices[t + (k + 1) % 3];
+                if (!edges.count(edge(b, a)))
+                    locked[a] = locked[b] = 1;
+            }
+        }
+    }
+
+    void run(size_t targetIndices, float maxError) {
+        double maxCost = double(maxError) * maxError;
+        std::vector<uint32_t> triangleStart, triangleList;
+        std::vector<uint8_t> touched;
+        while (indices.size() > targetIndices) {
+            // vertex -> triangles, rebuilt every pass
+            triangleStart.assign(positions.size() + 1, 0);
+            for (uint32_t index : indices)
+                triangleStart[index + 1]++;
+            for (size_t v = 0; v < positions.size(); ++v)
+                triangleStart[v + 1] += triangleStart[v];
+            triangleList.resize(indices.size());
+            std::vector<uint32_t> fill(triangleStart.begin(), triangleStart.end() - 1);
+            for (size_t i = 0; i < indices.size(); ++i)
+                triangleList[fill[indices[i]]++] = uint32_t(i / 3);
+
+            std::vector<Collapse> collapses;
+            for (size_t t = 0; t < indices.size(); t += 3) {
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t a = indices[t + k], b = indices[t + (k + 1) % 3];
+                    if (!locked[a])
+                        collapses.push_back({a, b, quadrics[a].evaluate(positions[b])});
+                    if (!locked[b])
+                        collapses.push_back({b, a, quadrics[b].evaluate(positions[a])});
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(),
+                      [](const Collapse &x, const Collapse &y) { return x.cost < y.cost; });
+
+            touched.assign(positions.size(), 0);
+            size_t triangles = indices.size() / 3, removed = 0, collapsed = 0;
+            for (const Collapse &c : collapses) {
+                if (c.cost > maxCost || triangles - removed <= targetIndices / 3)
+                    break;
+                if (touched[c.from] || touched[c.to] || flips(c.from, c.to, triangleStart, triangleList))
+                    continue;
+                remap[c.from] = c.to;
+                quadrics[c.to].add(quadrics[c.from]);
+                error = std::max(error, float(std::sqrt(c.cost)));
+                collapsed++;
+                // everything around from changes shape this pass, so none of it collapses again until the next
+                for (uint32_t i = triangleStart[c.from]; i < triangleStart[c.from + 1]; ++i) {
+                    const uint32_t *triangle = &indices[triangleList[i] * 3];
+                    bool shared = false;
+                    for (int k = 0; k < 3; ++k) {
+                        touched[triangle[k]] = 1;
+                        shared = shared || triangle[k] == c.to;
+                    }
+                    removed += shared;
+                }
+            }
+            if (collapsed == 0)
+                break;
+
+            size_t out = 0;
+            for (size_t t = 0; t < indices.size(); t += 3) {
+                uint32_t a = remap[indices[t]], b = remap[indices[t + 1]], c = remap[indices[t + 2]];
+                if (a != b && b != c && c != a) {
+                    indices[out++] = a;
+                    indices[out++] = b;
+                    indices[out++] = c;
+                }
+            }
+            indices.resize(out);
+        }
+    }
+
+    // moving from onto to turns one of from's remaining triangles over (or flat)
+    bool flips(uint32_t from, uint32_t to, const std::vector<uint32_t> &triangleStart,
+               const std::vector<uint32_t> &triangleList) const {
+        for (uint32_t i = triangleStart[from]; i < triangleStart[from + 1]; ++i) {
+            const uint32_t *triangle = &indices[triangleList[i] * 3];
+            if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                continue;
+            glm::vec3 before[3], after[3];
+            for (int k = 0; k < 3; ++k) {
+                before[k] = positions[triangle[k]];
+                after[k] = triangle[k] == from ? positions[to] : before[k];
+            }
+            glm::vec3 n0 = glm::cross(before[1] - before[0], before[2] - before[0]);
+            glm::vec3 n1 = glm::cross(after[1] - after[0], after[2] - after[0]);
+            if (glm::dot(n0, n1) <= 0.0f)
+                return true;
+        }
+        return false;
+    }
+};
+
+#endif //OPENGL_REVIEW_MESHSIMPLIFIER_H
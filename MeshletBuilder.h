@@ -0,0 +1,165 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESHLETBUILDER_H
+#define OPENGL_REVIEW_MESHLETBUILDER_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Mesh.h"
+
+/*
+ * Splits a triangle list into meshlets (Mesh.h) of at most maxVertices vertices and maxTriangles triangles, for
+ * MeshletCuller. Run offline by tools/mesh_convert, the result is stored in the mesh file.
+ *  > meshlets grow greedily from a seed triangle: next is the neighbouring triangle that adds the fewest new
+ *    vertices, so clusters come out compact and their bounds tight
+ *  > when nothing neighbours the meshlet any more, or the next triangle doesn't fit, a new one starts
+ * 64 / 124 keeps the local triangle list under 384 bytes and is what mesh shading hardware likes too.
+ */
+class MeshletBuilder {
+public:
+    static MeshletData build(const Mesh &mesh, const std::vector<uint32_t> &indices, size_t maxVertices = 64,
+                             size_t maxTriangles = 124) {
+        maxVertices = std::min<size_t>(std::max<size_t>(maxVertices, 3), 256); // local indices are bytes
+        maxTriangles = std::max<size_t>(maxTriangles, 1);
+        size_t triangleCount = indices.size() / 3;
+
+        // vertex -> triangles
+        std::vector<uint32_t> triangleStart(mesh.positions.size() + 1, 0), triangleList(triangleCount * 3);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            triangleStart[indices[i] + 1]++;
+        for (size_t v = 0; v < mesh.positions.size(); ++v)
+            triangleStart[v + 1] += triangleStart[v];
+        std::vector<uint32_t> fill(triangleStart.begin(), triangleStart.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            triangleList[fill[indices[i]]++] = uint32_t(i / 3);
+
+        MeshletData data;
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        std::vector<int> local(mesh.positions.size(), -1); // vertex -> slot in the current meshlet
+        std::vector<uint32_t> candidates;
+        Meshlet current = {};
+        size_t nextSeed = 0;
+
+        auto newVertices = [&](size_t t) {
+            int count = 0;
+            for (int k = 0; k < 3; ++k)
+                count += local[indices[t * 3 + k]] < 0;
+            return count;
+        };
+        auto flush = [&]() {
+            if (current.triangleCount == 0)
+                return;
+            computeBounds(mesh, data, current);
+            data.meshlets.push_back(current);
+            for (uint32_t i = 0; i < current.vertexCount; ++i)
+                local[data.vertices[current.vertexOffset + i]] = -1;
+            current = {};
+            current.vertexOffset = uint32_t(data.vertices.size());
+            current.triangleOffset = uint32_t(data.triangles.size());
+            candidates.clear();
+        };
+
+        for (size_t added = 0; added < triangleCount; ++added) {
+            // best neighbour, dropping the ones that got emitted meanwhile
+            size_t best = triangleCount;
+            int bestScore = 4;
+            size_t kept = 0;
+            for (uint32_t t : candidates) {
+                if (emitted[t])
+                    continue;
+                candidates[kept++] = t;
+                int score = newVertices(t);
+                if (score < bestScore || (score == bestScore && t < best)) {
+                    best = t;
+                    bestScore = score;
+                }
+            }
+            candidates.resize(kept);
+            if (best == triangleCount) {
+                // nothing connected left: start over at the first triangle not taken yet
+                flush();
+                while (emitted[nextSeed])
+                    nextSeed++;
+                best = nextSeed;
+            } else if (current.vertexCount + bestScore > maxVertices || current.triangleCount + 1 > maxTriangles) {
+                // full: the neighbour seeds the next meshlet
+                flush();
+            }
+
+            emitted[best] = 1;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = indices[best * 3 + k];
+                if (local[v] < 0) {
+                    local[v] = int(current.vertexCount++);
+                    data.vertices.push_back(v);
+                    for (uint32_t i = triangleStart[v]; i < triangleStart[v + 1]; ++i)
+                        if (!emitted[triangleList[i]])
+                            candidates.push_back(triangleList[i]);
+                }
+                data.triangles.push_back(uint8_t(local[v]));
+            }
+            current.triangleCount++;
+        }
+        flush();
+        return data;
+    }
+
+private:
+    /*
+     * Sphere around the meshlet's box, and the cone around its triangle normals. The cone is stored the way the
+     * culling test uses it: coneCutoff = sin(half angle), or 2 when the normals spread over a half space or more and
+     * the meshlet can't be backfacing as a whole.
+     */
+    static void computeBounds(const Mesh &mesh, const MeshletData &data, Meshlet &meshlet) {
+        glm::vec3 min = mesh.positions[data.vertices[meshlet.vertexOffset]], max = min;
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+            const glm::vec3 &p = mesh.positions[data.vertices[meshlet.vertexOffset + i]];
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+        glm::vec3 center = (min + max) * 0.5f;
+        float radius = 0.0f;
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+            radius = std::max(radius, glm::length(mesh.positions[data.vertices[meshlet.vertexOffset + i]] - center));
+
+        std::vector<glm::vec3> normals;
+        glm::vec3 axis(0.0f);
+        for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+            const uint8_t *triangle = &data.triangles[meshlet.triangleOffset + t * 3];
+            glm::vec3 a = mesh.positions[data.vertices[meshlet.vertexOffset + triangle[0]]];
+            glm::vec3 b = mesh.positions[data.vertices[meshlet.vertexOffset + triangle[1]]];
+            glm::vec3 c = mesh.positions[data.vertices[meshlet.vertexOffset + triangle[2]]];
+            glm::vec3 n = glm::cross(b - a, c - a);
+            float length = glm::length(n);
+            if (length <= 0.0f)
+                continue;
+            normals.push_back(n / length);
+            axis += n / length;
+        }
+        float cutoff = 2.0f;
+        float axisLength = glm::length(axis);
+        if (axisLength > 0.0f) {
+            axis /= axisLength;
+            float minDot = 1.0f;
+            for (const glm::vec3 &n : normals)
+                minDot = std::min(minDot, glm::dot(axis, n));
+            if (minDot > 0.0f)
+                cutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            meshlet.center[k] = center[k];
+            meshlet.coneAxis[k] = axis[k];
+        }
+        meshlet.radius = radius;
+        meshlet.coneCutoff = cutoff;
+    }
+};
+
+#endif //OPENGL_REVIEW_MESHLETBUILDER_H
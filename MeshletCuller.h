@@ -0,0 +1,123 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_MESHLETCULLER_H
+#define OPENGL_REVIEW_MESHLETCULLER_H
+
+#include <glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "Frustum.h"
+#include "GLObjects.h"
+#include "Mesh.h"
+#include "ThreadPool.h"
+
+/*
+ * Per meshlet culling on the CPU, for meshes too big to cull as a whole.
+ *  > frustum: the meshlet's sphere against the six planes of projection * view * model (in object space, so nothing
+ *    gets transformed per meshlet)
+ *  > backface: the sphere and normal cone against the camera position, a meshlet goes when every triangle in it faces
+ *    away (conservative, exact enough under rotation and uniform scale)
+ * The survivors' triangles are written out as one compacted uint32 index list and streamed into elementBuffer.
+ * Usage: make a VAO for the mesh's vertex buffer with createBuffer() as its element buffer, then per object and frame
+ * cull(), bind that VAO and draw(). Only for meshes where worthwhile() says so: below that, the index upload per object
+ * costs more than drawing the culled triangles would.
+ */
+class MeshletCuller {
+public:
+    struct Stats {
+        size_t visible = 0, frustumCulled = 0, backfaceCulled = 0;
+        size_t triangles = 0;
+    } stats;
+
+    std::vector<uint32_t> indices; // of the last cull(), into the mesh's vertices
+    GLBuffer elementBuffer;
+
+    // several meshlets and a few full ones' worth of triangles, otherwise draw the whole mesh
+    static constexpr size_t MIN_TRIANGLES = 512;
+    static bool worthwhile(const MeshletData &data) {
+        return data.meshlets.size() > 1 && data.triangles.size() / 3 >= MIN_TRIANGLES;
+    }
+
+    unsigned int createBuffer() {
+        if (!elementBuffer)
+            elementBuffer = GLBuffer::create();
+        return elementBuffer.id();
+    }
+    void deleteBuffer() {
+        elementBuffer.reset();
+    }
+
+    // returns the number of visible triangles
+    size_t cull(const MeshletData &data, const glm::mat4 &model, const glm::mat4 &view, const glm::mat4 &projection,
+                ThreadPool &pool = ThreadPool::shared()) {
+        Frustum frustum = Frustum::fromMatrix(projection * view * model);
+        glm::vec4 camera = glm::inverse(view * model) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        glm::vec3 eye = glm::vec3(camera) / camera.w;
+
+        size_t count = data.meshlets.size();
+        state.resize(count);
+        pool.parallelFor(count, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i)
+                state[i] = test(data.meshlets[i], frustum, eye);
+        }, 256);
+
+        offsets.resize(count + 1);
+        offsets[0] = 0;
+        stats = Stats();
+        for (size_t i = 0; i < count; ++i) {
+            offsets[i + 1] = offsets[i] + (state[i] == VISIBLE ? data.meshlets[i].triangleCount * 3 : 0);
+            stats.visible += state[i] == VISIBLE;
+            stats.frustumCulled += state[i] == OUTSIDE;
+            stats.backfaceCulled += state[i] == BACKFACING;
+        }
+        indices.resize(offsets[count]);
+        pool.parallelFor(count, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) {
+                if (state[i] != VISIBLE)
+                    continue;
+                const Meshlet &meshlet = data.meshlets[i];
+                const uint32_t *vertices = &data.vertices[meshlet.vertexOffset];
+                const uint8_t *triangles = &data.triangles[meshlet.triangleOffset];
+                uint32_t *out = &indices[offsets[i]];
+                for (uint32_t k = 0; k < meshlet.triangleCount * 3; ++k)
+                    out[k] = vertices[triangles[k]];
+            }
+        }, 256);
+        stats.triangles = indices.size() / 3;
+
+        // the copy target leaves whatever VAO is bound alone; orphaned every time, so no waiting on last frame's draw
+        glBindBuffer(GL_COPY_WRITE_BUFFER, createBuffer());
+        glBufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        return stats.triangles;
+    }
+
+    // the VAO holding elementBuffer has to be bound
+    void draw() const {
+        if (!indices.empty())
+            glDrawElements(GL_TRIANGLES, GLsizei(indices.size()), GL_UNSIGNED_INT, 0);
+    }
+
+private:
+    enum State : uint8_t { VISIBLE, OUTSIDE, BACKFACING };
+    std::vector<State> state;
+    std::vector<size_t> offsets;
+
+    static State test(const Meshlet &meshlet, const Frustum &frustum, const glm::vec3 &eye) {
+        glm::vec3 center(meshlet.center[0], meshlet.center[1], meshlet.center[2]);
+        if (frustum.sphereOutside(center, meshlet.radius))
+            return OUTSIDE;
+        // every normal in the cone points away from every point in the sphere
+        glm::vec3 axis(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]);
+        glm::vec3 toCenter = center - eye;
+        if (glm::dot(toCenter, axis) >= meshlet.coneCutoff * glm::length(toCenter) + meshlet.radius)
+            return BACKFACING;
+        return VISIBLE;
+    }
+};
+
+#endif //OPENGL_REVIEW_MESHLETCULLER_H
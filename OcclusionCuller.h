@@ -0,0 +1,319 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_OCCLUSIONCULLER_H
+#define OPENGL_REVIEW_OCCLUSIONCULLER_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OCCLUSION_SSE2 1
+#endif
+
+#include "Mesh.h"
+#include "ThreadPool.h"
+
+/*
+ * Software occlusion culling: a few big occluders are rasterized into a small depth buffer on the CPU, a Hi-Z pyramid
+ * is built from it, and objects whose bounds are behind it are never submitted.
+ *  > depth is z/w of the projection the demos already use (0 near .. 1 far), each pixel keeps the nearest occluder
+ *  > rasterize(): occluder triangles are transformed, backface culled and binned into 32x32 pixel tiles by all
+ *    workers at once (per worker bins, no locks), then tiles are filled in parallel, 4 pixels at a time with SSE2
+ *    (scalar elsewhere); then every pyramid level keeps the farthest depth of the 2x2 texels below it
+ *  > visible(): the projected box's nearest depth against the farthest depth under its screen rectangle, read from
+ *    the level where the rectangle covers at most 2x2 texels
+ * Occluders are sampled at pixel centers and triangles crossing the near plane are left out; occludees crossing the
+ * near plane are always visible.
+ * Usage per frame: clear(), addOccluder()/addBox() for the occluders, rasterize(), then visible() per object.
+ */
+class OcclusionCuller {
+public:
+    static constexpr int TILE_SIZE = 32;
+
+    struct Stats {
+        size_t occluderTriangles = 0, rasterizedTriangles = 0;
+        size_t tested = 0, occluded = 0;
+    };
+
+    // width and height are rounded up to whole tiles
+    explicit OcclusionCuller(int width = 256, int height = 128)
+            : width((std::max(width, 1) + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE),
+              height((std::max(height, 1) + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE),
+              tilesX(this->width / TILE_SIZE), tilesY(this->height / TILE_SIZE) {
+        int w = this->width, h = this->height;
+        while (true) {
+            levels.push_back({w, h, std::vector<float>(size_t(w) * h, 1.0f)});
+            if (w == 1 && h == 1)
+                break;
+            w = std::max(1, (w + 1) / 2);
+            h = std::max(1, (h + 1) / 2);
+        }
+    }
+
+    void clear() {
+        occluders.clear();
+        boxCorners.clear();
+        counters = Stats();
+    }
+
+    // positions and indices must stay alive until rasterize(); mvp = projection * view * model
+    void addOccluder(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices,
+                     const glm::mat4 &mvp) {
+        occluders.push_back({positions.data(), NO_BOX, indices.data(), indices.size(), mvp});
+    }
+
+    // a box that's solid all the way through (a cube, a building block); model may rotate and scale it
+    void addBox(const Mesh::Bounds &bounds, const glm::mat4 &mvp) {
+        uint32_t box = uint32_t(boxCorners.size() / 8);
+        for (int i = 0; i < 8; ++i)
+            boxCorners.push_back(glm::vec3(i & 1 ? bounds.max.x : bounds.min.x, i & 2 ? bounds.max.y : bounds.min.y,
+                                           i & 4 ? bounds.max.z : bounds.min.z));
+        occluders.push_back({nullptr, box, boxIndices().data(), boxIndices().size(), mvp});
+    }
+
+    void rasterize(ThreadPool &pool = ThreadPool::shared()) {
+        std::vector<float> &depth = levels[0].depth;
+        std::fill(depth.begin(), depth.end(), 1.0f);
+
+        // boxCorners doesn't move any more, point the boxes at their corners
+        for (Occluder &occluder : occluders)
+            if (occluder.box != NO_BOX)
+                occluder.positions = &boxCorners[size_t(occluder.box) * 8];
+
+        // every occluder triangle gets a slot, so workers can set them up without talking to each other
+        firstTriangle.assign(occluders.size() + 1, 0);
+        for (size_t o = 0; o < occluders.size(); ++o)
+            firstTriangle[o + 1] = firstTriangle[o] + occluders[o].indexCount / 3;
+        size_t triangleCount = firstTriangle.back();
+        triangles.resize(triangleCount);
+        bins.resize(pool.size());
+        for (std::vector<std::vector<uint32_t>> &workerBins : bins) {
+            workerBins.resize(tilesX * tilesY);
+            for (std::vector<uint32_t> &bin : workerBins)
+                bin.clear();
+        }
+
+        binned.assign(pool.size(), 0);
+        pool.parallelFor(triangleCount, [&](size_t begin, size_t end, unsigned worker) {
+            size_t o = size_t(std::upper_bound(firstTriangle.begin(), firstTriangle.end(), begin) -
+                              firstTriangle.begin()) - 1;
+            for (size_t t = begin; t < end; ++t) {
+                while (t >= firstTriangle[o + 1])
+                    o++;
+                const Occluder &occluder = occluders[o];
+                const uint32_t *index = &occluder.indices[(t - firstTriangle[o]) * 3];
+                if (!setup(occluder, index, triangles[t]))
+                    continue;
+                binned[worker]++;
+                const Triangle &triangle = triangles[t];
+                for (int ty = triangle.minY / TILE_SIZE; ty <= (triangle.maxY - 1) / TILE_SIZE; ++ty)
+                    for (int tx = triangle.minX / TILE_SIZE; tx <= (triangle.maxX - 1) / TILE_SIZE; ++tx)
+                        bins[worker][ty * tilesX + tx].push_back(uint32_t(t));
+            }
+        }, 64);
+
+        pool.parallelFor(size_t(tilesX) * tilesY, [&](size_t begin, size_t end, unsigned) {
+            for (size_t tile = begin; tile < end; ++tile)
+                for (const std::vector<std::vector<uint32_t>> &workerBins : bins)
+                    for (uint32_t t : workerBins[tile])
+                        rasterizeTile(triangles[t], int(tile % tilesX), int(tile / tilesX));
+        });
+
+        for (size_t l = 1; l < levels.size(); ++l)
+            downsample(levels[l - 1], levels[l]);
+
+        counters.occluderTriangles = triangleCount;
+        for (size_t n : binned)
+            counters.rasterizedTriangles += n;
+        occluders.clear();
+        boxCorners.clear();
+    }
+
+    // false when the box (object space, moved by mvp = projection * view * model) is hidden behind the occluders
+    bool visible(const Mesh::Bounds &bounds, const glm::mat4 &mvp) {
+        counters.tested++;
+        float minX = float(width), minY = float(height), maxX = 0.0f, maxY = 0.0f, nearest = 2.0f;
+        for (int i = 0; i < 8; ++i) {
+            glm::vec4 clip = mvp * glm::vec4(i & 1 ? bounds.max.x : bounds.min.x, i & 2 ? bounds.max.y : bounds.min.y,
+                                             i & 4 ? bounds.max.z : bounds.min.z, 1.0f);
+            if (clip.w <= NEAR_W)
+                return true;
+            glm::vec3 screen = toScreen(clip);
+            minX = std::min(minX, screen.x);
+            maxX = std::max(maxX, screen.x);
+            minY = std::min(minY, screen.y);
+            maxY = std::max(maxY, screen.y);
+            nearest = std::min(nearest, screen.z);
+        }
+        if (maxX < 0.0f || maxY < 0.0f || minX >= width || minY >= height || nearest > 1.0f)
+            return true; // outside the screen is the frustum test's business
+        int x0 = std::max(0, int(minX)), y0 = std::max(0, int(minY));
+        int x1 = std::min(width - 1, int(maxX)), y1 = std::min(height - 1, int(maxY));
+
+        size_t level = 0;
+        while (level + 1 < levels.size() && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+            level++;
+        const Level &hiZ = levels[level];
+        float farthest = 0.0f;
+        for (int y = y0 >> level; y <= (y1 >> level); ++y)
+            for (int x = x0 >> level; x <= (x1 >> level); ++x)
+                farthest = std::max(farthest, hiZ.depth[size_t(y) * hiZ.width + x]);
+        if (nearest <= farthest)
+            return true;
+        counters.occluded++;
+        return false;
+    }
+
+    const Stats &stats() const {
+        return counters;
+    }
+    int bufferWidth() const {
+        return width;
+    }
+    int bufferHeight() const {
+        return height;
+    }
+    // level 0 is the rasterized buffer, row major, bottom row first
+    const std::vector<float> &depth(size_t level = 0) const {
+        return levels[level].depth;
+    }
+
+private:
+    static constexpr float NEAR_W = 1e-4f;
+
+    static constexpr uint32_t NO_BOX = 0xFFFFFFFFu;
+
+    struct Occluder {
+        const glm::vec3 *positions; // set by rasterize() for boxes
+        uint32_t box;               // addBox(): corners box * 8 .. box * 8 + 7 of boxCorners
+        const uint32_t *indices;
+        size_t indexCount;
+        glm::mat4 mvp;
+    };
+    // screen space triangle: edge functions a * x + b * y + c (>= 0 inside) and depth plane z = a * x + b * y + c
+    struct Triangle {
+        float edgeA[3], edgeB[3], edgeC[3];
+        float depthA, depthB, depthC;
+        int minX, minY, maxX, maxY; // pixel rectangle, max exclusive
+    };
+    struct Level {
+        int width, height;
+        std::vector<float> depth;
+    };
+
+    int width, height, tilesX, tilesY;
+    std::vector<Level> levels;
+    std::vector<Occluder> occluders;
+    std::vector<glm::vec3> boxCorners; // of this frame's addBox() calls, 8 each
+    std::vector<Triangle> triangles;
+    std::vector<size_t> firstTriangle, binned; // rasterize()'s: per occluder, per worker
+    std::vector<std::vector<std::vector<uint32_t>>> bins; // worker -> tile -> triangles
+    Stats counters;
+
+    static const std::vector<uint32_t> &boxIndices() {
+        // corner i has x from bit 0, y from bit 1, z from bit 2; outward counter clockwise faces
+        static const std::vector<uint32_t> indices = {
+                0, 2, 3, 0, 3, 1,  4, 5, 7, 4, 7, 6,  0, 4, 6, 0, 6, 2,
+                1, 3, 7, 1, 7, 5,  0, 1, 5, 0, 5, 4,  2, 6, 7, 2, 7, 3};
+        return indices;
+    }
+
+    glm::vec3 toScreen(const glm::vec4 &clip) const {
+        return glm::vec3((clip.x / clip.w * 0.5f + 0.5f) * width, (clip.y / clip.w * 0.5f + 0.5f) * height,
+                         clip.z / clip.w * 0.5f + 0.5f);
+    }
+
+    bool setup(const Occluder &occluder, const uint32_t *index, Triangle &triangle) const {
+        glm::vec3 v[3];
+        for (int k = 0; k < 3; ++k) {
+            glm::vec4 clip = occluder.mvp * glm::vec4(occluder.positions[index[k]], 1.0f);
+            if (clip.w <= NEAR_W)
+                return false;
+            v[k] = toScreen(clip);
+        }
+        float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[2].x - v[0].x) * (v[1].y - v[0].y);
+        if (area <= 0.0f)
+            return false; // back facing or degenerate
+        triangle.minX = std::max(0, int(std::floor(std::min(v[0].x, std::min(v[1].x, v[2].x)))));
+        triangle.minY = std::max(0, int(std::floor(std::min(v[0].y, std::min(v[1].y, v[2].y)))));
+        triangle.maxX = std::min(width, int(std::ceil(std::max(v[0].x, std::max(v[1].x, v[2].x)))));
+        triangle.maxY = std::min(height, int(std::ceil(std::max(v[0].y, std::max(v[1].y, v[2].y)))));
+        if (triangle.minX >= triangle.maxX || triangle.minY >= triangle.maxY)
+            return false;
+        for (int k = 0; k < 3; ++k) {
+            const glm::vec3 &a = v[k], &b = v[(k + 1) % 3];
+            triangle.edgeA[k] = a.y - b.y;
+            triangle.edgeB[k] = b.x - a.x;
+            triangle.edgeC[k] = -(triangle.edgeA[k] * a.x + triangle.edgeB[k] * a.y);
+        }
+        // z over the screen from the plane through the three vertices
+        glm::vec3 normal = glm::cross(v[1] - v[0], v[2] - v[0]);
+        triangle.depthA = -normal.x / normal.z;
+        triangle.depthB = -normal.y / normal.z;
+        triangle.depthC = v[0].z - triangle.depthA * v[0].x - triangle.depthB * v[0].y;
+        return true;
+    }
+
+    void rasterizeTile(const Triangle &t, int tileX, int tileY) {
+        int x0 = std::max(t.minX, tileX * TILE_SIZE) & ~3, x1 = std::min(t.maxX, (tileX + 1) * TILE_SIZE);
+        int y0 = std::max(t.minY, tileY * TILE_SIZE), y1 = std::min(t.maxY, (tileY + 1) * TILE_SIZE);
+        std::vector<float> &depth = levels[0].depth;
+        for (int y = y0; y < y1; ++y) {
+            float py = y + 0.5f;
+            float *row = &depth[size_t(y) * width];
+#ifdef OCCLUSION_SSE2
+            const __m128 offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+            __m128 rowEdge[3], stepEdge[3];
+            for (int k = 0; k < 3; ++k) {
+                rowEdge[k] = _mm_set1_ps(t.edgeB[k] * py + t.edgeC[k]);
+                stepEdge[k] = _mm_set1_ps(t.edgeA[k]);
+            }
+            __m128 rowDepth = _mm_set1_ps(t.depthB * py + t.depthC), stepDepth = _mm_set1_ps(t.depthA);
+            for (int x = x0; x < x1; x += 4) {
+                __m128 px = _mm_add_ps(_mm_set1_ps(float(x)), offsets);
+                __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepEdge[0], px), rowEdge[0]), _mm_setzero_ps());
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepEdge[1], px), rowEdge[1]),
+                                                         _mm_setzero_ps()));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepEdge[2], px), rowEdge[2]),
+                                                         _mm_setzero_ps()));
+                if (_mm_movemask_ps(inside) == 0)
+                    continue;
+                __m128 z = _mm_add_ps(_mm_mul_ps(stepDepth, px), rowDepth);
+                __m128 stored = _mm_loadu_ps(row + x);
+                __m128 nearer = _mm_min_ps(stored, z);
+                _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, stored)));
+            }
+#else
+            for (int x = x0; x < x1; ++x) {
+                float px = x + 0.5f;
+                bool inside = true;
+                for (int k = 0; k < 3; ++k)
+                    inside = inside && t.edgeA[k] * px + t.edgeB[k] * py + t.edgeC[k] >= 0.0f;
+                if (inside)
+                    row[x] = std::min(row[x], t.depthA * px + t.depthB * py + t.depthC);
+            }
+#endif
+        }
+    }
+
+    // farthest of the (up to) 2x2 texels under each texel
+    static void downsample(const Level &from, Level &to) {
+        for (int y = 0; y < to.height; ++y) {
+            int y0 = y * 2, y1 = std::min(y * 2 + 1, from.height - 1);
+            for (int x = 0; x < to.width; ++x) {
+                int x0 = x * 2, x1 = std::min(x * 2 + 1, from.width - 1);
+                to.depth[size_t(y) * to.width + x] = std::max(
+                        std::max(from.depth[size_t(y0) * from.width + x0], from.depth[size_t(y0) * from.width + x1]),
+                        std::max(from.depth[size_t(y1) * from.width + x0], from.depth[size_t(y1) * from.width + x1]));
+            }
+        }
+    }
+};
+
+#endif //OPENGL_REVIEW_OCCLUSIONCULLER_H
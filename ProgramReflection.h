@@ -0,0 +1,163 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_PROGRAMREFLECTION_H
+#define OPENGL_REVIEW_PROGRAMREFLECTION_H
+
+#include <glad.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Everything a linked program exposes, queried once instead of asking the driver by name every frame.
+ *  > attributes: name, location, GLSL type
+ *  > uniforms:   name, location (-1 inside a block), type, array size, block index + offset for block members
+ *  > blocks:     uniform blocks with their binding and data size
+ * Lists are sorted by name ("[0]" is dropped from array names) so lookups are a binary search.
+ */
+struct ProgramReflection {
+    struct Attribute {
+        std::string name;
+        int location;
+        GLenum type;
+        int size;
+    };
+    struct Uniform {
+        std::string name;
+        int location;
+        GLenum type;
+        int size;
+        int block;  // index into blocks, -1 for default block uniforms
+        int offset; // byte offset inside the block
+    };
+    struct Block {
+        std::string name;
+        int binding;
+        int dataSize;
+    };
+
+    unsigned int program = 0;
+    std::vector<Attribute> attributes;
+    std::vector<Uniform> uniforms;
+    std::vector<Block> blocks;
+
+    static ProgramReflection reflect(unsigned int program) {
+        ProgramReflection reflection;
+        reflection.program = program;
+        if (program == 0)
+            return reflection;
+
+        int count = 0, maxLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+        glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+        std::vector<char> name(std::max(maxLength, 1));
+        for (int i = 0; i < count; ++i) {
+            int length = 0, size = 0;
+            GLenum type = 0;
+            glGetActiveAttrib(program, i, (GLsizei)name.size(), &length, &size, &type, name.data());
+            int location = glGetAttribLocation(program, name.data());
+            // built-ins like gl_VertexID are active but have no location
+            if (location >= 0)
+                reflection.attributes.push_back({baseName(name.data(), length), location, type, size});
+        }
+
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+        name.resize(std::max(maxLength, 1));
+        for (int i = 0; i < count; ++i) {
+            int length = 0, binding = 0, dataSize = 0;
+            glGetActiveUniformBlockName(program, i, (GLsizei)name.size(), &length, name.data());
+            glGetActiveUniformBlockiv(program, i, GL_UNIFORM_BLOCK_BINDING, &binding);
+            glGetActiveUniformBlockiv(program, i, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+            reflection.blocks.push_back({std::string(name.data(), length), binding, dataSize});
+        }
+
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        name.resize(std::max(maxLength, 1));
+        for (int i = 0; i < count; ++i) {
+            int length = 0, size = 0, block = -1, offset = -1;
+            GLenum type = 0;
+            GLuint index = i;
+            glGetActiveUniform(program, index, (GLsizei)name.size(), &length, &size, &type, name.data());
+            glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &block);
+            glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+            int location = block < 0 ? glGetUniformLocation(program, name.data()) : -1;
+            reflection.uniforms.push_back({baseName(name.data(), length), location, type, size, block, offset});
+        }
+
+        auto byName = [](const auto &a, const auto &b) { return a.name < b.name; };
+        std::sort(reflection.attributes.begin(), reflection.attributes.end(), byName);
+        std::sort(reflection.uniforms.begin(), reflection.uniforms.end(), byName);
+        // blocks stay in index order, Uniform::block points into them
+        return reflection;
+    }
+
+    const Attribute *attribute(std::string_view name) const {
+        return find(attributes, name);
+    }
+    const Uniform *uniform(std::string_view name) const {
+        return find(uniforms, name);
+    }
+    const Block *block(std::string_view name) const {
+        for (const Block &b : blocks)
+            if (b.name == name)
+                return &b;
+        return nullptr;
+    }
+
+    // float, int, unsigned int or double: what a vertex attribute of this GLSL type has to be fed with
+    static GLenum componentType(GLenum type) {
+        switch (type) {
+            case GL_INT: case GL_INT_VEC2: case GL_INT_VEC3: case GL_INT_VEC4:
+                return GL_INT;
+            case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2: case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4:
+                return GL_UNSIGNED_INT;
+            case GL_DOUBLE: case GL_DOUBLE_VEC2: case GL_DOUBLE_VEC3: case GL_DOUBLE_VEC4:
+                return GL_DOUBLE;
+            default:
+                return GL_FLOAT;
+        }
+    }
+    // components per location (a matN takes N locations of N components)
+    static int components(GLenum type) {
+        switch (type) {
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_DOUBLE_VEC2: case GL_FLOAT_MAT2:
+                return 2;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_DOUBLE_VEC3: case GL_FLOAT_MAT3:
+                return 3;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_DOUBLE_VEC4: case GL_FLOAT_MAT4:
+                return 4;
+            default:
+                return 1;
+        }
+    }
+    static int locations(GLenum type) {
+        switch (type) {
+            case GL_FLOAT_MAT2: return 2;
+            case GL_FLOAT_MAT3: return 3;
+            case GL_FLOAT_MAT4: return 4;
+            default: return 1;
+        }
+    }
+
+private:
+    static std::string baseName(const char *name, int length) {
+        std::string s(name, length);
+        if (s.size() > 3 && s.compare(s.size() - 3, 3, "[0]") == 0)
+            s.resize(s.size() - 3);
+        return s;
+    }
+
+    template <typename T>
+    static const T *find(const std::vector<T> &list, std::string_view name) {
+        auto it = std::lower_bound(list.begin(), list.end(), name,
+                                   [](const T &item, std::string_view key) { return item.name < key; });
+        return it != list.end() && it->name == name ? &*it : nullptr;
+    }
+};
+
+#endif //OPENGL_REVIEW_PROGRAMREFLECTION_H
@@ -0,0 +1,486 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_RENDERGRAPH_H
+#define OPENGL_REVIEW_RENDERGRAPH_H
+
+#include <glad.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GLObjects.h"
+
+/*
+ * Passes that say which textures they read and write, instead of hand managed FBOs.
+ *  > addPass(name, setup, execute): setup declares through the Builder (create / read / write / writeDepth), execute
+ *    does the GL work once the pass's framebuffer is bound and the viewport set
+ *  > compile(): orders passes so every read comes after the write it sees (declaration order breaks ties), culls the
+ *    passes nothing visible depends on (whatever writes the backbuffer, or is marked keep(), is visible), then gives
+ *    the transient textures GL textures
+ *  > aliasing: GL can't place two textures in one allocation, so transients alias the way GL allows: textures of the
+ *    same size and format whose lifetimes (first to last pass using them) don't overlap share one GL texture
+ *  > GL textures and framebuffers are kept from one compile() to the next and reused when they fit
+ * Build and compile once, execute() every frame; build again when the size or the set of passes changes.
+ * deleteObjects() before glfwTerminate.
+ */
+class RenderGraph {
+public:
+    using Resource = uint32_t;
+    static constexpr Resource NONE = 0xFFFFFFFFu;
+
+    struct TextureDesc {
+        int width = 0, height = 0;
+        GLenum internalFormat = GL_RGBA8;
+
+        bool operator==(const TextureDesc &other) const {
+            return width == other.width && height == other.height && internalFormat == other.internalFormat;
+        }
+    };
+
+    class Builder {
+    public:
+        Resource create(const std::string &name, const TextureDesc &desc) {
+            return graph.addResource(name, desc, false);
+        }
+        void read(Resource resource) {
+            graph.passes[pass].reads.push_back(resource);
+        }
+        // color attachments in call order (location 0, 1, ...)
+        void write(Resource resource) {
+            graph.passes[pass].writes.push_back(resource);
+        }
+        void writeDepth(Resource resource) {
+            graph.passes[pass].depth = resource;
+        }
+        // never culled, for passes whose effect isn't a texture (queries, readbacks)
+        void keep() {
+            graph.passes[pass].keep = true;
+        }
+
+    private:
+        friend class RenderGraph;
+        Builder(RenderGraph &graph, size_t pass) : graph(graph), pass(pass) {}
+        RenderGraph &graph;
+        size_t pass;
+    };
+
+    using Setup = std::function<void(Builder&)>;
+    using Execute = std::function<void(const RenderGraph&)>;
+
+    struct Stats {
+        size_t passes = 0, culled = 0;
+        size_t transientTextures = 0, glTextures = 0;
+        size_t transientBytes = 0, allocatedBytes = 0; // without and with aliasing
+    };
+
+    RenderGraph() = default;
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph &operator=(const RenderGraph&) = delete;
+
+    // the default framebuffer, writing it makes a pass visible
+    Resource importBackbuffer(int width, int height) {
+        return addResource("backbuffer", {width, height, GL_RGBA8}, true);
+    }
+
+    void addPass(const std::string &name, const Setup &setup, const Execute &execute) {
+        passes.push_back(Pass());
+        passes.back().name = name;
+        passes.back().execute = execute;
+        Builder builder(*this, passes.size() - 1);
+        setup(builder);
+        compiled = false;
+    }
+
+    // passes and resources go, GL textures and framebuffers stay for the next compile()
+    void clear() {
+        passes.clear();
+        resources.clear();
+        order.clear();
+        compiled = false;
+    }
+
+    void compile() {
+        std::vector<std::vector<size_t>> dependencies = findDependencies();
+        sortPasses(dependencies);
+        cullPasses(dependencies);
+        assignTextures();
+        createFramebuffers();
+        compiled = true;
+    }
+
+    void execute() {
+        if (!compiled)
+            compile();
+        for (size_t p : order) {
+            const Pass &pass = passes[p];
+            glBindFramebuffer(GL_FRAMEBUFFER, pass.framebuffer);
+            if (pass.width > 0)
+                glViewport(0, 0, pass.width, pass.height);
+            if (pass.execute)
+                pass.execute(*this);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    // the GL texture behind a transient resource (0 for the backbuffer), valid after compile()
+    unsigned int texture(Resource resource) const {
+        const ResourceNode &node = resources[resource];
+        return node.imported || node.physical == NONE ? 0 : physical[node.physical].texture.id();
+    }
+    const TextureDesc &desc(Resource resource) const {
+        return resources[resource].desc;
+    }
+
+    Stats stats() const {
+        return counters;
+    }
+
+    // passes in execution order, culled ones and which GL texture every transient got
+    void print() const {
+        for (size_t p : order)
+            std::cout << "pass " << passes[p].name << std::endl;
+        for (const Pass &pass : passes)
+            if (pass.culled)
+                std::cout << "culled " << pass.name << std::endl;
+        for (const ResourceNode &node : resources)
+            if (!node.imported && node.physical != NONE)
+                std::cout << node.name << " -> texture " << node.physical << std::endl;
+        std::cout << counters.transientTextures << " transient textures in " << counters.glTextures << " GL textures, "
+                  << counters.allocatedBytes / 1024 << " KB instead of " << counters.transientBytes / 1024 << " KB"
+                  << std::endl;
+    }
+
+    void deleteObjects() {
+        for (const auto &framebuffer : framebuffers)
+            glDeleteFramebuffers(1, &framebuffer.second);
+        framebuffers.clear();
+        physical.clear();
+        clear();
+    }
+
+    // what drivers actually store: three component 8 bit formats and 24 bit depth are padded to 4 bytes (RGBX8, D24X8)
+    static size_t bytesPerPixel(GLenum internalFormat) {
+        switch (internalFormat) {
+            case GL_R8: return 1;
+            case GL_RG8: case GL_R16F: case GL_DEPTH_COMPONENT16: return 2;
+            case GL_RGBA32F: return 16;
+            case GL_RGBA16F: case GL_RG32F: return 8;
+            default: return 4; // RGBA8, RGB8, RG16F, R32F, R11F_G11F_B10F, RGB10_A2, DEPTH_COMPONENT24,
+                               // DEPTH24_STENCIL8, DEPTH_COMPONENT32F
+        }
+    }
+
+private:
+    struct ResourceNode {
+        std::string name;
+        TextureDesc desc;
+        bool imported = false;
+        uint32_t physical = NONE;
+        size_t firstUse = 0, lastUse = 0; // positions in order
+    };
+    struct Pass {
+        std::string name;
+        Execute execute;
+        std::vector<Resource> reads, writes;
+        Resource depth = NONE;
+        bool keep = false, culled = false;
+        unsigned int framebuffer = 0;
+        int width = 0, height = 0;
+    };
+    struct PhysicalTexture {
+        TextureDesc desc;
+        GLTexture texture;
+        size_t freeAfter = 0; // last pass position of its current user, during assignTextures()
+    };
+
+    std::vector<ResourceNode> resources;
+    std::vector<Pass> passes;
+    std::vector<size_t> order; // surviving passes, in execution order
+    std::vector<PhysicalTexture> physical;
+    std::map<std::vector<unsigned int>, unsigned int> framebuffers; // attachments -> FBO
+    Stats counters;
+    bool compiled = false;
+
+    Resource addResource(const std::string &name, const TextureDesc &desc, bool imported) {
+        resources.push_back(ResourceNode());
+        resources.back().name = name;
+        resources.back().desc = desc;
+        resources.back().imported = imported;
+        return Resource(resources.size() - 1);
+    }
+
+    static std::vector<Resource> written(const Pass &pass) {
+        std::vector<Resource> all = pass.writes;
+        if (pass.depth != NONE)
+            all.push_back(pass.depth);
+        return all;
+    }
+
+    // passes each pass has to run after, per resource in declaration order: a read waits for the last write declared
+    // before it (reads declared before any write wait for the first write), a write waits for the previous write and
+    // for the reads of it
+    std::vector<std::vector<size_t>> findDependencies() const {
+        std::vector<std::vector<size_t>> dependencies(passes.size());
+        for (Resource r = 0; r < resources.size(); ++r) {
+            size_t lastWriter = NONE;
+            std::vector<size_t> early, readers; // reads before the first write, reads since the last write
+            for (size_t p = 0; p < passes.size(); ++p) {
+                const Pass &pass = passes[p];
+                std::vector<Resource> all = written(pass);
+                bool reads = std::find(pass.reads.begin(), pass.reads.end(), r) != pass.reads.end();
+                bool writes = std::find(all.begin(), all.end(), r) != all.end();
+                if (reads && lastWriter != NONE) {
+                    dependencies[p].push_back(lastWriter);
+                    readers.push_back(p);
+                } else if (reads && !writes) {
+                    early.push_back(p);
+                }
+                if (!writes)
+                    continue;
+                if (lastWriter == NONE) {
+                    for (size_t reader : early)
+                        dependencies[reader].push_back(p);
+                } else {
+                    dependencies[p].push_back(lastWriter);
+                }
+                for (size_t reader : readers)
+                    if (reader != p)
+                        dependencies[p].push_back(reader);
+                // the early reads read this write, the next write waits for them
+                readers = lastWriter == NONE ? early : std::vector<size_t>();
+                lastWriter = p;
+            }
+        }
+        return dependencies;
+    }
+
+    // Kahn's algorithm, lowest declaration index first among the ready passes
+    void sortPasses(const std::vector<std::vector<size_t>> &dependencies) {
+        std::vector<size_t> waiting(passes.size(), 0);
+        std::vector<std::vector<size_t>> dependents(passes.size());
+        for (size_t p = 0; p < passes.size(); ++p) {
+            for (size_t d : dependencies[p]) {
+                waiting[p]++;
+                dependents[d].push_back(p);
+            }
+        }
+        std::vector<size_t> sorted, ready;
+        for (size_t p = 0; p < passes.size(); ++p)
+            if (waiting[p] == 0)
+                ready.push_back(p);
+        while (!ready.empty()) {
+            auto lowest = std::min_element(ready.begin(), ready.end());
+            size_t p = *lowest;
+            ready.erase(lowest);
+            sorted.push_back(p);
+            for (size_t next : dependents[p])
+                if (--waiting[next] == 0)
+                    ready.push_back(next);
+        }
+        if (sorted.size() < passes.size()) {
+            std::cout << "ERROR::RENDER_GRAPH::CYCLE" << std::endl;
+            for (size_t p = 0; p < passes.size(); ++p)
+                if (waiting[p] > 0)
+                    sorted.push_back(p);
+        }
+        order = sorted;
+    }
+
+    // from the visible passes back through what they depend on
+    void cullPasses(const std::vector<std::vector<size_t>> &dependencies) {
+        std::vector<size_t> stack;
+        for (size_t p = 0; p < passes.size(); ++p) {
+            passes[p].culled = true;
+            bool visible = passes[p].keep;
+            for (Resource r : written(passes[p]))
+                visible = visible || resources[r].imported;
+            if (visible)
+                stack.push_back(p);
+        }
+        while (!stack.empty()) {
+            size_t p = stack.back();
+            stack.pop_back();
+            if (!passes[p].culled)
+                continue;
+            passes[p].culled = false;
+            for (size_t d : dependencies[p])
+                stack.push_back(d);
+        }
+        order.erase(std::remove_if(order.begin(), order.end(), [&](size_t p) { return passes[p].culled; }),
+                    order.end());
+        counters = Stats();
+        counters.passes = order.size();
+        counters.culled = passes.size() - order.size();
+    }
+
+    // transients by first use; each takes a GL texture of its desc that's free by then, or a new one
+    void assignTextures() {
+        std::vector<bool> used(resources.size(), false);
+        for (size_t i = 0; i < order.size(); ++i) {
+            const Pass &pass = passes[order[i]];
+            std::vector<Resource> all = written(pass);
+            all.insert(all.end(), pass.reads.begin(), pass.reads.end());
+            for (Resource r : all) {
+                if (!used[r])
+                    resources[r].firstUse = i;
+                resources[r].lastUse = i;
+                used[r] = true;
+            }
+        }
+        std::vector<Resource> transients;
+        for (Resource r = 0; r < resources.size(); ++r) {
+            resources[r].physical = NONE;
+            if (used[r] && !resources[r].imported)
+                transients.push_back(r);
+        }
+        std::stable_sort(transients.begin(), transients.end(),
+                         [&](Resource a, Resource b) { return resources[a].firstUse < resources[b].firstUse; });
+
+        std::vector<bool> taken(physical.size(), false);
+        for (Resource r : transients) {
+            ResourceNode &node = resources[r];
+            uint32_t chosen = NONE;
+            for (uint32_t t = 0; t < physical.size() && chosen == NONE; ++t)
+                if (physical[t].desc == node.desc && (!taken[t] || physical[t].freeAfter < node.firstUse))
+                    chosen = t;
+            if (chosen == NONE) {
+                chosen = uint32_t(physical.size());
+                physical.push_back({node.desc, createTexture(node.desc), 0});
+                taken.push_back(false);
+            }
+            taken[chosen] = true;
+            physical[chosen].freeAfter = node.lastUse;
+            node.physical = chosen;
+            counters.transientTextures++;
+            counters.transientBytes += size_t(node.desc.width) * node.desc.height * bytesPerPixel(node.desc.internalFormat);
+        }
+        // textures no transient needs any more go back to the pool
+        std::vector<PhysicalTexture> kept;
+        std::vector<uint32_t> remap(physical.size(), NONE);
+        for (uint32_t t = 0; t < physical.size(); ++t) {
+            if (!taken[t])
+                continue;
+            remap[t] = uint32_t(kept.size());
+            kept.push_back(std::move(physical[t]));
+        }
+        physical = std::move(kept);
+        for (Resource r : transients)
+            resources[r].physical = remap[resources[r].physical];
+        for (const PhysicalTexture &texture : physical)
+            counters.allocatedBytes += size_t(texture.desc.width) * texture.desc.height *
+                                       bytesPerPixel(texture.desc.internalFormat);
+        counters.glTextures = physical.size();
+    }
+
+    static bool isDepthFormat(GLenum internalFormat) {
+        return internalFormat == GL_DEPTH_COMPONENT16 || internalFormat == GL_DEPTH_COMPONENT24 ||
+               internalFormat == GL_DEPTH_COMPONENT32F || internalFormat == GL_DEPTH24_STENCIL8;
+    }
+
+    static GLTexture createTexture(const TextureDesc &desc) {
+        GLenum format = GL_RGBA, type = GL_UNSIGNED_BYTE;
+        switch (desc.internalFormat) {
+            case GL_DEPTH24_STENCIL8: format = GL_DEPTH_STENCIL; type = GL_UNSIGNED_INT_24_8; break;
+            case GL_DEPTH_COMPONENT16: case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32F:
+                format = GL_DEPTH_COMPONENT; type = GL_FLOAT; break;
+            case GL_R8: format = GL_RED; break;
+            case GL_R16F: case GL_R32F: format = GL_RED; type = GL_FLOAT; break;
+            case GL_RG8: format = GL_RG; break;
+            case GL_RG16F: case GL_RG32F: format = GL_RG; type = GL_FLOAT; break;
+            case GL_RGB8: format = GL_RGB; break;
+            case GL_R11F_G11F_B10F: format = GL_RGB; type = GL_FLOAT; break;
+            case GL_RGBA16F: case GL_RGBA32F: type = GL_FLOAT; break;
+            default: break;
+        }
+        GLTexture texture = GLTexture::create();
+        glBindTexture(GL_TEXTURE_2D, texture.id());
+        glTexImage2D(GL_TEXTURE_2D, 0, desc.internalFormat, desc.width, desc.height, 0, format, type, nullptr);
+        GLint filter = isDepthFormat(desc.internalFormat) ? GL_NEAREST : GL_LINEAR;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return texture;
+    }
+
+    // one FBO per distinct attachment set (shared by passes with the same targets); 0 for the backbuffer
+    void createFramebuffers() {
+        std::map<std::vector<unsigned int>, unsigned int> unused;
+        unused.swap(framebuffers);
+        for (size_t p : order) {
+            Pass &pass = passes[p];
+            std::vector<Resource> all = written(pass);
+            if (all.empty()) {
+                pass.framebuffer = 0;
+                continue;
+            }
+            const TextureDesc &size = resources[all.front()].desc;
+            pass.width = size.width;
+            pass.height = size.height;
+            bool backbuffer = false, transient = false;
+            for (Resource r : all) {
+                backbuffer = backbuffer || resources[r].imported;
+                transient = transient || !resources[r].imported;
+            }
+            if (backbuffer) {
+                if (transient)
+                    std::cout << "ERROR::RENDER_GRAPH::BACKBUFFER_WITH_ATTACHMENTS " << pass.name << std::endl;
+                pass.framebuffer = 0;
+                continue;
+            }
+            std::vector<unsigned int> key;
+            for (Resource r : pass.writes)
+                key.push_back(texture(r));
+            key.push_back(pass.depth == NONE ? 0 : texture(pass.depth));
+            auto cached = framebuffers.find(key);
+            if (cached == framebuffers.end()) {
+                auto previous = unused.find(key);
+                if (previous != unused.end()) {
+                    cached = framebuffers.insert(*previous).first;
+                    unused.erase(previous);
+                } else {
+                    cached = framebuffers.emplace(key, createFramebuffer(pass)).first;
+                }
+            }
+            pass.framebuffer = cached->second;
+        }
+        for (const auto &framebuffer : unused)
+            glDeleteFramebuffers(1, &framebuffer.second);
+    }
+
+    unsigned int createFramebuffer(const Pass &pass) {
+        unsigned int framebuffer;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        std::vector<GLenum> drawBuffers;
+        for (size_t i = 0; i < pass.writes.size(); ++i) {
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GLenum(GL_COLOR_ATTACHMENT0 + i), GL_TEXTURE_2D,
+                                   texture(pass.writes[i]), 0);
+            drawBuffers.push_back(GLenum(GL_COLOR_ATTACHMENT0 + i));
+        }
+        if (pass.depth != NONE) {
+            GLenum attachment = resources[pass.depth].desc.internalFormat == GL_DEPTH24_STENCIL8 ?
+                                GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+            glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture(pass.depth), 0);
+        }
+        if (drawBuffers.empty()) {
+            glDrawBuffer(GL_NONE);
+            glReadBuffer(GL_NONE);
+        } else {
+            glDrawBuffers(GLsizei(drawBuffers.size()), drawBuffers.data());
+        }
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cout << "ERROR::RENDER_GRAPH::FRAMEBUFFER_INCOMPLETE " << pass.name << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return framebuffer;
+    }
+};
+
+#endif //OPENGL_REVIEW_RENDERGRAPH_H
@@ -0,0 +1,224 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_SCENEGRAPH_H
+#define OPENGL_REVIEW_SCENEGRAPH_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "ThreadPool.h"
+
+/*
+ * Transform hierarchy as parallel arrays (parent, local, world, ...) in depth first order, so every parent comes
+ * before its children and every subtree is one contiguous range [i, i + subtreeSize[i]).
+ *  > nodes are addressed by handles that stay valid; slots (array positions) change when the tree is re-sorted
+ *  > setLocal() only flags the node; update() recomputes world = world[parent] * local for flagged nodes and their
+ *    subtrees and leaves everything else alone, so static objects cost nothing per frame
+ *  > update() hands disjoint subtrees to the thread pool: it walks down from the roots until there are enough
+ *    subtrees to go round, does the few nodes above them itself, then the subtrees in parallel
+ * Adding nodes or reparenting marks the order stale, the next update() re-sorts and recomputes everything once.
+ * The hierarchy is always a forest: setParent() refuses to make a node its own ancestor.
+ */
+class SceneGraph {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle NONE = 0xFFFFFFFFu;
+
+    struct Stats {
+        size_t nodes = 0, updated = 0, tasks = 0;
+    };
+
+    Handle add(Handle parent = NONE, const glm::mat4 &local = glm::mat4(1.0f)) {
+        Handle handle = Handle(parentOf.size());
+        if (parent != NONE && parent >= handle) {
+            std::cout << "ERROR::SCENE_GRAPH::INVALID_PARENT " << parent << std::endl;
+            parent = NONE;
+        }
+        parentOf.push_back(parent);
+        slotOf.push_back(uint32_t(handles.size()));
+        handles.push_back(handle);
+        this->parent.push_back(-1);
+        this->local.push_back(local);
+        world.push_back(local);
+        subtreeSize.push_back(1);
+        dirty.push_back(1);
+        sorted = false;
+        return handle;
+    }
+
+    // false (and nothing changes) when parent is handle itself or one of its descendants
+    bool setParent(Handle handle, Handle parent) {
+        if (parent != NONE && parent >= parentOf.size()) {
+            std::cout << "ERROR::SCENE_GRAPH::INVALID_PARENT " << parent << std::endl;
+            return false;
+        }
+        for (Handle ancestor = parent; ancestor != NONE; ancestor = parentOf[ancestor]) {
+            if (ancestor == handle) {
+                std::cout << "ERROR::SCENE_GRAPH::CYCLE " << handle << " can't be a child of " << parent << std::endl;
+                return false;
+            }
+        }
+        parentOf[handle] = parent;
+        dirty[slotOf[handle]] = 1;
+        sorted = false;
+        return true;
+    }
+
+    void setLocal(Handle handle, const glm::mat4 &m) {
+        uint32_t slot = slotOf[handle];
+        local[slot] = m;
+        dirty[slot] = 1;
+    }
+    const glm::mat4 &getLocal(Handle handle) const {
+        return local[slotOf[handle]];
+    }
+    // as of the last update()
+    const glm::mat4 &getWorld(Handle handle) const {
+        return world[slotOf[handle]];
+    }
+    size_t size() const {
+        return handles.size();
+    }
+    const Stats &stats() const {
+        return counters;
+    }
+
+    void update(ThreadPool &pool = ThreadPool::shared()) {
+        if (!sorted)
+            sort();
+        counters = Stats();
+        counters.nodes = handles.size();
+
+        // subtrees to hand out; the nodes passed on the way down are done here first, in order
+        tasks.clear();
+        for (uint32_t slot = 0; slot < handles.size(); slot += subtreeSize[slot])
+            tasks.push_back(slot);
+        size_t wanted = size_t(pool.size()) * 4;
+        while (tasks.size() < wanted) {
+            nextTasks.clear();
+            bool split = false;
+            for (uint32_t slot : tasks) {
+                if (subtreeSize[slot] == 1) {
+                    nextTasks.push_back(slot);
+                    continue;
+                }
+                split = true;
+                counters.updated += updateNode(slot);
+                for (uint32_t child = slot + 1; child < slot + subtreeSize[slot]; child += subtreeSize[child])
+                    nextTasks.push_back(child);
+            }
+            tasks.swap(nextTasks);
+            if (!split)
+                break;
+        }
+        counters.tasks = tasks.size();
+
+        updated.assign(pool.size(), 0);
+        pool.parallelFor(tasks.size(), [&](size_t begin, size_t end, unsigned worker) {
+            for (size_t t = begin; t < end; ++t)
+                updated[worker] += updateRange(tasks[t], tasks[t] + subtreeSize[tasks[t]]);
+        });
+        for (size_t n : updated)
+            counters.updated += n;
+    }
+
+private:
+    // by handle
+    std::vector<Handle> parentOf;
+    std::vector<uint32_t> slotOf;
+    // by slot, depth first
+    std::vector<Handle> handles;
+    std::vector<int32_t> parent; // slot, -1 for roots
+    std::vector<glm::mat4> local, world;
+    std::vector<uint32_t> subtreeSize;
+    std::vector<uint8_t> dirty; // local changed since the last update, or an ancestor's world did
+    bool sorted = true;
+    Stats counters;
+    // update()'s scratch, kept so a steady frame doesn't allocate
+    std::vector<uint32_t> tasks, nextTasks;
+    std::vector<size_t> updated;
+
+    // one node whose ancestors are already up to date; its children inherit the flag
+    size_t updateNode(uint32_t slot) {
+        if (!dirty[slot])
+            return 0;
+        world[slot] = parent[slot] < 0 ? local[slot] : world[parent[slot]] * local[slot];
+        dirty[slot] = 0;
+        for (uint32_t child = slot + 1; child < slot + subtreeSize[slot]; child += subtreeSize[child])
+            dirty[child] = 1;
+        return 1;
+    }
+
+    // whole subtrees in order: a dirty node means everything below it changes too, clean ranges are only scanned
+    size_t updateRange(uint32_t begin, uint32_t end) {
+        size_t updated = 0;
+        for (uint32_t slot = begin; slot < end;) {
+            if (!dirty[slot]) {
+                slot++;
+                continue;
+            }
+            uint32_t stop = slot + subtreeSize[slot];
+            for (uint32_t i = slot; i < stop; ++i) {
+                world[i] = parent[i] < 0 ? local[i] : world[parent[i]] * local[i];
+                dirty[i] = 0;
+            }
+            updated += stop - slot;
+            slot = stop;
+        }
+        return updated;
+    }
+
+    // depth first from the roots, in handle order (every node is reached, there are no cycles); everything is
+    // recomputed afterwards
+    void sort() {
+        size_t count = parentOf.size();
+        std::vector<uint32_t> childStart(count + 1, 0), childList(count);
+        for (Handle h = 0; h < count; ++h)
+            if (parentOf[h] != NONE)
+                childStart[parentOf[h] + 1]++;
+        for (size_t h = 0; h < count; ++h)
+            childStart[h + 1] += childStart[h];
+        std::vector<uint32_t> fill(childStart.begin(), childStart.end() - 1);
+        for (Handle h = 0; h < count; ++h)
+            if (parentOf[h] != NONE)
+                childList[fill[parentOf[h]]++] = h;
+
+        std::vector<glm::mat4> oldLocal(local);
+        std::vector<uint32_t> oldSlot(slotOf);
+        std::vector<Handle> order, stack;
+        for (Handle h = count; h-- > 0;)
+            if (parentOf[h] == NONE)
+                stack.push_back(h);
+        while (!stack.empty()) {
+            Handle h = stack.back();
+            stack.pop_back();
+            order.push_back(h);
+            for (uint32_t c = childStart[h + 1]; c-- > childStart[h];)
+                stack.push_back(childList[c]);
+        }
+
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            Handle h = order[slot];
+            handles[slot] = h;
+            slotOf[h] = slot;
+            local[slot] = oldLocal[oldSlot[h]];
+        }
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            Handle p = parentOf[handles[slot]];
+            parent[slot] = p == NONE ? -1 : int32_t(slotOf[p]);
+            subtreeSize[slot] = 1;
+            dirty[slot] = 1;
+        }
+        for (uint32_t slot = uint32_t(count); slot-- > 0;)
+            if (parent[slot] >= 0)
+                subtreeSize[parent[slot]] += subtreeSize[slot];
+        sorted = true;
+    }
+};
+
+#endif //OPENGL_REVIEW_SCENEGRAPH_H
@@ -6,46 +6,78 @@
 #define OPENGL_REVIEW_SHADER_H
 
 #include <glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstring>
 #include <string>
-#include <fstream>
-#include <sstream>
+#include <string_view>
+#include <vector>
 #include <iostream>
 
+#include "ProgramReflection.h"
+#include "ShaderPreprocessor.h"
+
+// flags set by glad.c's extension detection (see GLAD_EXTENSIONS in CMakeLists.txt)
+extern "C" int GLAD_GL_KHR_parallel_shader_compile;
+extern "C" int GLAD_GL_ARB_parallel_shader_compile;
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+class ShaderBatch;
+
 class Shader {
 public:
     // the program ID
     unsigned int ID;
 
+    // files the program was built from (watched by ShaderReloader)
+    std::vector<std::string> files;
+    // feature defines ("NAME" or "NAME=VALUE") the sources were resolved with, see ShaderPreprocessor
+    std::vector<std::string> defines;
+    // files pulled in by #include (watched as well)
+    std::vector<std::string> includes;
+    // ID belongs to a ShaderVariants cache (shared between define sets that resolve alike), not to this Shader
+    bool sharedProgram = false;
+
     // constructor reads and builds the shader
-    Shader(const char* vertexPath, const char* fragmentPath) {
-        // 1. retrieve the vertex/fragment source code from filePath
-        std::string vertexCode;
-        std::string fragmentCode;
-        std::ifstream vShaderFile;
-        std::ifstream fShaderFile;
-        // ensure ifstream objects can throw exceptions:
-        vShaderFile.exceptions (std::ifstream::failbit | std::ifstream::badbit);
-        fShaderFile.exceptions (std::ifstream::failbit | std::ifstream::badbit);
-        try
-        {
-            // open files
-            vShaderFile.open(vertexPath);
-            fShaderFile.open(fragmentPath);
-            std::stringstream vShaderStream, fShaderStream;
-            // read file's buffer contents into streams
-            vShaderStream << vShaderFile.rdbuf();
-            fShaderStream << fShaderFile.rdbuf();
-            // close file handlers
-            vShaderFile.close();
-            fShaderFile.close();
-            // convert stream into string
-            vertexCode   = vShaderStream.str();
-            fragmentCode = fShaderStream.str();
-        }
-        catch(std::ifstream::failure e)
-        {
-            std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ" << std::endl;
-        }
+    Shader(const char* vertexPath, const char* fragmentPath) : files{vertexPath, fragmentPath} {
+        ID = build(source(0, &includes), source(1, &includes));
+    }
+    // one permutation of the sources (usually through ShaderVariants, which also deduplicates them)
+    Shader(const char* vertexPath, const char* fragmentPath, const std::vector<std::string> &defines)
+            : files{vertexPath, fragmentPath}, defines(defines) {
+        ID = build(source(0, &includes), source(1, &includes));
+    }
+    // a program built elsewhere from these files and defines
+    Shader(unsigned int program, const std::vector<std::string> &files, const std::vector<std::string> &defines)
+            : ID(program), files(files), defines(defines) {}
+
+    // source of files[stage] (0 = vertex, 1 = fragment) the way this shader builds it
+    std::string source(size_t stage, std::vector<std::string> *includedFiles = nullptr) const {
+        std::string code = readFile(files[stage], includedFiles);
+        return defines.empty() ? code : ShaderPreprocessor::resolve(code, defines);
+    }
+
+    // retrieve the source code from filePath, #includes expanded (each file is only read from disk once)
+    static std::string readFile(const std::string &path, std::vector<std::string> *includedFiles = nullptr) {
+        return ShaderPreprocessor::expand(path, includedFiles);
+    }
+
+    // shader and program objects of a build that has been submitted but not checked yet
+    struct Pending {
+        unsigned int vertex, fragment, program;
+    };
+
+    // compile and link a vertex/fragment pair, returns 0 if either step fails
+    // (needs a current context, not necessarily the one the program will be used in)
+    static unsigned int build(const std::string &vertexCode, const std::string &fragmentCode) {
+        Pending pending = submit(vertexCode, fragmentCode);
+        return finish(pending);
+    }
+
+    // issue compile + link without asking for any status, so nothing waits for the compiler yet
+    static Pending submit(const std::string &vertexCode, const std::string &fragmentCode) {
         const char* vShaderCode = vertexCode.c_str();
         const char* fShaderCode = fragmentCode.c_str();
 
@@ -56,63 +88,168 @@ public:
         glShaderSource(vertex, 1, &vShaderCode, NULL);
         // Source - arg1: shader obj to compile to | arg2: how many strings in source | arg3: source obj
         glCompileShader(vertex);
-        checkCompileErrors(vertex, "VERTEX");
 
         // fragment shader
         unsigned int fragment= glCreateShader(GL_FRAGMENT_SHADER);
         glShaderSource(fragment, 1, &fShaderCode, NULL);
         glCompileShader(fragment);
-        checkCompileErrors(fragment, "FRAGMENT");
 
         // shader Program
-        ID = glCreateProgram();
-        glAttachShader(ID, vertex);
-        glAttachShader(ID, fragment);
-        glLinkProgram(ID);
-        checkCompileErrors(ID, "PROGRAM");
+        unsigned int program = glCreateProgram();
+        glAttachShader(program, vertex);
+        glAttachShader(program, fragment);
+        glLinkProgram(program);
+        return {vertex, fragment, program};
+    }
+
+    // true once the driver has finished linking, without blocking
+    // (without KHR/ARB_parallel_shader_compile there's no way to ask, so always true)
+    static bool completed(const Pending &pending) {
+        if (!parallelCompileSupported())
+            return true;
+        int done = GL_TRUE;
+        glGetProgramiv(pending.program, GL_COMPLETION_STATUS_KHR, &done);
+        return done == GL_TRUE;
+    }
+
+    // check the results (blocks if the driver isn't done), returns the program or 0 if anything failed
+    static unsigned int finish(Pending &pending) {
+        bool ok = checkCompileErrors(pending.vertex, "VERTEX");
+        ok = checkCompileErrors(pending.fragment, "FRAGMENT") && ok;
+        ok = checkCompileErrors(pending.program, "PROGRAM") && ok;
         // delete the shaders as they're linked into our program now and no longer necessary
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
+        glDeleteShader(pending.vertex);
+        glDeleteShader(pending.fragment);
+        if (!ok) {
+            glDeleteProgram(pending.program);
+            return 0;
+        }
+        return pending.program;
+    }
+
+    static bool parallelCompileSupported() {
+        return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
     }
+
+    // constructor registers the shader with a batch, ID is 0 until batch.finish()
+    Shader(const char* vertexPath, const char* fragmentPath, ShaderBatch &batch);
+
     // use/activate the shader
     void use() {
         glUseProgram(ID);
     }
+
+    // attributes, uniforms and blocks of the current program, queried once per program (IDs change on reload)
+    const ProgramReflection &reflection() const {
+        if (reflected.program != ID)
+            reflected = ProgramReflection::reflect(ID);
+        return reflected;
+    }
+    // names are views so literals don't build a std::string per call
+    int uniformLocation(std::string_view name) const {
+        const ProgramReflection::Uniform *uniform = reflection().uniform(name);
+        if (uniform != nullptr)
+            return uniform->location;
+        // array elements past [0] aren't listed by name; GL wants it NUL terminated, copied on the stack (nothing
+        // that has to be reset, so demos that never touch the frame arena don't grow it)
+        char buffer[256];
+        if (name.size() >= sizeof(buffer))
+            return glGetUniformLocation(ID, std::string(name).c_str());
+        memcpy(buffer, name.data(), name.size());
+        buffer[name.size()] = '\0';
+        return glGetUniformLocation(ID, buffer);
+    }
+
     // utility uniform functions
-    void setBool(const std::string &name, bool value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    void setBool(std::string_view name, bool value) const {
+        glUniform1i(uniformLocation(name), (int)value);
+    }
+    void setInt(std::string_view name, int value) const {
+        glUniform1i(uniformLocation(name), value);
+    }
+    void setFloat(std::string_view name, float value) const {
+        glUniform1f(uniformLocation(name), value);
     }
-    void setInt(const std::string &name, int value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    void setVec2(std::string_view name, const glm::vec2 &value) const {
+        glUniform2f(uniformLocation(name), value.x, value.y);
     }
-    void setFloat(const std::string &name, float value) const {
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    void setVec3(std::string_view name, const glm::vec3 &value) const {
+        glUniform3fv(uniformLocation(name), 1, glm::value_ptr(value));
     }
-    void setMat4(const std::string &name, glm::mat4 value) const {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(value));
+    void setMat4(std::string_view name, const glm::mat4 &value) const {
+        glUniformMatrix4fv(uniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
     }
 
 private:
-    void checkCompileErrors(const unsigned int &ID, const std::string &type) {
+    mutable ProgramReflection reflected;
+
+    static bool checkCompileErrors(const unsigned int &ID, const std::string &type) {
         ///
         /// Check if compile was successful
-        int success;
+        int success = 1;
         char infoLog[1024];
         if (type == "VERTEX" || type == "FRAGMENT") {
             glGetShaderiv(ID, GL_COMPILE_STATUS, &success);
             if (!success) {
-                glGetShaderInfoLog(ID, 512, NULL, infoLog);
+                glGetShaderInfoLog(ID, 1024, NULL, infoLog);
                 std::cout << "ERROR::SHADER::" << type << "::COMPILATION_FAILED\n" << infoLog << std::endl;
             }
         } else if (type == "PROGRAM") {
-            glGetProgramiv(ID, GL_COMPILE_STATUS, &success);
+            glGetProgramiv(ID, GL_LINK_STATUS, &success);
             if (!success) {
-                glGetProgramInfoLog(ID, 512, NULL, infoLog);
+                glGetProgramInfoLog(ID, 1024, NULL, infoLog);
                 std::cout << "ERROR::SHADER::" << type << "::LINKING_FAILED\n" << infoLog << std::endl;
             }
 
         }
+        return success != 0;
+    }
+};
+
+/*
+ * Builds many programs in one go so the driver can compile them in parallel (KHR/ARB_parallel_shader_compile).
+ * Every program is submitted first; nothing asks for a status until all of them are in flight.
+ *  > Shader s(vertexPath, fragmentPath, batch)   read + submit, s.ID stays 0
+ *  > batch.ready()                               poll, true once every program has finished (never blocks)
+ *  > batch.finish()                              check logs and hand out the IDs (blocks on whatever isn't done)
+ * Without the extension the driver compiles serially anyway and ready() is always true.
+ */
+class ShaderBatch {
+public:
+    void add(Shader &shader, const std::string &vertexCode, const std::string &fragmentCode) {
+        entries.push_back({&shader, Shader::submit(vertexCode, fragmentCode)});
+    }
+
+    bool ready() const {
+        for (const Entry &entry : entries)
+            if (!Shader::completed(entry.pending))
+                return false;
+        return true;
+    }
+
+    // returns how many programs failed
+    int finish() {
+        int failed = 0;
+        for (Entry &entry : entries) {
+            entry.shader->ID = Shader::finish(entry.pending);
+            if (entry.shader->ID == 0)
+                failed++;
+        }
+        entries.clear();
+        return failed;
     }
+
+private:
+    struct Entry {
+        Shader *shader;
+        Shader::Pending pending;
+    };
+    std::vector<Entry> entries;
 };
 
+inline Shader::Shader(const char* vertexPath, const char* fragmentPath, ShaderBatch &batch)
+        : ID(0), files{vertexPath, fragmentPath} {
+    batch.add(*this, source(0, &includes), source(1, &includes));
+}
+
 #endif //OPENGL_REVIEW_SHADER_H
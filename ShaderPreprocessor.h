@@ -0,0 +1,465 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_SHADERPREPROCESSOR_H
+#define OPENGL_REVIEW_SHADERPREPROCESSOR_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+ * CPU side GLSL preprocessing for Shader.
+ *
+ * expand(): #include "file" (path relative to the including file) for any GLSL version
+ *  > every file is read once into a cache shared by all Shaders, later expansions copy from memory
+ *  > a file is included at most once per stage (like #pragma once), which also stops include cycles
+ *  > #line directives keep error logs pointing at the right file: source string 0 is the stage file, n is includes[n-1]
+ *  > includes are expanded whether or not they sit in an #ifdef
+ *  > invalidate() drops a file from the cache (ShaderReloader does this for changed files)
+ *
+ * resolve(): the conditional part of the GLSL preprocessor on the CPU for a given set of feature defines.
+ *  > defines are "NAME" (a flag) or "NAME=VALUE"
+ *  > #ifdef/#ifndef/#if/#elif/#else/#endif are evaluated, inactive lines and the directives become empty lines
+ *  > only defines the remaining code still mentions are inserted after #version (followed by #line so compile errors
+ *    keep pointing at the right line of the file)
+ * Two define sets that select the same code therefore give byte for byte the same output, which is what
+ * ShaderVariants deduplicates on.
+ */
+class ShaderPreprocessor {
+public:
+    // the source of path with all #includes pasted in, included files are appended to includes (if not there yet)
+    static std::string expand(const std::string &path, std::vector<std::string> *includes = nullptr) {
+        std::vector<std::string> found;
+        std::string out;
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex());
+            std::set<std::string> included;
+            expandFile(normalize(path), 0, out, included, found);
+        }
+        if (includes != nullptr)
+            for (const std::string &file : found)
+                if (std::find(includes->begin(), includes->end(), file) == includes->end())
+                    includes->push_back(file);
+        return out;
+    }
+
+    static void invalidate(const std::string &path) {
+        std::lock_guard<std::mutex> lock(cacheMutex());
+        cache().erase(normalize(path));
+    }
+
+    // collapses "dir/../" and "./" so a file has one spelling, whichever file included it
+    static std::string normalize(const std::string &path) {
+        std::vector<std::string> parts;
+        size_t start = 0;
+        while (start <= path.size()) {
+            size_t slash = std::min(path.find('/', start), path.size());
+            std::string part = path.substr(start, slash - start);
+            start = slash + 1;
+            if (part == "." || (part.empty() && !parts.empty()))
+                continue;
+            if (part == ".." && !parts.empty() && parts.back() != ".." && !parts.back().empty())
+                parts.pop_back();
+            else
+                parts.push_back(part);
+        }
+        std::string out;
+        for (size_t i = 0; i < parts.size(); ++i)
+            out += (i ? "/" : "") + parts[i];
+        return out.empty() ? "." : out;
+    }
+
+    static std::string resolve(const std::string &source, const std::vector<std::string> &defines) {
+        std::map<std::string, std::string> macros;
+        for (const std::string &define : defines) {
+            size_t equals = define.find('=');
+            if (equals == std::string::npos)
+                macros[define] = "";
+            else
+                macros[define.substr(0, equals)] = define.substr(equals + 1);
+        }
+        // #defines in the file itself can be tested too, but they stay in the code and aren't inserted again
+        std::map<std::string, std::string> external = macros;
+
+        struct Block {
+            bool parentActive, taken, active;
+        };
+        std::vector<Block> blocks;
+        std::string version, body;
+        int versionLine = 0, lineNumber = 0;
+        size_t pos = 0;
+        while (pos < source.size()) {
+            size_t end = source.find('\n', pos);
+            if (end == std::string::npos)
+                end = source.size();
+            std::string line = source.substr(pos, end - pos);
+            pos = end + 1;
+            lineNumber++;
+
+            bool active = blocks.empty() || blocks.back().active;
+            size_t first = line.find_first_not_of(" \t");
+            if (first == std::string::npos || line[first] != '#') {
+                body += active ? line : "";
+                body += '\n';
+                continue;
+            }
+            size_t nameStart = line.find_first_not_of(" \t", first + 1);
+            size_t nameEnd = nameStart == std::string::npos ? line.size() : nameStart;
+            while (nameEnd < line.size() && std::isalpha((unsigned char)line[nameEnd]))
+                nameEnd++;
+            std::string directive = nameStart == std::string::npos ? "" : line.substr(nameStart, nameEnd - nameStart);
+            std::string rest = line.substr(nameEnd);
+
+            if (directive == "ifdef" || directive == "ifndef" || directive == "if") {
+                bool condition = false;
+                if (active) {
+                    if (directive == "if")
+                        condition = evaluate(rest, macros, lineNumber) != 0;
+                    else
+                        condition = macros.count(identifier(rest)) == (directive == "ifdef" ? 1u : 0u);
+                }
+                blocks.push_back({active, condition, active && condition});
+            } else if (directive == "elif" || directive == "else" || directive == "endif") {
+                if (blocks.empty()) {
+                    std::cout << "ERROR::PREPROCESSOR::UNMATCHED_" << directive << " line " << lineNumber << std::endl;
+                } else if (directive == "endif") {
+                    blocks.pop_back();
+                } else {
+                    Block &block = blocks.back();
+                    bool condition = block.parentActive && !block.taken &&
+                                     (directive == "else" || evaluate(rest, macros, lineNumber) != 0);
+                    block.active = condition;
+                    block.taken = block.taken || condition;
+                }
+            } else if (!active) {
+                // directive inside a skipped block
+            } else if (directive == "version" && version.empty()) {
+                version = line;
+                versionLine = lineNumber;
+            } else {
+                if (directive == "define") {
+                    std::string name = identifier(rest);
+                    size_t valueStart = rest.find(name) + name.size();
+                    size_t first = rest.find_first_not_of(" \t", valueStart);
+                    macros[name] = first == std::string::npos ? "" : rest.substr(first);
+                } else if (directive == "undef") {
+                    macros.erase(identifier(rest));
+                }
+                body += line;
+            }
+            body += '\n';
+        }
+        if (!blocks.empty())
+            std::cout << "ERROR::PREPROCESSOR::MISSING_ENDIF" << std::endl;
+
+        std::set<std::string> used = identifiers(body);
+        std::string out = version.empty() ? "" : version + "\n";
+        for (const auto &macro : external)
+            if (used.count(macro.first))
+                out += "#define " + macro.first + (macro.second.empty() ? "" : " " + macro.second) + "\n";
+        if (version.empty())
+            return out + body;
+        // nothing but comments can come before #version, so the body restarts right after it
+        size_t afterVersion = 0;
+        for (int i = 0; i < versionLine; ++i)
+            afterVersion = body.find('\n', afterVersion) + 1;
+        return out + "#line " + std::to_string(versionLine + 1) + "\n" + body.substr(afterVersion);
+    }
+
+private:
+    static std::map<std::string, std::string> &cache() {
+        static std::map<std::string, std::string> files;
+        return files;
+    }
+    // the reloader's worker thread expands too
+    static std::mutex &cacheMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // cached contents of path, read straight into the string (no stringstream in between); nullptr if unreadable
+    static const std::string *cachedFile(const std::string &path) {
+        auto cached = cache().find(path);
+        if (cached != cache().end())
+            return &cached->second;
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        std::streamoff size = file ? std::streamoff(file.tellg()) : -1;
+        std::string contents(size > 0 ? size_t(size) : 0, '\0');
+        if (size < 0 || !file.seekg(0) || !file.read(&contents[0], size)) {
+            // not cached, so the file is tried again next time
+            std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+            return nullptr;
+        }
+        return &cache().emplace(path, std::move(contents)).first->second;
+    }
+
+    static void expandFile(const std::string &path, size_t sourceNumber, std::string &out,
+                           std::set<std::string> &included, std::vector<std::string> &includes) {
+        included.insert(path);
+        const std::string *source = cachedFile(path);
+        if (source == nullptr)
+            return;
+        size_t slash = path.find_last_of('/');
+        std::string directory = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+
+        int lineNumber = 0;
+        // an include inside #if/#ifdef is pasted either way; if the block turns out to be skipped (by resolve() or
+        // by the GLSL compiler) its closing #line goes with it, so every #else/#elif/#endif after such an include
+        // states the line number again
+        int depth = 0;
+        bool resync = false;
+        size_t pos = 0;
+        while (pos < source->size()) {
+            size_t end = std::min(source->find('\n', pos), source->size());
+            lineNumber++;
+            size_t first = source->find_first_not_of(" \t", pos);
+            if (first < end && (*source)[first] == '#') {
+                size_t directive = source->find_first_not_of(" \t", first + 1);
+                size_t nameEnd = directive;
+                while (nameEnd < end && (std::isalnum((unsigned char)(*source)[nameEnd]) || (*source)[nameEnd] == '_'))
+                    nameEnd++;
+                std::string name = directive < end ? source->substr(directive, nameEnd - directive) : "";
+                if (name == "if" || name == "ifdef" || name == "ifndef") {
+                    depth++;
+                } else if (name == "else" || name == "elif" || name == "endif") {
+                    if (name == "endif")
+                        depth = std::max(depth - 1, 0);
+                    out.append(*source, pos, end - pos);
+                    out += '\n';
+                    if (resync)
+                        out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceNumber) + "\n";
+                    resync = resync && depth > 0;
+                    pos = end + 1;
+                    continue;
+                }
+                // "#include" followed by a blank or the file name, not just any directive starting with it
+                if (name == "include") {
+                    size_t open = source->find_first_of("\"<", directive + 7);
+                    size_t close = open < end ? source->find_first_of("\">", open + 1) : std::string::npos;
+                    if (close >= end) {
+                        std::cout << "ERROR::PREPROCESSOR::BAD_INCLUDE " << path << ":" << lineNumber << std::endl;
+                    } else {
+                        std::string file = normalize(directory + source->substr(open + 1, close - open - 1));
+                        if (!included.count(file)) {
+                            if (std::find(includes.begin(), includes.end(), file) == includes.end())
+                                includes.push_back(file);
+                            size_t number = std::find(includes.begin(), includes.end(), file) - includes.begin() + 1;
+                            out += "#line 1 " + std::to_string(number) + "\n";
+                            expandFile(file, number, out, included, includes);
+                            resync = resync || depth > 0;
+                            out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceNumber) + "\n";
+                            pos = end + 1;
+                            continue;
+                        }
+                    }
+                    // already included: keep the line count
+                    out += '\n';
+                    pos = end + 1;
+                    continue;
+                }
+            }
+            out.append(*source, pos, end - pos);
+            out += '\n';
+            pos = end + 1;
+        }
+    }
+
+    static std::string identifier(const std::string &text) {
+        size_t start = text.find_first_not_of(" \t");
+        if (start == std::string::npos)
+            return "";
+        size_t end = start;
+        while (end < text.size() && (std::isalnum((unsigned char)text[end]) || text[end] == '_'))
+            end++;
+        return text.substr(start, end - start);
+    }
+
+    static std::set<std::string> identifiers(const std::string &text) {
+        std::set<std::string> names;
+        for (size_t i = 0; i < text.size(); ) {
+            // names in comments don't need their define
+            if (text.compare(i, 2, "//") == 0) {
+                i = std::min(text.find('\n', i), text.size());
+            } else if (text.compare(i, 2, "/*") == 0) {
+                i = std::min(text.find("*/", i + 2), text.size());
+            } else if (std::isalpha((unsigned char)text[i]) || text[i] == '_') {
+                size_t start = i;
+                while (i < text.size() && (std::isalnum((unsigned char)text[i]) || text[i] == '_'))
+                    i++;
+                names.insert(text.substr(start, i - start));
+            } else if (std::isdigit((unsigned char)text[i])) {
+                // don't pick up suffixes like the f in 1.0f
+                while (i < text.size() && (std::isalnum((unsigned char)text[i]) || text[i] == '.'))
+                    i++;
+            } else {
+                i++;
+            }
+        }
+        return names;
+    }
+
+    // #if expressions: integers, defined(X) / defined X, macros (flags count as 1, unknown names as 0),
+    // ! - + * / % < > <= >= == != && || and parentheses
+    struct Expression {
+        const std::string &text;
+        const std::map<std::string, std::string> &macros;
+        size_t pos;
+        bool failed;
+
+        void skip() {
+            while (pos < text.size() && std::isspace((unsigned char)text[pos]))
+                pos++;
+        }
+        bool accept(const char *op) {
+            skip();
+            size_t n = std::char_traits<char>::length(op);
+            if (text.compare(pos, n, op) != 0)
+                return false;
+            // don't read the first half of <= or != as < or !
+            if (n == 1 && pos + 1 < text.size() && text[pos + 1] == '=' &&
+                (op[0] == '<' || op[0] == '>' || op[0] == '!'))
+                return false;
+            pos += n;
+            return true;
+        }
+        long primary() {
+            skip();
+            if (accept("(")) {
+                long value = logicalOr();
+                if (!accept(")"))
+                    failed = true;
+                return value;
+            }
+            if (accept("!"))
+                return !primary();
+            if (accept("-"))
+                return -primary();
+            if (accept("+"))
+                return primary();
+            if (pos < text.size() && std::isdigit((unsigned char)text[pos])) {
+                char *end;
+                long value = std::strtol(text.c_str() + pos, &end, 0);
+                pos = end - text.c_str();
+                while (pos < text.size() && std::isalpha((unsigned char)text[pos]))
+                    pos++;
+                return value;
+            }
+            std::string name = ShaderPreprocessor::identifier(text.substr(pos));
+            if (name.empty()) {
+                failed = true;
+                return 0;
+            }
+            pos = text.find(name, pos) + name.size();
+            if (name == "defined") {
+                bool parens = accept("(");
+                skip();
+                std::string macro = ShaderPreprocessor::identifier(text.substr(pos));
+                pos = text.find(macro, pos) + macro.size();
+                if (macro.empty() || (parens && !accept(")")))
+                    failed = true;
+                return macros.count(macro);
+            }
+            auto macro = macros.find(name);
+            if (macro == macros.end())
+                return 0;
+            if (macro->second.empty())
+                return 1;
+            return std::strtol(macro->second.c_str(), nullptr, 0);
+        }
+        long multiplicative() {
+            long value = primary();
+            while (true) {
+                if (accept("*")) {
+                    value *= primary();
+                } else if (accept("/") || accept("%")) {
+                    bool modulo = text[pos - 1] == '%';
+                    long divisor = primary();
+                    if (divisor == 0) {
+                        failed = true;
+                        return 0;
+                    }
+                    value = modulo ? value % divisor : value / divisor;
+                } else {
+                    return value;
+                }
+            }
+        }
+        long additive() {
+            long value = multiplicative();
+            while (true) {
+                if (accept("+"))
+                    value += multiplicative();
+                else if (accept("-"))
+                    value -= multiplicative();
+                else
+                    return value;
+            }
+        }
+        long relational() {
+            long value = additive();
+            while (true) {
+                if (accept("<="))
+                    value = value <= additive();
+                else if (accept(">="))
+                    value = value >= additive();
+                else if (accept("<"))
+                    value = value < additive();
+                else if (accept(">"))
+                    value = value > additive();
+                else
+                    return value;
+            }
+        }
+        long equality() {
+            long value = relational();
+            while (true) {
+                if (accept("=="))
+                    value = value == relational();
+                else if (accept("!="))
+                    value = value != relational();
+                else
+                    return value;
+            }
+        }
+        long logicalAnd() {
+            long value = equality();
+            while (accept("&&")) {
+                long rhs = equality();
+                value = value && rhs;
+            }
+            return value;
+        }
+        long logicalOr() {
+            long value = logicalAnd();
+            while (accept("||")) {
+                long rhs = logicalAnd();
+                value = value || rhs;
+            }
+            return value;
+        }
+    };
+
+    static long evaluate(const std::string &text, const std::map<std::string, std::string> &macros, int line) {
+        // trailing // comments aren't part of the expression
+        std::string expression = text.substr(0, text.find("//"));
+        Expression parser{expression, macros, 0, false};
+        long value = parser.logicalOr();
+        parser.skip();
+        if (parser.failed || parser.pos != expression.size()) {
+            std::cout << "ERROR::PREPROCESSOR::UNSUPPORTED_EXPRESSION line " << line << ":" << text << std::endl;
+            return 0;
+        }
+        return value;
+    }
+};
+
+#endif //OPENGL_REVIEW_SHADERPREPROCESSOR_H
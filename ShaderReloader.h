@@ -0,0 +1,258 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_SHADERRELOADER_H
+#define OPENGL_REVIEW_SHADERRELOADER_H
+
+#include <glad.h>
+#include <GLFW/glfw3.h>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "Shader.h"
+
+/*
+ * Rebuilds Shader programs when their files change on disk, without blocking the render loop.
+ *  > inotify watches the directories of every watched Shader's files and #includes (editors often save by renaming
+ *    over the file), a changed include rebuilds every Shader that includes it
+ *  > with KHR/ARB_parallel_shader_compile the rebuild is submitted from update() and polled there every frame
+ *  > otherwise a worker thread with its own hidden context, sharing objects with the main window, builds it; except
+ *    in GLAD_TRACE and GLAD_LAZY_LOAD builds, which must call GL from one thread only (plain trace counters, entry
+ *    points written on first call): there update() builds it on the render thread, a one frame stall per reload
+ *  > update() (once per frame, render thread) swaps Shader::ID to the new program between frames and deletes the old
+ * If the new sources don't compile or link, the errors are printed and the old program stays in use.
+ * Shaders from ShaderVariants can't be watched: their programs belong to the variants cache.
+ * Only Linux has a watcher; elsewhere update() does nothing.
+ */
+class ShaderReloader {
+public:
+    // must be constructed and stopped on the main thread (GLFW window rules)
+    explicit ShaderReloader(GLFWwindow *window) {
+#ifdef __linux__
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0) {
+            std::cout << "ERROR::RELOADER::INOTIFY_INIT_FAILED" << std::endl;
+            return;
+        }
+        // the driver compiles in the background for us, no second context needed
+        if (Shader::parallelCompileSupported())
+            return;
+#if defined(GLAD_TRACE) || defined(GLAD_LAZY_LOAD)
+        return;
+#endif
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        workerWindow = glfwCreateWindow(1, 1, "ShaderReloader", NULL, window);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+        if (workerWindow == nullptr) {
+            std::cout << "ERROR::RELOADER::SHARED_CONTEXT_FAILED" << std::endl;
+            close(inotifyFd);
+            inotifyFd = -1;
+            return;
+        }
+        worker = std::thread(&ShaderReloader::work, this);
+#endif
+    }
+    ~ShaderReloader() {
+        stop();
+    }
+
+    void watch(Shader &shader) {
+#ifdef __linux__
+        if (inotifyFd < 0)
+            return;
+        // swapping its ID would delete a program the variants cache still hands out (and deletes again)
+        if (shader.sharedProgram) {
+            std::cout << "ERROR::RELOADER::SHARED_PROGRAM " << shader.files[0] << std::endl;
+            return;
+        }
+        shaders.push_back(&shader);
+        watchFiles(shader);
+#endif
+    }
+
+    // render thread, once per frame: queue rebuilds for changed files and swap in finished programs
+    void update() {
+#ifdef __linux__
+        std::set<std::string> changed = changedFiles();
+        // the next build has to see the new contents
+        for (const std::string &file : changed)
+            ShaderPreprocessor::invalidate(file);
+        if (!changed.empty() && !worker.joinable()) {
+            for (Shader *shader : shaders)
+                if (dependsOn(*shader, changed)) {
+                    Job job{shader, *shader, 0};
+                    job.sources.includes.clear();
+                    Shader::Pending build = Shader::submit(job.sources.source(0, &job.sources.includes),
+                                                           job.sources.source(1, &job.sources.includes));
+                    inFlight.push_back({job, build});
+                }
+        } else if (!changed.empty()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (Shader *shader : shaders)
+                if (dependsOn(*shader, changed))
+                    pending.push_back({shader, *shader, 0});
+            wake.notify_one();
+        }
+
+        std::deque<Job> finished;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.swap(done);
+        }
+        for (size_t i = 0; i < inFlight.size(); ) {
+            if (!Shader::completed(inFlight[i].pending)) {
+                ++i;
+                continue;
+            }
+            inFlight[i].job.program = Shader::finish(inFlight[i].pending);
+            if (inFlight[i].job.program != 0)
+                finished.push_back(inFlight[i].job);
+            inFlight.erase(inFlight.begin() + i);
+        }
+        for (const Job &job : finished) {
+            glDeleteProgram(job.shader->ID);
+            job.shader->ID = job.program;
+            // includes may have been added or removed
+            job.shader->includes = job.sources.includes;
+            watchFiles(*job.shader);
+            std::cout << "Reloaded " << job.sources.files[0] << std::endl;
+        }
+#endif
+    }
+
+    // joins the worker and destroys its context, call before glfwTerminate
+    void stop() {
+#ifdef __linux__
+        if (worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_one();
+            worker.join();
+        }
+        if (workerWindow != nullptr) {
+            glfwDestroyWindow(workerWindow);
+            workerWindow = nullptr;
+        }
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+        // built but never swapped in
+        for (const Job &job : done)
+            glDeleteProgram(job.program);
+        done.clear();
+        for (InFlight &build : inFlight)
+            glDeleteProgram(Shader::finish(build.pending));
+        inFlight.clear();
+#endif
+    }
+
+private:
+    struct Job {
+        Shader *shader;
+        Shader sources; // copy of files + defines, so the worker never touches the watched Shader
+        unsigned int program;
+    };
+    struct InFlight {
+        Job job;
+        Shader::Pending pending;
+    };
+
+    std::vector<Shader*> shaders;
+    std::map<int, std::string> watchedDirs; // inotify watch descriptor -> directory
+    GLFWwindow *workerWindow = nullptr;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Job> pending, done;
+    std::vector<InFlight> inFlight; // parallel_shader_compile builds, polled by update()
+    bool stopping = false;
+    int inotifyFd = -1;
+
+    static std::string directoryOf(const std::string &file) {
+        size_t slash = file.find_last_of('/');
+        return slash == std::string::npos ? "." : file.substr(0, slash);
+    }
+
+    static bool dependsOn(const Shader &shader, const std::set<std::string> &changed) {
+        for (const std::string &file : shader.files)
+            if (changed.count(ShaderPreprocessor::normalize(file)))
+                return true;
+        for (const std::string &file : shader.includes)
+            if (changed.count(file))
+                return true;
+        return false;
+    }
+
+#ifdef __linux__
+    void watchFiles(const Shader &shader) {
+        std::vector<std::string> all = shader.files;
+        all.insert(all.end(), shader.includes.begin(), shader.includes.end());
+        for (const std::string &file : all) {
+            std::string dir = directoryOf(ShaderPreprocessor::normalize(file));
+            // watching a directory twice hands back the same descriptor
+            int wd = inotify_add_watch(inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if (wd >= 0)
+                watchedDirs[wd] = dir;
+        }
+    }
+
+    // drain inotify without blocking, returns the written files (normalized, like Shader::includes)
+    std::set<std::string> changedFiles() {
+        std::set<std::string> changed;
+        alignas(inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char *p = buffer; p < buffer + length; ) {
+                const inotify_event *event = (const inotify_event*)p;
+                auto dir = watchedDirs.find(event->wd);
+                if (event->len > 0 && dir != watchedDirs.end())
+                    changed.insert(dir->second == "." ? std::string(event->name) : dir->second + "/" + event->name);
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+        return changed;
+    }
+
+    void work() {
+        glfwMakeContextCurrent(workerWindow);
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (stopping)
+                break;
+            Job job = pending.front();
+            pending.pop_front();
+            lock.unlock();
+
+            job.sources.includes.clear();
+            job.program = Shader::build(job.sources.source(0, &job.sources.includes),
+                                        job.sources.source(1, &job.sources.includes));
+            // the render thread may use the program as soon as it sees it
+            glFinish();
+
+            lock.lock();
+            if (job.program != 0)
+                done.push_back(job);
+        }
+        glfwMakeContextCurrent(nullptr);
+    }
+#endif
+};
+
+#endif //OPENGL_REVIEW_SHADERRELOADER_H
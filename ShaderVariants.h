@@ -0,0 +1,83 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_SHADERVARIANTS_H
+#define OPENGL_REVIEW_SHADERVARIANTS_H
+
+#include <glad.h>
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Shader.h"
+
+/*
+ * All permutations of one vertex/fragment pair, instead of a hand copied file per feature combination.
+ *  > get({"FLIP_Y", "OFFSET_X"}) resolves both sources for that define set (ShaderPreprocessor) and builds the program
+ *  > define sets are cached in any order: {"A", "B"} and {"B", "A"} are the same variant
+ *  > define sets that resolve to the same code (e.g. a define neither file tests) share one program
+ * Sources are read once, when the first variant is requested. The programs belong to the ShaderVariants: call
+ * deletePrograms() before glfwTerminate, after which none of the Shaders it handed out may be used.
+ */
+class ShaderVariants {
+public:
+    ShaderVariants(const char* vertexPath, const char* fragmentPath) : files{vertexPath, fragmentPath} {}
+    ShaderVariants(const ShaderVariants&) = delete;
+    ShaderVariants &operator=(const ShaderVariants&) = delete;
+
+    // ID is 0 if the variant doesn't build (the errors are printed once, later calls return the cached 0)
+    Shader &get(std::vector<std::string> defines) {
+        std::sort(defines.begin(), defines.end());
+        defines.erase(std::unique(defines.begin(), defines.end()), defines.end());
+        auto cached = variants.find(defines);
+        if (cached != variants.end())
+            return cached->second;
+
+        if (sources.empty())
+            for (const std::string &file : files)
+                sources.push_back(Shader::readFile(file, &includes));
+        std::string vertexCode = ShaderPreprocessor::resolve(sources[0], defines);
+        std::string fragmentCode = ShaderPreprocessor::resolve(sources[1], defines);
+        // '\0' can't appear in GLSL, so it can't make two different pairs look the same
+        std::string key = vertexCode + '\0' + fragmentCode;
+        auto program = programs.find(key);
+        if (program == programs.end())
+            program = programs.emplace(key, Shader::build(vertexCode, fragmentCode)).first;
+        Shader &shader = variants.emplace(defines, Shader(program->second, files, defines)).first->second;
+        shader.includes = includes;
+        shader.sharedProgram = true;
+        return shader;
+    }
+    Shader &get(std::initializer_list<const char*> defines) {
+        return get(std::vector<std::string>(defines.begin(), defines.end()));
+    }
+
+    void deletePrograms() {
+        for (const auto &program : programs)
+            glDeleteProgram(program.second);
+        programs.clear();
+        variants.clear();
+    }
+
+    // distinct define sets asked for so far
+    size_t variantCount() const {
+        return variants.size();
+    }
+    // programs actually compiled (<= variantCount)
+    size_t programCount() const {
+        return programs.size();
+    }
+
+private:
+    std::vector<std::string> files;
+    std::vector<std::string> sources;
+    std::vector<std::string> includes;
+    std::map<std::vector<std::string>, Shader> variants;
+    std::map<std::string, unsigned int> programs; // resolved vertex + fragment source -> program
+};
+
+#endif //OPENGL_REVIEW_SHADERVARIANTS_H
@@ -0,0 +1,149 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_THREADPOOL_H
+#define OPENGL_REVIEW_THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Fixed set of worker threads for data parallel loops (mesh import, culling, per-frame updates).
+ *  > parallelFor(count, fn) calls fn(begin, end, worker) on ranges covering [0, count) and returns when all are done
+ *  > the calling thread works too, as worker 0; pool threads are 1 .. size()-1, so per-thread scratch can be
+ *    indexed by worker
+ *  > one loop at a time: parallelFor from inside a loop (or from another thread while one runs) runs serially
+ *  > fn is called through a plain function pointer, never copied, so a loop allocates nothing whatever fn captures
+ * Threads sleep on a condition variable between loops.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency()) {
+        threads = std::max(threads, 1u);
+        for (unsigned i = 1; i < threads; ++i)
+            workers.emplace_back(&ThreadPool::work, this, i);
+    }
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker : workers)
+            worker.join();
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool &operator=(const ThreadPool&) = delete;
+
+    // one pool for everything that doesn't need its own
+    static ThreadPool &shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    unsigned size() const {
+        return unsigned(workers.size()) + 1;
+    }
+
+    // fn(size_t begin, size_t end, unsigned worker); ranges are at least minRange long, about 4 per thread so uneven
+    // ranges even out
+    template<class Fn>
+    void parallelFor(size_t count, const Fn &fn, size_t minRange = 1) {
+        if (count == 0)
+            return;
+        size_t rangeSize = std::max(minRange, (count + size() * 4 - 1) / (size() * 4));
+        size_t ranges = (count + rangeSize - 1) / rangeSize;
+        std::unique_lock<std::mutex> busy(running, std::try_to_lock);
+        if (ranges == 1 || workers.empty() || insideLoop() || !busy.owns_lock()) {
+            fn(0, count, 0);
+            return;
+        }
+        Job current = {&fn, &callRange<Fn>, count, rangeSize, ranges};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = current;
+            next = 0;
+            remaining = ranges;
+            generation++;
+        }
+        wake.notify_all();
+
+        insideLoop() = true;
+        runRanges(current, 0);
+        insideLoop() = false;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return remaining == 0 && active == 0; });
+        job = Job();
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex running; // held for the whole of a parallelFor
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    bool stopping = false;
+    uint64_t generation = 0;
+    unsigned active = 0; // workers inside the current loop
+
+    // the current loop, written and read under mutex; runRanges works on a copy
+    struct Job {
+        const void *fn = nullptr;
+        void (*call)(const void *fn, size_t begin, size_t end, unsigned worker) = nullptr;
+        size_t count = 0, rangeSize = 0, ranges = 0;
+    };
+    Job job;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> remaining{0};
+
+    template<class Fn>
+    static void callRange(const void *fn, size_t begin, size_t end, unsigned worker) {
+        (*static_cast<const Fn*>(fn))(begin, end, worker);
+    }
+
+    static bool &insideLoop() {
+        thread_local bool inside = false;
+        return inside;
+    }
+
+    void runRanges(const Job &loop, unsigned worker) {
+        size_t range;
+        while ((range = next.fetch_add(1)) < loop.ranges) {
+            size_t begin = range * loop.rangeSize;
+            loop.call(loop.fn, begin, std::min(loop.count, begin + loop.rangeSize), worker);
+            if (remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+    }
+
+    void work(unsigned worker) {
+        insideLoop() = true;
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            active++;
+            Job current = job;
+            lock.unlock();
+            runRanges(current, worker);
+            lock.lock();
+            active--;
+            if (active == 0)
+                done.notify_all();
+        }
+    }
+};
+
+#endif //OPENGL_REVIEW_THREADPOOL_H
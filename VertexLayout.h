@@ -0,0 +1,164 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_VERTEXLAYOUT_H
+#define OPENGL_REVIEW_VERTEXLAYOUT_H
+
+#include <glad.h>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GLObjects.h"
+#include "ProgramReflection.h"
+
+/*
+ * Interleaved vertex format described by attribute name, with locations taken from the program instead of hardcoded.
+ *  > attribute("aPos", 3).attribute("aTexCoord", 2)   in buffer order, offsets and stride are worked out
+ *  > validate(shader.reflection())                   once per layout + program: every active attribute has to be fed
+ *                                                    with the right kind of data and component count
+ *  > createVertexArray(VBO, EBO)                     per mesh, no checks left to do; the VAO comes from the
+ *                                                    GLObjectPool, a recycled one has its old attributes disabled
+ * GL 3.3 VAOs keep the buffer they read from, so each mesh still gets its own VAO; what's shared is the checked format.
+ */
+class VertexLayout {
+public:
+    // packed 10-10-10-2 types are always 4 components (the shader may read fewer)
+    VertexLayout &attribute(const std::string &name, int components, GLenum type = GL_FLOAT, bool normalized = false) {
+        attributes.push_back({name, components, type, normalized, size_t(stride), -1, 1, false});
+        stride += packed(type) ? 4 : components * typeSize(type);
+        return *this;
+    }
+
+    // padding bytes after the previous attribute
+    VertexLayout &skip(int bytes) {
+        stride += bytes;
+        return *this;
+    }
+
+    bool validate(const ProgramReflection &program) {
+        valid = program.program != 0;
+        for (Attribute &attribute : attributes) {
+            const ProgramReflection::Attribute *active = program.attribute(attribute.name);
+            attribute.location = -1;
+            // not used by this program (or optimized out): the data is simply not read
+            if (active == nullptr)
+                continue;
+            GLenum expected = ProgramReflection::componentType(active->type);
+            // float attributes take anything (converted, or normalized if asked), int/uint ones only plain integers
+            bool integerData = attribute.type != GL_FLOAT && attribute.type != GL_HALF_FLOAT &&
+                               attribute.type != GL_DOUBLE && !packed(attribute.type) && !attribute.normalized;
+            attribute.integer = expected == GL_INT || expected == GL_UNSIGNED_INT;
+            int shaderComponents = ProgramReflection::components(active->type);
+            attribute.slots = ProgramReflection::locations(active->type);
+            if ((attribute.integer && !integerData) || (expected == GL_DOUBLE) != (attribute.type == GL_DOUBLE)) {
+                std::cout << "ERROR::VERTEX_LAYOUT::TYPE_MISMATCH " << attribute.name << std::endl;
+                valid = false;
+            } else if (attribute.components != shaderComponents * attribute.slots && !packed(attribute.type) &&
+                       // vec4 fed from 3 components gets w = 1
+                       !(shaderComponents == 4 && attribute.slots == 1 && attribute.components == 3)) {
+                std::cout << "ERROR::VERTEX_LAYOUT::COMPONENT_MISMATCH " << attribute.name << " has "
+                          << attribute.components << ", shader reads " << shaderComponents * attribute.slots << std::endl;
+                valid = false;
+            } else {
+                attribute.location = active->location;
+            }
+        }
+        for (const ProgramReflection::Attribute &active : program.attributes) {
+            bool fed = false;
+            for (const Attribute &attribute : attributes)
+                fed = fed || attribute.name == active.name;
+            if (!fed) {
+                // would silently read the current generic attribute value (usually 0)
+                std::cout << "ERROR::VERTEX_LAYOUT::ATTRIBUTE_MISSING " << active.name << std::endl;
+                valid = false;
+            }
+        }
+        return valid;
+    }
+
+    // empty unless validate() passed; binds nothing afterwards
+    GLVertexArray createVertexArray(unsigned int vertexBuffer, unsigned int elementBuffer = 0,
+                                    GLObjectPool &pool = GLObjectPool::shared()) const {
+        if (!valid) {
+            std::cout << "ERROR::VERTEX_LAYOUT::NOT_VALIDATED" << std::endl;
+            return GLVertexArray();
+        }
+        GLVertexArray vao = GLVertexArray::create(pool);
+        glBindVertexArray(vao.id());
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        GLint maxAttributes = 0;
+        glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttributes);
+        std::vector<bool> enabled(size_t(std::max(maxAttributes, 0)), false);
+        for (const Attribute &attribute : attributes) {
+            if (attribute.location < 0)
+                continue;
+            int perSlot = attribute.components / attribute.slots;
+            for (int slot = 0; slot < attribute.slots; ++slot) {
+                unsigned int location = attribute.location + slot;
+                const void *offset = (const void*)(attribute.offset + slot * perSlot * typeSize(attribute.type));
+                if (attribute.type == GL_DOUBLE)
+                    glVertexAttribLPointer(location, perSlot, attribute.type, stride, offset);
+                else if (attribute.integer)
+                    glVertexAttribIPointer(location, perSlot, attribute.type, stride, offset);
+                else
+                    glVertexAttribPointer(location, perSlot, attribute.type, attribute.normalized, stride, offset);
+                glVertexAttribDivisor(location, 0);
+                glEnableVertexAttribArray(location);
+                if (location < enabled.size())
+                    enabled[location] = true;
+            }
+        }
+        // a recycled VAO still has whatever its last user enabled, which would be read from a stale buffer
+        for (size_t location = 0; location < enabled.size(); ++location)
+            if (!enabled[location])
+                glDisableVertexAttribArray(GLuint(location));
+        // the element buffer binding is VAO state, so it has to be bound while the VAO is (0 drops a recycled one's)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return vao;
+    }
+
+    int vertexSize() const {
+        return stride;
+    }
+
+private:
+    struct Attribute {
+        std::string name;
+        int components;
+        GLenum type;
+        bool normalized;
+        size_t offset;
+        int location;
+        int slots; // locations taken (matrices take one per column)
+        bool integer; // int/uint in the shader: glVertexAttribIPointer
+    };
+    std::vector<Attribute> attributes;
+    int stride = 0;
+    bool valid = false;
+
+    // 10-10-10-2: all four components in one 32 bit word
+    static bool packed(GLenum type) {
+        return type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV;
+    }
+
+    static int typeSize(GLenum type) {
+        switch (type) {
+            case GL_BYTE: case GL_UNSIGNED_BYTE:
+                return 1;
+            case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT:
+                return 2;
+            case GL_DOUBLE:
+                return 8;
+            default:
+                return 4;
+        }
+    }
+};
+
+#endif //OPENGL_REVIEW_VERTEXLAYOUT_H
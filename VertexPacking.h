@@ -0,0 +1,130 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_VERTEXPACKING_H
+#define OPENGL_REVIEW_VERTEXPACKING_H
+
+#include <glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "Mesh.h"
+#include "Shader.h"
+#include "VertexLayout.h"
+
+/*
+ * Quantized vertex buffer for a Mesh: 8 bytes of position, +4 for UVs, +4 for normals (instead of 12 + 8 + 12).
+ *  > positions: 16 bit unorm inside the mesh bounds (+2 bytes padding to keep vertices 4 byte aligned), the vertex
+ *    shader turns them back with dequantizePosition() from shaders/quantization.glsl (QUANTIZED variant)
+ *  > uvs:       half floats
+ *  > normals:   snorm 10-10-10-2 (GL_INT_2_10_10_10_REV)
+ * The report says what that cost: worst and mean error of every attribute against the float mesh.
+ */
+struct PackedMesh {
+    std::vector<uint8_t> vertices;
+    int vertexSize = 0;
+    size_t vertexCount = 0;
+    bool hasUVs = false, hasNormals = false;
+    // dequantized position = boundsMin + unorm * boundsExtent
+    glm::vec3 boundsMin = glm::vec3(0.0f), boundsExtent = glm::vec3(0.0f);
+
+    struct Report {
+        size_t bytesBefore = 0, bytesAfter = 0;
+        float maxPositionError = 0.0f, meanPositionError = 0.0f; // object space units
+        float maxUVError = 0.0f;
+        float maxNormalError = 0.0f; // degrees
+    } report;
+
+    static PackedMesh pack(const Mesh &mesh) {
+        PackedMesh packed;
+        packed.vertexCount = mesh.positions.size();
+        packed.hasUVs = mesh.uvs.size() == mesh.positions.size() && !mesh.uvs.empty();
+        packed.hasNormals = mesh.normals.size() == mesh.positions.size() && !mesh.normals.empty();
+        packed.vertexSize = 8 + (packed.hasUVs ? 4 : 0) + (packed.hasNormals ? 4 : 0);
+        packed.vertices.resize(packed.vertexCount * packed.vertexSize);
+
+        Mesh::Bounds bounds = mesh.bounds();
+        packed.boundsMin = bounds.min;
+        packed.boundsExtent = bounds.max - bounds.min;
+
+        Report &report = packed.report;
+        report.bytesBefore = packed.vertexCount * (12 + (packed.hasUVs ? 8 : 0) + (packed.hasNormals ? 12 : 0));
+        report.bytesAfter = packed.vertices.size();
+        double positionErrorSum = 0.0;
+
+        for (size_t i = 0; i < packed.vertexCount; ++i) {
+            uint8_t *out = &packed.vertices[i * packed.vertexSize];
+            const glm::vec3 &p = mesh.positions[i];
+            uint16_t position[4] = {0, 0, 0, 0};
+            glm::vec3 restored;
+            for (int axis = 0; axis < 3; ++axis) {
+                float extent = packed.boundsExtent[axis];
+                position[axis] = glm::packUnorm1x16(extent > 0.0f ? (p[axis] - bounds.min[axis]) / extent : 0.0f);
+                restored[axis] = bounds.min[axis] + glm::unpackUnorm1x16(position[axis]) * extent;
+            }
+            memcpy(out, position, sizeof(position));
+            out += sizeof(position);
+            float error = glm::length(restored - p);
+            report.maxPositionError = std::max(report.maxPositionError, error);
+            positionErrorSum += error;
+
+            if (packed.hasUVs) {
+                uint32_t uv = glm::packHalf2x16(mesh.uvs[i]);
+                memcpy(out, &uv, sizeof(uv));
+                out += sizeof(uv);
+                glm::vec2 delta = glm::unpackHalf2x16(uv) - mesh.uvs[i];
+                report.maxUVError = std::max(report.maxUVError, std::max(std::fabs(delta.x), std::fabs(delta.y)));
+            }
+            if (packed.hasNormals) {
+                glm::vec3 n = mesh.normals[i];
+                float length = glm::length(n);
+                n = length > 0.0f ? n / length : glm::vec3(0.0f, 0.0f, 1.0f);
+                uint32_t normal = glm::packSnorm3x10_1x2(glm::vec4(n, 0.0f));
+                memcpy(out, &normal, sizeof(normal));
+                glm::vec4 restoredNormal = glm::unpackSnorm3x10_1x2(normal);
+                glm::vec3 r = glm::normalize(glm::vec3(restoredNormal.x, restoredNormal.y, restoredNormal.z));
+                float angle = std::acos(glm::clamp(glm::dot(r, n), -1.0f, 1.0f)) * 57.2957795f;
+                report.maxNormalError = std::max(report.maxNormalError, angle);
+            }
+        }
+        report.meanPositionError = packed.vertexCount ? float(positionErrorSum / packed.vertexCount) : 0.0f;
+        return packed;
+    }
+
+    // aPos (vec3), aTexCoord (vec2) and aNormal (vec3) as far as the mesh has them
+    VertexLayout layout() const {
+        VertexLayout layout;
+        layout.attribute("aPos", 3, GL_UNSIGNED_SHORT, true).skip(2);
+        if (hasUVs)
+            layout.attribute("aTexCoord", 2, GL_HALF_FLOAT);
+        if (hasNormals)
+            layout.attribute("aNormal", 4, GL_INT_2_10_10_10_REV, true);
+        return layout;
+    }
+
+    // bounds for dequantizePosition(), the shader has to be in use
+    void setUniforms(const Shader &shader) const {
+        shader.setVec3("boundsMin", boundsMin);
+        shader.setVec3("boundsExtent", boundsExtent);
+    }
+
+    void printReport() const {
+        std::cout << "Packed " << vertexCount << " vertices: " << report.bytesBefore << " -> " << report.bytesAfter
+                  << " bytes (" << 100.0f * report.bytesAfter / std::max<size_t>(report.bytesBefore, 1) << "%)\n"
+                  << "  position error max " << report.maxPositionError << " mean " << report.meanPositionError;
+        if (hasUVs)
+            std::cout << ", uv error max " << report.maxUVError;
+        if (hasNormals)
+            std::cout << ", normal error max " << report.maxNormalError << " deg";
+        std::cout << std::endl;
+    }
+};
+
+#endif //OPENGL_REVIEW_VERTEXPACKING_H
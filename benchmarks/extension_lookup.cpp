@@ -0,0 +1,115 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <glad.h>
+
+/*
+ * Extension detection cost per context creation, without a window or a real driver.
+ * A fake driver reports NR_EXTENSIONS names through glGetIntegerv/glGetStringi (the extensions glad.c looks for
+ * are reported last, which is the worst case for a linear scan) and gladLoadGLLoader is run against it.
+ *  > linear: glad's previous approach, copy every name and strcmp through the whole list per query
+ *  > hashed: glad.c as built now, each reported name is length-filtered and hashed into the table from glad_ext_hash.h
+ * Linked against GLAD_lazy so gladLoadGLLoader doesn't also spend its time resolving ~700 function pointers.
+ */
+
+extern "C" int GLAD_GL_ARB_parallel_shader_compile;
+extern "C" int GLAD_GL_KHR_parallel_shader_compile;
+
+// Settings
+const int NR_EXTENSIONS = 460;
+const int ITERATIONS = 2000;
+
+std::vector<std::string> driverExtensions;
+
+const GLubyte* APIENTRY fakeGetString(GLenum name) {
+    return (const GLubyte*)(name == GL_VERSION ? "4.6.0 FakeDriver" : "");
+}
+const GLubyte* APIENTRY fakeGetStringi(GLenum name, GLuint index) {
+    if (name != GL_EXTENSIONS || index >= driverExtensions.size())
+        return NULL;
+    return (const GLubyte*)driverExtensions[index].c_str();
+}
+void APIENTRY fakeGetIntegerv(GLenum pname, GLint *data) {
+    *data = pname == GL_NUM_EXTENSIONS ? (GLint)driverExtensions.size() : 0;
+}
+void* fakeLoad(const char *name) {
+    if (strcmp(name, "glGetString") == 0) return (void*)fakeGetString;
+    if (strcmp(name, "glGetStringi") == 0) return (void*)fakeGetStringi;
+    if (strcmp(name, "glGetIntegerv") == 0) return (void*)fakeGetIntegerv;
+    return NULL;
+}
+
+// previous glad.c detection, kept here as the baseline
+int linearDetect(const char **queries, int nrQueries) {
+    int num = 0;
+    fakeGetIntegerv(GL_NUM_EXTENSIONS, &num);
+    char **exts = (char**)malloc((size_t)num * sizeof(char*));
+    for (int i = 0; i < num; ++i) {
+        const char *str = (const char*)fakeGetStringi(GL_EXTENSIONS, i);
+        size_t len = strlen(str);
+        exts[i] = (char*)malloc(len + 1);
+        memcpy(exts[i], str, len + 1);
+    }
+    int found = 0;
+    for (int q = 0; q < nrQueries; ++q) {
+        for (int i = 0; i < num; ++i) {
+            if (strcmp(exts[i], queries[q]) == 0) {
+                found++;
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < num; ++i)
+        free(exts[i]);
+    free(exts);
+    return found;
+}
+
+double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+
+    const char *vendors[] = {"GL_ARB_", "GL_EXT_", "GL_NV_", "GL_AMD_", "GL_INTEL_", "GL_KHR_", "GL_OES_", "GL_MESA_"};
+    for (int i = 0; i < NR_EXTENSIONS - 2; ++i)
+        driverExtensions.push_back(std::string(vendors[i % 8]) + "fake_extension_" + std::to_string(i));
+    driverExtensions.push_back("GL_ARB_parallel_shader_compile");
+    driverExtensions.push_back("GL_KHR_parallel_shader_compile");
+    const char *queries[] = {"GL_ARB_parallel_shader_compile", "GL_KHR_parallel_shader_compile"};
+
+    int linearFound = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+        linearFound = linearDetect(queries, 2);
+    double linear = elapsedMicroseconds(start) / ITERATIONS;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+        gladLoadGLLoader((GLADloadproc)fakeLoad);
+    double hashed = elapsedMicroseconds(start) / ITERATIONS;
+    int hashedFound = GLAD_GL_ARB_parallel_shader_compile + GLAD_GL_KHR_parallel_shader_compile;
+
+    // what gladLoadGLLoader costs with no extensions at all, subtracted from the hashed time
+    std::vector<std::string> allExtensions;
+    allExtensions.swap(driverExtensions);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+        gladLoadGLLoader((GLADloadproc)fakeLoad);
+    double overhead = elapsedMicroseconds(start) / ITERATIONS;
+    driverExtensions.swap(allExtensions);
+
+    std::cout << "driver extensions: " << driverExtensions.size() << std::endl;
+    std::cout << "linear: " << linear << " us per context (" << linearFound << "/2 found)" << std::endl;
+    std::cout << "hashed: " << hashed - overhead << " us per context (" << hashedFound << "/2 found), loader overhead "
+              << overhead << " us" << std::endl;
+
+    return linearFound == 2 && hashedFound == 2 ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#define ALLOCATION_COUNTER_IMPLEMENTATION
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../AllocationCounter.h"
+#include "../FrameArena.h"
+#include "../Shader.h"
+
+/*
+ * Heap allocations per frame of the per-frame renderer work, without a window or a real driver.
+ * A fake driver reports one program's uniforms (model/view/projection, an array of point light structs and a mat4
+ * array) and swallows the glUniform calls. Every frame builds and sorts a draw list of NR_OBJECTS, computes their
+ * model matrices and sets the uniforms, twice:
+ *  > heap:  std::vector draw lists and std::string uniform names, the way the demos did it
+ *  > arena: FrameVector draw lists, names formatted on the stack and passed as views, FrameArena::resetAll() per frame
+ * After WARMUP frames (the arena sizes itself to the frame) the arena frames have to allocate nothing: the exit code
+ * is 1 otherwise.
+ */
+
+// Settings
+const int NR_OBJECTS = 2000;
+const int NR_LIGHTS = 8;
+const int NR_SHADOW_MATRICES = 4;
+const int WARMUP = 10;
+const int FRAMES = 200;
+
+struct FakeUniform {
+    char name[32];
+    GLenum type;
+    int size;
+};
+std::vector<FakeUniform> driverUniforms;
+
+void APIENTRY fakeGetProgramiv(GLuint, GLenum pname, GLint *params) {
+    if (pname == GL_ACTIVE_UNIFORMS)
+        *params = (GLint)driverUniforms.size();
+    else if (pname == GL_ACTIVE_UNIFORM_MAX_LENGTH)
+        *params = 32;
+    else
+        *params = 0;
+}
+void APIENTRY fakeGetActiveUniform(GLuint, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type,
+                                   GLchar *name) {
+    const FakeUniform &uniform = driverUniforms[index];
+    *length = (GLsizei)std::min(strlen(uniform.name), size_t(bufSize - 1));
+    memcpy(name, uniform.name, *length);
+    name[*length] = '\0';
+    *size = uniform.size;
+    *type = uniform.type;
+}
+void APIENTRY fakeGetActiveUniformsiv(GLuint, GLsizei, const GLuint *, GLenum, GLint *params) {
+    *params = -1;
+}
+GLint APIENTRY fakeGetUniformLocation(GLuint, const GLchar *name) {
+    int location = 0;
+    for (const FakeUniform &uniform : driverUniforms) {
+        size_t length = strlen(uniform.name);
+        // "shadowMatrices[0]" also answers for "shadowMatrices[2]", at location + 2
+        if (uniform.size > 1 && length > 3 && strncmp(name, uniform.name, length - 2) == 0)
+            return location + atoi(name + length - 2);
+        if (strcmp(name, uniform.name) == 0)
+            return location;
+        location += uniform.size;
+    }
+    return -1;
+}
+void APIENTRY fakeUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat *) {}
+void APIENTRY fakeUniform3fv(GLint, GLsizei, const GLfloat *) {}
+void APIENTRY fakeUseProgram(GLuint) {}
+const GLubyte* APIENTRY fakeGetString(GLenum name) {
+    return (const GLubyte*)(name == GL_VERSION ? "4.6.0 FakeDriver" : "");
+}
+void APIENTRY fakeGetIntegerv(GLenum, GLint *data) {
+    *data = 0;
+}
+void* fakeLoad(const char *name) {
+    if (strcmp(name, "glGetProgramiv") == 0) return (void*)fakeGetProgramiv;
+    if (strcmp(name, "glGetActiveUniform") == 0) return (void*)fakeGetActiveUniform;
+    if (strcmp(name, "glGetActiveUniformsiv") == 0) return (void*)fakeGetActiveUniformsiv;
+    if (strcmp(name, "glGetUniformLocation") == 0) return (void*)fakeGetUniformLocation;
+    if (strcmp(name, "glUniformMatrix4fv") == 0) return (void*)fakeUniformMatrix4fv;
+    if (strcmp(name, "glUniform3fv") == 0) return (void*)fakeUniform3fv;
+    if (strcmp(name, "glUseProgram") == 0) return (void*)fakeUseProgram;
+    if (strcmp(name, "glGetString") == 0) return (void*)fakeGetString;
+    if (strcmp(name, "glGetIntegerv") == 0) return (void*)fakeGetIntegerv;
+    return NULL;
+}
+
+struct DrawItem {
+    uint64_t key; // material in the high bits, depth below
+    uint32_t object;
+};
+
+glm::mat4 objectModel(int object, float time) {
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(float(object % 50), float(object / 50), 0.0f));
+    return glm::rotate(model, time + float(object), glm::vec3(1.0f, 0.3f, 0.5f));
+}
+uint64_t objectKey(int object, float time) {
+    return (uint64_t(object % 7) << 32) | uint32_t(float(object % 97) * 1000.0f + time);
+}
+
+// the previous way: containers and names from the heap, every frame
+void heapFrame(Shader &shader, float time) {
+    std::vector<DrawItem> draws;
+    std::vector<glm::mat4> models;
+    for (int i = 0; i < NR_OBJECTS; ++i) {
+        draws.push_back({objectKey(i, time), uint32_t(i)});
+        models.push_back(objectModel(i, time));
+    }
+    std::sort(draws.begin(), draws.end(), [](const DrawItem &a, const DrawItem &b) { return a.key < b.key; });
+    for (int i = 0; i < NR_LIGHTS; ++i) {
+        shader.setVec3(std::string("pointLights[") + std::to_string(i) + "].position", glm::vec3(float(i)));
+        shader.setVec3(std::string("pointLights[") + std::to_string(i) + "].color", glm::vec3(1.0f));
+    }
+    for (int i = 0; i < NR_SHADOW_MATRICES; ++i)
+        shader.setMat4(std::string("shadowMatrices[") + std::to_string(i) + "]", glm::mat4(1.0f));
+    for (const DrawItem &draw : draws)
+        shader.setMat4(std::string("model"), models[draw.object]);
+}
+
+void arenaFrame(Shader &shader, float time) {
+    FrameVector<DrawItem> draws;
+    FrameVector<glm::mat4> models;
+    draws.reserve(NR_OBJECTS);
+    models.reserve(NR_OBJECTS);
+    for (int i = 0; i < NR_OBJECTS; ++i) {
+        draws.push_back({objectKey(i, time), uint32_t(i)});
+        models.push_back(objectModel(i, time));
+    }
+    std::sort(draws.begin(), draws.end(), [](const DrawItem &a, const DrawItem &b) { return a.key < b.key; });
+    char name[64];
+    for (int i = 0; i < NR_LIGHTS; ++i) {
+        snprintf(name, sizeof(name), "pointLights[%d].position", i);
+        shader.setVec3(name, glm::vec3(float(i)));
+        snprintf(name, sizeof(name), "pointLights[%d].color", i);
+        shader.setVec3(name, glm::vec3(1.0f));
+    }
+    for (int i = 0; i < NR_SHADOW_MATRICES; ++i) {
+        snprintf(name, sizeof(name), "shadowMatrices[%d]", i);
+        shader.setMat4(name, glm::mat4(1.0f));
+    }
+    for (const DrawItem &draw : draws)
+        shader.setMat4("model", models[draw.object]);
+    FrameArena::resetAll();
+}
+
+double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+
+    driverUniforms.push_back({"model", GL_FLOAT_MAT4, 1});
+    driverUniforms.push_back({"projection", GL_FLOAT_MAT4, 1});
+    driverUniforms.push_back({"shadowMatrices[0]", GL_FLOAT_MAT4, NR_SHADOW_MATRICES});
+    driverUniforms.push_back({"view", GL_FLOAT_MAT4, 1});
+    for (int i = 0; i < NR_LIGHTS; ++i) {
+        FakeUniform position = {"", GL_FLOAT_VEC3, 1}, color = {"", GL_FLOAT_VEC3, 1};
+        snprintf(position.name, sizeof(position.name), "pointLights[%d].position", i);
+        snprintf(color.name, sizeof(color.name), "pointLights[%d].color", i);
+        driverUniforms.push_back(position);
+        driverUniforms.push_back(color);
+    }
+    gladLoadGLLoader((GLADloadproc)fakeLoad);
+    Shader shader(1, {"fake.vs", "fake.fs"}, {});
+    shader.use();
+    shader.reflection();
+
+    struct Result {
+        double microseconds = 0.0;
+        uint64_t allocations = 0, bytes = 0;
+    } heap, arena;
+    for (int frame = 0; frame < WARMUP + FRAMES; ++frame) {
+        float time = float(frame) / 60.0f;
+        AllocationCounter::Snapshot heapSnapshot;
+        auto start = std::chrono::steady_clock::now();
+        heapFrame(shader, time);
+        double heapTime = elapsedMicroseconds(start);
+        uint64_t heapAllocations = heapSnapshot.allocations(), heapBytes = heapSnapshot.bytes();
+
+        AllocationCounter::Snapshot arenaSnapshot;
+        start = std::chrono::steady_clock::now();
+        arenaFrame(shader, time);
+        double arenaTime = elapsedMicroseconds(start);
+        if (frame < WARMUP)
+            continue;
+        heap.microseconds += heapTime;
+        heap.allocations += heapAllocations;
+        heap.bytes += heapBytes;
+        arena.microseconds += arenaTime;
+        arena.allocations += arenaSnapshot.allocations();
+        arena.bytes += arenaSnapshot.bytes();
+    }
+
+    std::cout << "objects: " << NR_OBJECTS << ", frames: " << FRAMES << " (after " << WARMUP << " warmup)" << std::endl;
+    std::cout << "heap:  " << heap.microseconds / FRAMES << " us per frame, " << double(heap.allocations) / FRAMES
+              << " allocations (" << heap.bytes / FRAMES << " bytes) per frame" << std::endl;
+    std::cout << "arena: " << arena.microseconds / FRAMES << " us per frame, " << double(arena.allocations) / FRAMES
+              << " allocations (" << arena.bytes / FRAMES << " bytes) per frame, arena "
+              << FrameArena::local().capacity() << " bytes" << std::endl;
+
+    return arena.allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#include <iostream>
+#include <chrono>
+#include <glad.h>
+#include <GLFW/glfw3.h>
+
+/*
+ * Measures how long gladLoadGLLoader takes and how long the first frame's worth of GL calls takes afterwards.
+ * The same source is built twice (see CMakeLists.txt):
+ *  > glad_startup_eager: every entry point is resolved inside gladLoadGLLoader
+ *  > glad_startup_lazy:  glad.c built with GLAD_LAZY_LOAD, entry points resolve on their first call
+ * Compare the "load" + "first use" sums of both runs to see what a short-lived process actually pays.
+ */
+
+// Settings
+const int LOAD_ITERATIONS = 50;
+
+double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void firstUse() {
+    /// Roughly the set of GL functions a demo touches while setting up and drawing its first frame
+    int nrAttributes;
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &nrAttributes);
+    glViewport(0, 0, 800, 600);
+    glEnable(GL_DEPTH_TEST);
+
+    unsigned int VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    float vertices[] = {-0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.0f, 0.5f, 0.0f};
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFinish();
+
+    glDeleteTextures(1, &texture);
+    glDeleteBuffers(1, &VBO);
+    glDeleteVertexArrays(1, &VAO);
+}
+
+int main(int argc, char** argv) {
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE); // nothing is presented, so don't bother mapping the window
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    GLFWwindow* window = glfwCreateWindow(800, 600, "LoaderStartup", NULL, NULL);
+    if (window == nullptr) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    // the very first load is what a freshly spawned process pays, keep it separate from the warm average
+    auto start = std::chrono::steady_clock::now();
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    double coldLoad = elapsedMicroseconds(start);
+    start = std::chrono::steady_clock::now();
+    firstUse();
+    double coldUse = elapsedMicroseconds(start);
+
+    // reloading resets every pointer, so each iteration pays the first-use cost again in lazy mode
+    double warmLoad = 0.0, warmUse = 0.0;
+    for (int i = 0; i < LOAD_ITERATIONS; ++i) {
+        start = std::chrono::steady_clock::now();
+        gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+        warmLoad += elapsedMicroseconds(start);
+        start = std::chrono::steady_clock::now();
+        firstUse();
+        warmUse += elapsedMicroseconds(start);
+    }
+    warmLoad /= LOAD_ITERATIONS;
+    warmUse /= LOAD_ITERATIONS;
+
+#ifdef GLAD_BENCH_LAZY
+    std::cout << "mode: lazy" << std::endl;
+#else
+    std::cout << "mode: eager" << std::endl;
+#endif
+    std::cout << "GL " << GLVersion.major << "." << GLVersion.minor << std::endl;
+    std::cout << "cold load: " << coldLoad << " us, first use: " << coldUse << " us, total: "
+              << coldLoad + coldUse << " us" << std::endl;
+    std::cout << "warm load: " << warmLoad << " us, first use: " << warmUse << " us, total: "
+              << warmLoad + warmUse << " us (avg of " << LOAD_ITERATIONS << ")" << std::endl;
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "../Shader.h"
+
+/*
+ * Builds NR_PROGRAMS variants of the coordinate-system shader pair twice:
+ *  > serial: Shader::build per program, each one checks its status (and so waits) before the next is submitted
+ *  > batch:  everything submitted first, GL_COMPLETION_STATUS_KHR polled, statuses checked at the end
+ * Every variant gets its own #define so the driver's shader cache can't hand back an earlier result.
+ */
+
+// Settings
+const int NR_PROGRAMS = 64;
+
+std::string variant(const std::string &source, const std::string &tag) {
+    // defines have to come after #version
+    size_t lineEnd = source.find('\n');
+    return source.substr(0, lineEnd + 1) + "#define VARIANT_" + tag + "\n" + source.substr(lineEnd + 1);
+}
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    GLFWwindow* window = glfwCreateWindow(800, 600, "ShaderBatch", NULL, NULL);
+    if (window == nullptr) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+
+    std::string vertexCode = Shader::readFile("../shaders/coord_shader.glsl");
+    std::string fragmentCode = Shader::readFile("../shaders/fragment_shader_tex.glsl");
+
+    // serial
+    std::vector<unsigned int> programs;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NR_PROGRAMS; ++i) {
+        std::string tag = "SERIAL_" + std::to_string(i);
+        programs.push_back(Shader::build(variant(vertexCode, tag), variant(fragmentCode, tag)));
+    }
+    double serial = elapsedMilliseconds(start);
+
+    // batch
+    std::vector<Shader::Pending> pending;
+    int polls = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NR_PROGRAMS; ++i) {
+        std::string tag = "BATCH_" + std::to_string(i);
+        pending.push_back(Shader::submit(variant(vertexCode, tag), variant(fragmentCode, tag)));
+    }
+    double submitted = elapsedMilliseconds(start);
+    // a real loader would render frames here instead of spinning
+    for (size_t i = 0; i < pending.size(); ++polls)
+        if (Shader::completed(pending[i]))
+            ++i;
+    for (Shader::Pending &p : pending)
+        programs.push_back(Shader::finish(p));
+    double batch = elapsedMilliseconds(start);
+
+    int failed = 0;
+    for (unsigned int program : programs) {
+        if (program == 0)
+            failed++;
+        glDeleteProgram(program);
+    }
+
+    std::cout << "parallel_shader_compile: " << (Shader::parallelCompileSupported() ? "yes" : "no") << std::endl;
+    std::cout << "serial: " << serial << " ms for " << NR_PROGRAMS << " programs" << std::endl;
+    std::cout << "batch:  " << batch << " ms (" << submitted << " ms to submit, " << polls << " polls)" << std::endl;
+    if (failed)
+        std::cout << failed << " programs failed to build" << std::endl;
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return failed ? 1 : 0;
+}
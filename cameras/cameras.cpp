@@ -3,6 +3,7 @@
 //
 
 #define STB_IMAGE_IMPLEMENTATION
+#define ALLOCATION_COUNTER_IMPLEMENTATION
 #include <iostream>
 #include <math.h>
 #include <glad.h>
@@ -12,15 +13,29 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "../Shader.h"
+#include "../ShaderVariants.h"
+#include "../MeshFile.h"
+#include "../MeshletCuller.h"
+#include "../Frustum.h"
+#include "../OcclusionCuller.h"
+#include "../BVH.h"
+#include "../SceneGraph.h"
+#include "../GLObjects.h"
+#include "../FrameArena.h"
+#include "../AllocationCounter.h"
+#include "../glad_trace.h"
+#include "../FrameRecorder.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
-void processInput(GLFWwindow *window);
+void processInput(GLFWwindow *window, const FrameRecorder &recorder);
 void shaderProgramStatus(const unsigned int &ID, const std::string &type);
 
 // Settings
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
+// frames before the heap allocations of a frame are counted (scratch buffers size themselves to the scene)
+const int ALLOCATION_WARMUP = 10;
 
 int main(int argc, char** argv) {
 
@@ -35,6 +50,10 @@ int main(int argc, char** argv) {
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
+    // --capture / --replay: record or play back time and input for reproducible runs
+    FrameRecorder recorder(argc, argv, {GLFW_KEY_ESCAPE, GLFW_KEY_L, GLFW_KEY_F, GLFW_KEY_P});
+    recorder.windowHints();
+
     // Create window object
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
     if (window == nullptr) {
@@ -47,72 +66,50 @@ int main(int argc, char** argv) {
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         std::cout << "Failed to initialize GLAD" << std::endl;
     }
+    recorder.contextCreated();
+
+    // MESH: built from models/*.obj by mesh_convert at build time, mapped and uploaded as is. The cube has no LODs:
+    // every vertex is on a uv/normal seam, which MeshSimplifier never moves, so its chain stops at level 0 and
+    // selectLod below always picks it. The sphere is smooth apart from its uv seam and comes with coarser levels.
+    MeshFile cube, sphere;
+    if (!cube.load("models/cube.mesh") || !sphere.load("models/sphere.mesh")) {
+        glfwTerminate();
+        return -1;
+    }
 
     // SHADER
-    Shader ourShader("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
-
-    // set up vertex data (and buffer(s)) and configure vertex attributes
-    float vertices[] = {
-            -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
-            0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
-            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-            -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
-
-            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-            0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
-            0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
-            -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,
-            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-
-            -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-            -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-            -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
-            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-            0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-            0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-            0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
-            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-            0.5f, -0.5f, -0.5f,  1.0f, 1.0f,
-            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-
-            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-            -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
-            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
-    };
-    unsigned int VAO, VBO;// Vertex Array Object (which will hold a VBO+EBO)
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind buffer ID to unique buffer type (this is for vertices)
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // copy vertex data into buffer
-    // vertex position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // texture1 attribute
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)(3*sizeof(float)));
-    glEnableVertexAttribArray(1);
+    ShaderVariants variants("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
+    Shader &ourShader = cube.quantized ? variants.get({"QUANTIZED"}) : variants.get({});
+    Shader &sphereShader = sphere.quantized ? variants.get({"QUANTIZED"}) : variants.get({});
+
+    VertexLayout layout = cube.layout();
+    if (!layout.validate(ourShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    // Vertex Array Object (which will hold a VBO+EBO)
+    GLVertexArray VAO = layout.createVertexArray(cube.vertexBuffer.id(), cube.elementBuffer.id());
+    VertexLayout sphereLayout = sphere.layout();
+    if (!sphereLayout.validate(sphereShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    GLVertexArray sphereVAO = sphereLayout.createVertexArray(sphere.vertexBuffer.id(), sphere.elementBuffer.id());
+    // full detail spheres are culled meshlet by meshlet and drawn from the culler's compacted index buffer (same
+    // vertex buffer, so a second VAO); the cube's 12 triangles aren't, they'd cost an index upload to save a few
+    MeshletCuller culler;
+    bool cullMeshlets = MeshletCuller::worthwhile(sphere.meshlets);
+    GLVertexArray culledVAO;
+    if (cullMeshlets)
+        culledVAO = sphereLayout.createVertexArray(sphere.vertexBuffer.id(), culler.createBuffer());
+    // low resolution software depth buffer for occlusion culling the cubes against each other
+    OcclusionCuller occlusion(256, 128);
+    // world boxes of the cubes: built on the first frame, refit after that (some cubes spin)
+    BVH bvh;
+    std::vector<Mesh::Bounds> cubeBounds(10);
+    std::vector<uint32_t> visibleCubes;
+    bool picking = false;
 
     // TEXTURE
     // Create texture1
-    unsigned int texture1; // texture1 ID
-    glGenTextures(1, &texture1);
-    glBindTexture(GL_TEXTURE_2D, texture1);
+    GLTexture texture1 = GLTexture::create(); // texture1 ID, from the pool (GLObjects.h)
+    glBindTexture(GL_TEXTURE_2D, texture1.id());
     // set the texture1 wrapping/filtering options (on currently bound texture1)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -129,9 +126,6 @@ int main(int argc, char** argv) {
     }
     stbi_image_free(data); // free image data from memory
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
     glViewport(0,0,800,600);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
@@ -157,6 +151,16 @@ int main(int argc, char** argv) {
             glm::vec3( 1.5f,  0.2f, -1.5f),
             glm::vec3(-1.3f,  1.0f, -1.5f)
     };
+    // two rows of spheres going off into the distance, far enough out for their coarser levels to be picked
+    const int SPHERES = 12;
+    const float SPHERE_SCALE = 1.5f;
+    glm::mat4 sphereModels[SPHERES];
+    for (int i = 0; i < SPHERES; ++i) {
+        glm::vec3 position(i % 2 ? 4.0f : -4.0f, -1.0f, -6.0f - 5.0f * i);
+        sphereModels[i] = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(SPHERE_SCALE));
+    }
+    glm::vec3 sphereCenter = (sphere.bounds.min + sphere.bounds.max) * 0.5f;
+    float sphereRadius = glm::length(sphere.bounds.max - sphere.bounds.min) * 0.5f * SPHERE_SCALE;
     // CAMERA
     // camera position
     glm::vec3 cameraPos = glm::vec3(0.0f,0.0f, 3.0f);
@@ -177,38 +181,66 @@ int main(int argc, char** argv) {
      *     Note: R^T and -d_vec.. this is because we move the world not the camera
      */
 
-    // translate camera frame
-    glm::mat4 obj6Transform(1.0f);
-    obj6Transform = glm::translate(obj6Transform, cubePositions[6]);
+    // SCENE
+    // cube 6's frame is a node of its own: the cube spins inside it, the camera orbits inside it
+    SceneGraph scene;
+    SceneGraph::Handle obj6Frame = scene.add(SceneGraph::NONE, glm::translate(glm::mat4(1.0f), cubePositions[6]));
+    SceneGraph::Handle cameraNode = scene.add(obj6Frame);
+    SceneGraph::Handle cubeNodes[10];
+    for (int i = 0; i < 10; ++i) {
+        float angle = 20.0f * i;
+        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
+        if (i == 6)
+            cubeNodes[i] = scene.add(obj6Frame, rotation);
+        else
+            cubeNodes[i] = scene.add(SceneGraph::NONE, glm::translate(glm::mat4(1.0f), cubePositions[i]) * rotation);
+    }
 
 
+    // heap allocations of the frames after the warmup (AllocationCounter.h): the frame's work is meant to make none
+    uint64_t frameAllocations = 0;
+    int frameCount = 0;
+
     // Create render loop: each iteration of loop is called a "frame"
-    while(!glfwWindowShouldClose(window)) {
+    while(!glfwWindowShouldClose(window) && !recorder.finished()) {
+        recorder.beginFrame(window);
+        AllocationCounter::Snapshot allocations;
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         // clear the buffer data between each frame
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        processInput(window);
+        processInput(window, recorder);
 
         /*! using Shader Class */
         // Learning Shader
         ourShader.use();
         ourShader.setInt("texture1", 0);
+        cube.setUniforms(ourShader);
         glActiveTexture(GL_TEXTURE0); // this 0 matches the int value in setInt
-        glBindTexture(GL_TEXTURE_2D, texture1);
+        glBindTexture(GL_TEXTURE_2D, texture1.id());
 
         /*! bind the buffer and draw the shape you want... */
-        glBindVertexArray(VAO);
+        glBindVertexArray(VAO.id());
 
         /*! Transform the object */
         // revolve camera around model
         const float radius = 10.0f;
-        float camX = sin(glfwGetTime()) * radius;
-        float camZ = cos(glfwGetTime()) * radius;
+        float camX = sin(recorder.time()) * radius;
+        float camZ = cos(recorder.time()) * radius;
+        scene.setLocal(cameraNode, glm::translate(glm::mat4(1.0f), glm::vec3(camX, 3.0f, camZ)));
+        // only every third cube spins, the others keep the world matrix computed on the first update
+        for (int i = 0; i < 10; i += 3) {
+            glm::mat4 model(1.0f);
+            if (i != 6)
+                model = glm::translate(model, cubePositions[i]);
+            float angle = 20.0f * i;
+            model = glm::rotate(model, (float)recorder.time()*glm::radians(angle),glm::vec3(1.0f, 0.3f, 0.5f));
+            scene.setLocal(cubeNodes[i], model);
+        }
+        scene.update();
         // All those steps are summarized in glm::lookAt
         glm::mat4 view;
-        glm::vec4 cameraPose(camX, 3.0f, camZ, 1.0f);
-        cameraPose = obj6Transform*cameraPose;
+        glm::vec4 cameraPose = scene.getWorld(cameraNode)[3];
         view = glm::lookAt(glm::vec3(cameraPose.x, cameraPose.y, cameraPose.z),
                            cubePositions[6],
                            glm::vec3(0.0f, 1.0f, 0.0f));
@@ -218,21 +250,78 @@ int main(int argc, char** argv) {
         projection = glm::perspective(glm::radians(55.0f), float(SCR_WIDTH/SCR_HEIGHT), 0.1f, 100.0f);
         ourShader.setMat4("view", view);
         ourShader.setMat4("projection", projection);
+        // LODs are picked by how many pixels their error covers, so they need the real framebuffer height
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
         // model matrix
+        glm::mat4 models[10];
         for (int i = 0; i < 10; ++i) {
-            glm::mat4 model(1.0f);
-            model = glm::translate(model, cubePositions[i]);
-            float angle = 20.0f * i;
-            if (i%3 == 0)
-                model = glm::rotate(model, (float)glfwGetTime()*glm::radians(angle),glm::vec3(1.0f, 0.3f, 0.5f));
-            else
-                model = glm::rotate(model, glm::radians(angle),glm::vec3(1.0f, 0.3f, 0.5f));
+            models[i] = scene.getWorld(cubeNodes[i]);
+            cubeBounds[i] = BVH::transform(cube.bounds, models[i]);
+        }
+        if (bvh.nodes.empty())
+            bvh.build(cubeBounds);
+        else
+            bvh.refit(cubeBounds);
+
+        // P: which cube is in the middle of the screen
+        if (recorder.key(window, GLFW_KEY_P) && !picking) {
+            glm::vec3 eye(cameraPose.x, cameraPose.y, cameraPose.z);
+            float distance;
+            int picked = bvh.pick(eye, glm::normalize(cubePositions[6] - eye), &distance);
+            if (picked >= 0)
+                std::cout << "Picked cube " << picked << " at distance " << distance << std::endl;
+        }
+        picking = recorder.key(window, GLFW_KEY_P);
+
+        // the cubes are solid, so each one's box occludes the others; hidden cubes never get submitted
+        occlusion.clear();
+        for (const glm::mat4 &model : models)
+            occlusion.addBox(cube.bounds, projection * view * model);
+        occlusion.rasterize();
+        bvh.visible(projection * view, visibleCubes, &occlusion);
 
+        for (uint32_t i : visibleCubes) {
+            const glm::mat4 &model = models[i];
             ourShader.setMat4("model", model);
 
-            glDrawArrays(GL_TRIANGLES, 0, 36);
+            // a coarser level of the same vertex buffer for distant objects (always 0 for the cube, see MESH)
+            cube.draw(cube.selectLod(model, view, projection, float(framebufferHeight)));
         }
 
+        // the spheres don't occlude anything, but the cubes can hide them
+        Frustum frustum = Frustum::fromMatrix(projection * view);
+        sphereShader.use();
+        sphereShader.setInt("texture1", 0);
+        sphereShader.setMat4("view", view);
+        sphereShader.setMat4("projection", projection);
+        sphere.setUniforms(sphereShader);
+        glBindVertexArray(sphereVAO.id());
+        for (const glm::mat4 &model : sphereModels) {
+            if (frustum.sphereOutside(glm::vec3(model * glm::vec4(sphereCenter, 1.0f)), sphereRadius) ||
+                !occlusion.visible(sphere.bounds, projection * view * model))
+                continue;
+            sphereShader.setMat4("model", model);
+            size_t lod = sphere.selectLod(model, view, projection, float(framebufferHeight));
+            if (lod == 0 && cullMeshlets) {
+                culler.cull(sphere.meshlets, model, view, projection);
+                glBindVertexArray(culledVAO.id());
+                culler.draw();
+                glBindVertexArray(sphereVAO.id());
+            } else {
+                sphere.draw(lod);
+            }
+        }
+
+        recorder.endFrame();
+        // per-frame scratch (FrameArena.h) of every thread goes back in one go
+        FrameArena::resetAll();
+        // GL objects released this frame wait for a fence, earlier ones the GPU is done with get recycled
+        GLObjectPool::shared().endFrame();
+        if (frameCount++ >= ALLOCATION_WARMUP)
+            frameAllocations += allocations.allocations();
+        // GLAD_TRACE builds: print this frame's GL call histogram
+        gladTraceEndFrame();
         // will swap the color buffer: a large 2D buffer that contains color values for each pixel in GLFW window
         glfwSwapBuffers(window);
         // Checks if any events have triggered
@@ -240,9 +329,20 @@ int main(int argc, char** argv) {
     }
 
     // deallocate all resources
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-
+    VAO.reset();
+    culledVAO.reset();
+    culler.deleteBuffer();
+    cube.deleteBuffers();
+    sphereVAO.reset();
+    sphere.deleteBuffers();
+    variants.deletePrograms();
+    texture1.reset();
+    GLObjectPool::shared().shutdown();
+
+    gladTraceSummary();
+    if (frameCount > ALLOCATION_WARMUP)
+        std::cout << "Heap allocations per frame: " << double(frameAllocations) / (frameCount - ALLOCATION_WARMUP)
+                  << " (" << frameCount - ALLOCATION_WARMUP << " frames after " << ALLOCATION_WARMUP << ")" << std::endl;
     // terminate GLFW
     glfwTerminate();
 
@@ -255,13 +355,13 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     printf("Window resized to (%i, %i)\n", width, height);
 }
 
-void processInput(GLFWwindow *window) {
+void processInput(GLFWwindow *window, const FrameRecorder &recorder) {
     /// Takes the window as input together with a key
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_ESCAPE))
         glfwSetWindowShouldClose(window, true);
-    if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_L))
         glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_F))
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
 }
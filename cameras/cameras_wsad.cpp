@@ -12,11 +12,19 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "../Shader.h"
+#include "../VertexLayout.h"
+#include "../ShaderReloader.h"
+#include "../glad_trace.h"
+#include "../FrameRecorder.h"
+#include "../FrameLoop.h"
+#include "../Components.h"
+#include "../GLObjects.h"
+#include "../RenderGraph.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
-void processInput(GLFWwindow *window);
-void moveCamera(GLFWwindow *window, glm::vec3 (&camera)[3]);
+void processInput(GLFWwindow *window, const FrameRecorder &recorder);
+void moveCamera(GLFWwindow *window, const FrameRecorder &recorder, glm::vec3 (&camera)[3]);
 
 // Settings
 const unsigned int SCR_WIDTH = 800;
@@ -35,6 +43,13 @@ int main(int argc, char** argv) {
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
+    // --capture / --replay: record or play back time and input for reproducible runs
+    FrameRecorder recorder(argc, argv, {GLFW_KEY_ESCAPE, GLFW_KEY_L, GLFW_KEY_F, GLFW_KEY_W, GLFW_KEY_S, GLFW_KEY_A, GLFW_KEY_D, GLFW_KEY_B, GLFW_KEY_P});
+    recorder.windowHints();
+    // --tick / --fps / --no-vsync: simulation rate and render rate are set independently
+    FrameLoop loop(argc, argv);
+    loop.throttle = recorder.mode != FrameRecorder::REPLAY;
+
     // Create window object
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
     if (window == nullptr) {
@@ -47,9 +62,24 @@ int main(int argc, char** argv) {
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         std::cout << "Failed to initialize GLAD" << std::endl;
     }
+    loop.contextCreated();
+    recorder.contextCreated();
 
     // SHADER
     Shader ourShader("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
+    // rebuild the program in the background whenever one of its files is saved
+    ShaderReloader reloader(window);
+    reloader.watch(ourShader);
+    // post processing: separable blur and the composite to the screen, both on a fullscreen triangle
+    Shader blurShader("../shaders/post_vertex.glsl", "../shaders/post_blur.glsl");
+    Shader compositeShader("../shaders/post_vertex.glsl", "../shaders/post_composite.glsl");
+    // depth prepass: the same vertex shader as the cubes, no fragment work
+    Shader depthShader("../shaders/coord_shader.glsl", "../shaders/depth_only.glsl");
+    reloader.watch(blurShader);
+    reloader.watch(compositeShader);
+    reloader.watch(depthShader);
+    // the fullscreen triangle comes from gl_VertexID, but core profile still wants a vertex array bound
+    GLVertexArray emptyVAO = GLVertexArray::create();
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     float vertices[] = {
@@ -95,24 +125,22 @@ int main(int argc, char** argv) {
             -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
             -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
     };
-    unsigned int VAO, VBO;// Vertex Array Object (which will hold a VBO+EBO)
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind buffer ID to unique buffer type (this is for vertices)
+    // buffers and textures come from the pool (GLObjects.h) and go back to it when these handles do
+    GLBuffer VBO = GLBuffer::create();
+    glBindBuffer(GL_ARRAY_BUFFER, VBO.id()); // bind buffer ID to unique buffer type (this is for vertices)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // copy vertex data into buffer
-    // vertex position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // texture1 attribute
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)(3*sizeof(float)));
-    glEnableVertexAttribArray(1);
+    // vertex position and texture1 attributes, locations come from the shader
+    VertexLayout layout;
+    layout.attribute("aPos", 3).attribute("aTexCoord", 2);
+    if (!layout.validate(ourShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    // Vertex Array Object (which will hold a VBO+EBO)
+    GLVertexArray VAO = layout.createVertexArray(VBO.id());
 
     // TEXTURE
     // Create texture1
-    unsigned int texture1; // texture1 ID
-    glGenTextures(1, &texture1);
-    glBindTexture(GL_TEXTURE_2D, texture1);
+    GLTexture texture1 = GLTexture::create(); // texture1 ID
+    glBindTexture(GL_TEXTURE_2D, texture1.id());
     // set the texture1 wrapping/filtering options (on currently bound texture1)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -128,9 +156,8 @@ int main(int argc, char** argv) {
         std::cout << "Failed to load texture1..." << std::endl;
     }
     // Create texture1 2
-    unsigned int texture2; // texture1 ID
-    glGenTextures(1, &texture2);
-    glBindTexture(GL_TEXTURE_2D, texture2);
+    GLTexture texture2 = GLTexture::create(); // texture1 ID
+    glBindTexture(GL_TEXTURE_2D, texture2.id());
     // set the texture1 wrapping/filtering options (on currently bound texture1)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -147,9 +174,6 @@ int main(int argc, char** argv) {
     }
     stbi_image_free(data); // free image data from memory
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
     glViewport(0,0,800,600);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
@@ -175,6 +199,18 @@ int main(int argc, char** argv) {
             glm::vec3( 1.5f,  0.2f, -1.5f),
             glm::vec3(-1.3f,  1.0f, -1.5f)
     };
+    // ENTITIES
+    // one entity per cube; every third one spins, the rest keep their angle
+    EntityWorld world;
+    for (int i = 0; i < 10; ++i) {
+        float angle = glm::radians(20.0f * i);
+        Transform transform{cubePositions[i], glm::vec3(1.0f, 0.3f, 0.5f), angle};
+        Material material{&ourShader, {texture1.id(), texture2.id()}};
+        Entity cube = world.create(transform, WorldMatrix(), MeshRenderer{VAO.id(), 0, 36}, material);
+        if (i%3 == 0)
+            world.add(cube, Spin{angle});
+    }
+
     // MOVEABLE CAMERA
     glm::vec3 cameraPos(0.0f, 0.0f, 3.0f); // initial camera position
     glm::vec3 cameraFront(0.0f, 0.0f, -1.0f); // camera always looking in -z direction
@@ -183,62 +219,165 @@ int main(int argc, char** argv) {
             cameraPos, cameraFront, cameraUp
     };
     glm::mat4 view;
+    glm::vec3 previousCameraPos = camera[0]; // camera position before the last update, for interpolation
+
+    // animation before transforms (it writes what they read), drawing last and on this thread
+    float simulationTime = 0.0f;
+    // P toggles the depth prepass: depth alone first, then every pixel shaded once with GL_EQUAL
+    bool depthPrepass = true, prepassKeyDown = false;
+    SystemSchedule systems;
+    systems.add("animate", EntityWorld::mask<Spin>(), EntityWorld::mask<Transform>(),
+                [&](EntityWorld &w) { Systems::animate(w, simulationTime); })
+           .add("transforms", EntityWorld::mask<Transform>(), EntityWorld::mask<WorldMatrix>(),
+                Systems::updateTransforms)
+           .add("render", EntityWorld::mask<WorldMatrix, MeshRenderer, Material>(), 0, [&](EntityWorld &w) {
+                Systems::DrawList draws = Systems::frontToBack(w, view);
+                if (depthPrepass)
+                    Systems::renderDepth(draws, depthShader);
+                Systems::renderShaded(draws, depthPrepass);
+           }, true);
+
+    // RENDER GRAPH
+    // scene -> (blurX -> blurY ->) composite; B toggles the blur, without it the blur passes are culled.
+    // Built again when the framebuffer size or the blur changes, the textures it can keep are reused.
+    RenderGraph graph;
+    bool blur = false, blurKeyDown = false;
+    int graphWidth = 0, graphHeight = 0;
+    auto buildGraph = [&](int width, int height) {
+        graph.clear();
+        RenderGraph::Resource backbuffer = graph.importBackbuffer(width, height);
+        RenderGraph::Resource sceneColor = RenderGraph::NONE, blurX = RenderGraph::NONE, blurY = RenderGraph::NONE;
+        graph.addPass("scene", [&](RenderGraph::Builder &builder) {
+            sceneColor = builder.create("sceneColor", {width, height, GL_RGBA16F});
+            builder.write(sceneColor);
+            builder.writeDepth(builder.create("sceneDepth", {width, height, GL_DEPTH_COMPONENT24}));
+        }, [&](const RenderGraph&) {
+            glEnable(GL_DEPTH_TEST);
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            // model matrices and draws come from the entities
+            systems.run(world);
+        });
+        // one blur pass per axis, the texel step along it as the direction
+        auto blurPass = [&](const std::string &name, RenderGraph::Resource source, RenderGraph::Resource &target,
+                            glm::vec2 direction) {
+            graph.addPass(name, [&, source](RenderGraph::Builder &builder) {
+                builder.read(source);
+                target = builder.create(name, {width, height, GL_RGBA16F});
+                builder.write(target);
+            }, [&, source, direction](const RenderGraph &graph) {
+                glDisable(GL_DEPTH_TEST);
+                blurShader.use();
+                blurShader.setInt("source", 0);
+                blurShader.setVec2("direction", direction);
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, graph.texture(source));
+                glBindVertexArray(emptyVAO.id());
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            });
+        };
+        blurPass("blurX", sceneColor, blurX, glm::vec2(1.0f / width, 0.0f));
+        blurPass("blurY", blurX, blurY, glm::vec2(0.0f, 1.0f / height));
+        RenderGraph::Resource shown = blur ? blurY : sceneColor;
+        graph.addPass("composite", [&, shown](RenderGraph::Builder &builder) {
+            builder.read(shown);
+            builder.write(backbuffer);
+        }, [&, shown](const RenderGraph &graph) {
+            glDisable(GL_DEPTH_TEST);
+            compositeShader.use();
+            compositeShader.setInt("scene", 0);
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, graph.texture(shown));
+            glBindVertexArray(emptyVAO.id());
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        });
+        graph.compile();
+        graph.print();
+        graphWidth = width;
+        graphHeight = height;
+    };
 
     // Create render loop: each iteration of loop is called a "frame"
-    while(!glfwWindowShouldClose(window)) {
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        // clear the buffer data between each frame
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        processInput(window);
-        moveCamera(window, camera);
+    while(!glfwWindowShouldClose(window) && !recorder.finished()) {
+        recorder.beginFrame(window);
+        reloader.update();
+
+        processInput(window, recorder);
+        // B flips the blur on the key going down
+        bool blurKey = recorder.key(window, GLFW_KEY_B);
+        bool rebuild = blurKey && !blurKeyDown;
+        if (rebuild)
+            blur = !blur;
+        blurKeyDown = blurKey;
+        bool prepassKey = recorder.key(window, GLFW_KEY_P);
+        if (prepassKey && !prepassKeyDown) {
+            depthPrepass = !depthPrepass;
+            std::cout << "Depth prepass " << (depthPrepass ? "on" : "off") << std::endl;
+        }
+        prepassKeyDown = prepassKey;
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        if (framebufferWidth > 0 && framebufferHeight > 0 &&
+            (rebuild || framebufferWidth != graphWidth || framebufferHeight != graphHeight))
+            buildGraph(framebufferWidth, framebufferHeight);
+        // move the camera at a fixed rate, however fast we happen to render
+        for (int steps = loop.advance(recorder.time()); steps > 0; --steps) {
+            previousCameraPos = camera[0];
+            moveCamera(window, recorder, camera);
+        }
 
         /*! using Shader Class */
         // Learning Shader
         ourShader.use();
         ourShader.setInt("texture1", 0);
         ourShader.setInt("texture2", 1);
-        glActiveTexture(GL_TEXTURE0); // this 0 matches the int value in setInt
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        glActiveTexture(GL_TEXTURE1); // this 1 matches the int value in setInt
-        glBindTexture(GL_TEXTURE_2D, texture2);
-
-        /*! bind the buffer and draw the shape you want... */
-        glBindVertexArray(VAO);
+        // textures and the VAO are bound by the render system, from each cube's Material and MeshRenderer
 
         /*! Transform the object */
-        view = glm::lookAt(camera[0], camera[0]+camera[1], camera[2]);
+        glm::vec3 renderPos = glm::mix(previousCameraPos, camera[0], loop.alpha());
+        view = glm::lookAt(renderPos, renderPos+camera[1], camera[2]);
 
         // projection matrix
         glm::mat4 projection;
         projection = glm::perspective(glm::radians(55.0f), float(SCR_WIDTH/SCR_HEIGHT), 0.1f, 100.0f);
         ourShader.setMat4("view", view);
         ourShader.setMat4("projection", projection);
-        // model matrix
-        for (int i = 0; i < 10; ++i) {
-            glm::mat4 model(1.0f);
-            model = glm::translate(model, cubePositions[i]);
-            float angle = 20.0f * i;
-            if (i%3 == 0)
-                model = glm::rotate(model, (float)glfwGetTime()*glm::radians(angle),glm::vec3(1.0f, 0.3f, 0.5f));
-            else
-                model = glm::rotate(model, glm::radians(angle),glm::vec3(1.0f, 0.3f, 0.5f));
-
-            ourShader.setMat4("model", model);
-
-            glDrawArrays(GL_TRIANGLES, 0, 36);
-        }
-
+        depthShader.use();
+        depthShader.setMat4("view", view);
+        depthShader.setMat4("projection", projection);
+        simulationTime = (float)recorder.time();
+        // scene into its own color/depth textures, then the post passes to the screen
+        graph.execute();
+
+        recorder.endFrame();
+        // per-frame scratch (FrameArena.h) of every thread goes back in one go
+        FrameArena::resetAll();
+        // GL objects released this frame wait for a fence, earlier ones the GPU is done with get recycled
+        GLObjectPool::shared().endFrame();
+        // GLAD_TRACE builds: print this frame's GL call histogram
+        gladTraceEndFrame();
         // will swap the color buffer: a large 2D buffer that contains color values for each pixel in GLFW window
         glfwSwapBuffers(window);
         // Checks if any events have triggered
         glfwPollEvents();
+        loop.endFrame();
     }
 
     // deallocate all resources
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-
+    VAO.reset();
+    emptyVAO.reset();
+    graph.deleteObjects();
+    VBO.reset();
+    texture1.reset();
+    texture2.reset();
+    GLObjectPool::shared().shutdown();
+    glDeleteProgram(ourShader.ID);
+    glDeleteProgram(blurShader.ID);
+    glDeleteProgram(compositeShader.ID);
+    glDeleteProgram(depthShader.ID);
+
+    gladTraceSummary();
+    reloader.stop();
     // terminate GLFW
     glfwTerminate();
 
@@ -251,25 +390,25 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     printf("Window resized to (%i, %i)\n", width, height);
 }
 
-void processInput(GLFWwindow *window) {
+void processInput(GLFWwindow *window, const FrameRecorder &recorder) {
     /// Takes the window as input together with a key
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_ESCAPE))
         glfwSetWindowShouldClose(window, true);
-    if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_L))
         glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_F))
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
 }
 
-void moveCamera(GLFWwindow *window, glm::vec3 (&camera)[3]) {
-    const float cameraSpeed = 0.05f; // adjust accordingly
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+void moveCamera(GLFWwindow *window, const FrameRecorder &recorder, glm::vec3 (&camera)[3]) {
+    const float cameraSpeed = 0.05f; // per update step (60 per second by default)
+    if (recorder.key(window, GLFW_KEY_W))
         camera[0] += cameraSpeed * camera[1];
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_S))
         camera[0] -= cameraSpeed * camera[1];
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_A))
         camera[0] -= glm::normalize(glm::cross(camera[1], camera[2])) * cameraSpeed;
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+    if (recorder.key(window, GLFW_KEY_D))
         camera[0] += glm::normalize(glm::cross(camera[1], camera[2])) * cameraSpeed;
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+# Generates glad_ext_hash.h: a collision-free (perfect) hash table over the extensions glad.c detects.
+# Invoked at build time:
+#   cmake -DEXTENSIONS=GL_A,GL_B -DOUTPUT=<path>/glad_ext_hash.h -P glad_ext_hash.cmake
+# The hash is 32-bit FNV-1a with the offset basis xor'ed by a seed and the high half folded into the
+# low half (FNV's low bits alone barely depend on the seed). Seeds are tried until every extension
+# lands in its own slot, so a lookup in glad.c is one hash + at most one strcmp. A table of name
+# lengths lets glad.c skip hashing most of the names a driver reports.
+
+cmake_minimum_required(VERSION 3.21)
+
+string(REPLACE "," ";" EXTENSIONS "${EXTENSIONS}")
+list(REMOVE_DUPLICATES EXTENSIONS)
+list(SORT EXTENSIONS)
+list(LENGTH EXTENSIONS count)
+
+# table size: power of two, at least twice the number of extensions
+set(size 2)
+math(EXPR wanted "${count} * 2")
+while(size LESS wanted)
+    math(EXPR size "${size} * 2")
+endwhile()
+math(EXPR mask "${size} - 1")
+
+# hash every name once per seed
+function(fnv1a name seed out)
+    string(HEX "${name}" hex)
+    string(LENGTH "${hex}" hexlen)
+    math(EXPR h "(2166136261 ^ ${seed}) & 0xFFFFFFFF")
+    set(i 0)
+    while(i LESS hexlen)
+        string(SUBSTRING "${hex}" ${i} 2 byte)
+        math(EXPR h "((${h} ^ 0x${byte}) * 16777619) & 0xFFFFFFFF")
+        math(EXPR i "${i} + 2")
+    endwhile()
+    math(EXPR h "${h} ^ (${h} >> 16)")
+    set(${out} ${h} PARENT_SCOPE)
+endfunction()
+
+set(seed 0)
+while(TRUE)
+    set(slots "")
+    set(collision FALSE)
+    foreach(ext IN LISTS EXTENSIONS)
+        fnv1a("${ext}" ${seed} h)
+        math(EXPR slot "${h} & ${mask}")
+        if(slot IN_LIST slots)
+            set(collision TRUE)
+            break()
+        endif()
+        list(APPEND slots ${slot})
+        set(slot_${slot} ${ext})
+    endforeach()
+    if(NOT collision)
+        break()
+    endif()
+    foreach(slot IN LISTS slots)
+        unset(slot_${slot})
+    endforeach()
+    math(EXPR seed "${seed} + 1")
+    # give up on this table size after a while and try a sparser one
+    if(seed EQUAL 1024)
+        set(seed 0)
+        math(EXPR size "${size} * 2")
+        math(EXPR mask "${size} - 1")
+    endif()
+endwhile()
+
+set(content "/* Generated by cmake/glad_ext_hash.cmake, do not edit. */\n\n")
+string(APPEND content "#define GLAD_EXT_HASH_SEED ${seed}u\n")
+string(APPEND content "#define GLAD_EXT_HASH_SIZE ${size}\n\n")
+foreach(ext IN LISTS EXTENSIONS)
+    string(APPEND content "int GLAD_${ext} = 0;\n")
+endforeach()
+string(APPEND content "\nstatic const char *glad_ext_hash_names[GLAD_EXT_HASH_SIZE] = {\n")
+set(i 0)
+while(i LESS size)
+    if(DEFINED slot_${i})
+        string(APPEND content "\t\"${slot_${i}}\",\n")
+    else()
+        string(APPEND content "\tNULL,\n")
+    endif()
+    math(EXPR i "${i} + 1")
+endwhile()
+string(APPEND content "};\nstatic int *glad_ext_hash_flags[GLAD_EXT_HASH_SIZE] = {\n")
+set(i 0)
+while(i LESS size)
+    if(DEFINED slot_${i})
+        string(APPEND content "\t&GLAD_${slot_${i}},\n")
+    else()
+        string(APPEND content "\tNULL,\n")
+    endif()
+    math(EXPR i "${i} + 1")
+endwhile()
+string(APPEND content "};\n")
+
+# names whose length (mod 64) no extension has are rejected before hashing
+set(lengths "")
+foreach(ext IN LISTS EXTENSIONS)
+    string(LENGTH "${ext}" len)
+    math(EXPR len "${len} & 63")
+    list(APPEND lengths ${len})
+endforeach()
+string(APPEND content "static const unsigned char glad_ext_hash_lengths[64] = {")
+set(i 0)
+while(i LESS 64)
+    math(EXPR column "${i} % 16")
+    if(column EQUAL 0)
+        string(APPEND content "\n\t")
+    endif()
+    if(i IN_LIST lengths)
+        string(APPEND content "1,")
+    else()
+        string(APPEND content "0,")
+    endif()
+    math(EXPR i "${i} + 1")
+endwhile()
+string(APPEND content "\n};\n")
+
+# only touch the file when it changes so glad.c isn't rebuilt needlessly
+file(WRITE "${OUTPUT}.tmp" "${content}")
+file(COPY_FILE "${OUTPUT}.tmp" "${OUTPUT}" ONLY_IF_DIFFERENT)
+file(REMOVE "${OUTPUT}.tmp")
@@ -12,6 +12,9 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "../Shader.h"
+#include "../ShaderVariants.h"
+#include "../VertexPacking.h"
+#include "../glad_trace.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
@@ -49,7 +52,9 @@ int main(int argc, char** argv) {
     }
 
     // SHADER
-    Shader ourShader("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
+    // QUANTIZED: positions come in as 16 bit unorm and are dequantized in the vertex shader
+    ShaderVariants variants("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
+    Shader &ourShader = variants.get({"QUANTIZED"});
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     float vertices[] = {
@@ -95,18 +100,19 @@ int main(int argc, char** argv) {
             -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
             -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
     };
-    unsigned int VAO, VBO;// Vertex Array Object (which will hold a VBO+EBO)
-    glGenVertexArrays(1, &VAO);
+    // 20 byte float vertices -> 12 byte quantized ones (8 position + 4 half float uv)
+    PackedMesh cube = PackedMesh::pack(Mesh::fromInterleaved(vertices, 36, 5, 0, 3));
+    cube.printReport();
+    unsigned int VBO;
     glGenBuffers(1, &VBO);
-    glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind buffer ID to unique buffer type (this is for vertices)
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // copy vertex data into buffer
-    // vertex position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // texture1 attribute
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)(3*sizeof(float)));
-    glEnableVertexAttribArray(1);
+    glBufferData(GL_ARRAY_BUFFER, cube.vertices.size(), cube.vertices.data(), GL_STATIC_DRAW); // copy vertex data into buffer
+    // vertex position and texture1 attributes
+    VertexLayout layout = cube.layout();
+    if (!layout.validate(ourShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    // Vertex Array Object (which will hold a VBO+EBO), from the GLObjectPool
+    GLVertexArray VAO = layout.createVertexArray(VBO);
 
     // TEXTURE
     // Create texture1
@@ -147,9 +153,6 @@ int main(int argc, char** argv) {
     }
     stbi_image_free(data); // free image data from memory
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
     glViewport(0,0,800,600);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
@@ -189,13 +192,14 @@ int main(int argc, char** argv) {
         ourShader.use();
         ourShader.setInt("texture1", 0);
         ourShader.setInt("texture2", 1);
+        cube.setUniforms(ourShader);
         glActiveTexture(GL_TEXTURE0); // this 0 matches the int value in setInt
         glBindTexture(GL_TEXTURE_2D, texture1);
         glActiveTexture(GL_TEXTURE1); // this 1 matches the int value in setInt
         glBindTexture(GL_TEXTURE_2D, texture2);
 
         /*! bind the buffer and draw the shape you want... */
-        glBindVertexArray(VAO);
+        glBindVertexArray(VAO.id());
 
         /*! Transform the object */
 
@@ -228,6 +232,8 @@ int main(int argc, char** argv) {
             glDrawArrays(GL_TRIANGLES, 0, 36);
         }
 
+        // GLAD_TRACE builds: print this frame's GL call histogram
+        gladTraceEndFrame();
         // will swap the color buffer: a large 2D buffer that contains color values for each pixel in GLFW window
         glfwSwapBuffers(window);
         // Checks if any events have triggered
@@ -235,9 +241,14 @@ int main(int argc, char** argv) {
     }
 
     // deallocate all resources
-    glDeleteVertexArrays(1, &VAO);
+    VAO.reset();
     glDeleteBuffers(1, &VBO);
+    glDeleteTextures(1, &texture1);
+    glDeleteTextures(1, &texture2);
+    GLObjectPool::shared().shutdown();
+    variants.deletePrograms();
 
+    gladTraceSummary();
     // terminate GLFW
     glfwTerminate();
 
@@ -12,11 +12,13 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "../Shader.h"
+#include "../glad_trace.h"
+#include "../FrameLoop.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 void processInput(GLFWwindow *window);
-void translateModel(GLFWwindow *window, glm::mat4 &model);
+void translateModel(GLFWwindow *window, glm::vec3 &position);
 void shaderProgramStatus(const unsigned int &ID, const std::string &type);
 
 // Settings
@@ -36,6 +38,9 @@ int main(int argc, char** argv) {
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
+    // --tick / --fps / --no-vsync: simulation rate and render rate are set independently
+    FrameLoop loop(argc, argv);
+
     // Create window object
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
     if (window == nullptr) {
@@ -48,6 +53,7 @@ int main(int argc, char** argv) {
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         std::cout << "Failed to initialize GLAD" << std::endl;
     }
+    loop.contextCreated();
 
     // SHADER
     Shader ourShader("../shaders/coord_shader.glsl", "../shaders/fragment_shader_tex.glsl");
@@ -163,7 +169,7 @@ int main(int argc, char** argv) {
     // Have openGL only render the texture that has the closest z-value
     glEnable(GL_DEPTH_TEST);
 
-    glm::mat4 model(1.0f);
+    glm::vec3 position(0.0f), previousPosition(0.0f); // model position now and before the last update
     // Create render loop: each iteration of loop is called a "frame"
     while(!glfwWindowShouldClose(window)) {
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
@@ -171,6 +177,11 @@ int main(int argc, char** argv) {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         processInput(window);
+        // move the model at a fixed rate, however fast we happen to render
+        for (int steps = loop.advance(glfwGetTime()); steps > 0; --steps) {
+            previousPosition = position;
+            translateModel(window, position);
+        }
 
         /*! using Shader Class */
         // Learning Shader
@@ -198,21 +209,28 @@ int main(int argc, char** argv) {
         ourShader.setMat4("view", view);
         ourShader.setMat4("projection", projection);
         // model matrix
-        translateModel(window, model);
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::mix(previousPosition, position, loop.alpha()));
         ourShader.setMat4("model", model);
 
         glDrawArrays(GL_TRIANGLES, 0, 36);
 
+        // GLAD_TRACE builds: print this frame's GL call histogram
+        gladTraceEndFrame();
         // will swap the color buffer: a large 2D buffer that contains color values for each pixel in GLFW window
         glfwSwapBuffers(window);
         // Checks if any events have triggered
         glfwPollEvents();
+        loop.endFrame();
     }
 
     // deallocate all resources
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
+    glDeleteTextures(1, &texture1);
+    glDeleteTextures(1, &texture2);
+    glDeleteProgram(ourShader.ID);
 
+    gladTraceSummary();
     // terminate GLFW
     glfwTerminate();
 
@@ -234,32 +252,33 @@ void processInput(GLFWwindow *window) {
     if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS)
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 }
-void translateModel(GLFWwindow *window, glm::mat4 &model) {
+void translateModel(GLFWwindow *window, glm::vec3 &position) {
+    /// Moves 0.05 per update step (60 per second by default)
     if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS) {
         if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
             // Translate away from camera
-            model = glm::translate(model, glm::vec3(0.0f, 0.0f, -0.05f));
+            position += glm::vec3(0.0f, 0.0f, -0.05f);
         }
         if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {
             // Translate toward camera
-            model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.05f));
+            position += glm::vec3(0.0f, 0.0f, 0.05f);
         }
     } else {
         if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) {
             // Translate left
-            model = glm::translate(model, glm::vec3(-0.05f, 0.0f, 0.0f));
+            position += glm::vec3(-0.05f, 0.0f, 0.0f);
         }
         if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {
             // Translate right
-            model = glm::translate(model, glm::vec3(0.05f, 0.0f, 0.0f));
+            position += glm::vec3(0.05f, 0.0f, 0.0f);
         }
         if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
             // Translate up
-            model = glm::translate(model, glm::vec3(0.0f, 0.05f, 0.0f));
+            position += glm::vec3(0.0f, 0.05f, 0.0f);
         }
         if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {
             // Translate down
-            model = glm::translate(model, glm::vec3(0.0f, -0.05f, 0.0f));
+            position += glm::vec3(0.0f, -0.05f, 0.0f);
         }
     }
 
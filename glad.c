@@ -19,6 +19,9 @@
         https://glad.dav1d.de/#profile=core&language=c&specification=gl&api=gl%3D4.6
 */
 
+#if defined(GLAD_TRACE) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L /* clock_gettime */
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -33,95 +36,89 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+/* glad_ext_hash.h is generated at build time by cmake/glad_ext_hash.cmake from the
+ * GLAD_EXTENSIONS list in CMakeLists.txt: a perfect hash table of the extension names
+ * we detect plus their GLAD_GL_* flags. Each name the driver reports is filtered by
+ * length, hashed once and compared against at most one table entry, and has_ext is a
+ * single lookup. */
+#include "glad_ext_hash.h"
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static khronos_uint32_t ext_slot(const char *ext, size_t len) {
+    khronos_uint32_t h = 2166136261u ^ GLAD_EXT_HASH_SEED;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)ext[i]) * 16777619u;
+    }
+    return (h ^ (h >> 16)) & (GLAD_EXT_HASH_SIZE - 1);
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static void mark_ext(const char *ext, size_t len) {
+    khronos_uint32_t slot;
+    const char *name;
+    if(!glad_ext_hash_lengths[len & 63]) {
+        return;
+    }
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+    slot = ext_slot(ext, len);
+    name = glad_ext_hash_names[slot];
+    if(name != NULL && strncmp(name, ext, len) == 0 && name[len] == '\0') {
+        *glad_ext_hash_flags[slot] = 1;
     }
-#endif
-    return 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
+static int get_exts(void) {
+    int slot;
+    for(slot = 0; slot < GLAD_EXT_HASH_SIZE; slot++) {
+        if(glad_ext_hash_flags[slot] != NULL) {
+            *glad_ext_hash_flags[slot] = 0;
         }
-        free((void *)exts_i);
-        exts_i = NULL;
     }
-}
-
-static int has_ext(const char *ext) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
+        const char *extensions = (const char *)glGetString(GL_EXTENSIONS);
         const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        if(extensions == NULL) {
             return 0;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
+        while(*extensions != '\0') {
+            terminator = strchr(extensions, ' ');
+            if(terminator == NULL) {
+                terminator = extensions + strlen(extensions);
             }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+            if(terminator != extensions) {
+                mark_ext(extensions, (size_t)(terminator - extensions));
             }
-            extensions = terminator;
+            extensions = *terminator == ' ' ? terminator + 1 : terminator;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        int num_exts_i = 0;
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        for(index = 0; index < num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, (unsigned)index);
+            if(gl_str_tmp != NULL) {
+                mark_ext(gl_str_tmp, strlen(gl_str_tmp));
             }
         }
     }
 #endif
+    return 1;
+}
 
-    return 0;
+static int has_ext(const char *ext) {
+    khronos_uint32_t slot;
+    const char *name;
+    if(ext == NULL) {
+        return 0;
+    }
+
+    slot = ext_slot(ext, strlen(ext));
+    name = glad_ext_hash_names[slot];
+    return name != NULL && strcmp(name, ext) == 0 && *glad_ext_hash_flags[slot];
 }
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
@@ -841,484 +838,7544 @@ PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
 PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
 PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
-static void load_GL_VERSION_1_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_0) return;
-	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
-	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
-	glad_glHint = (PFNGLHINTPROC)load("glHint");
-	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
-	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
-	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
-	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
-	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
-	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
-	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
-	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
-	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
-	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
-	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
-	glad_glClear = (PFNGLCLEARPROC)load("glClear");
-	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
-	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
-	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
-	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
-	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
-	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
-	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
-	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
-	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
-	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
-	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
-	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
-	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
-	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
-	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
-	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
-	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
-	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
-	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
-	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
-	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
-	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
-	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
-	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
-	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
-	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
-	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
-	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
-	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
-	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
-	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
-	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+/* GLAD_LAZY_LOAD: each glad_gl* pointer starts out as a trampoline that resolves
+ * the entry point through the loader on its first call and then patches itself
+ * out, so gladLoadGLLoader only looks up glGetString. The loader passed in must
+ * stay usable (context current) until the last function is first called. */
+#ifdef GLAD_LAZY_LOAD
+static GLADloadproc glad_lazy_load = NULL;
+/* an entry point the driver doesn't have: the trampoline stays in place (so the
+ * pointer is never NULL and a call never goes through NULL), the call does nothing
+ * and returns 0; reported once per function */
+static void glad_lazy_missing(const char *name) {
+	static const char *reported[64];
+	static int reportedCount = 0;
+	int i;
+	for(i = 0; i < reportedCount; ++i)
+		if(reported[i] == name) return;
+	if(reportedCount < 64) reported[reportedCount++] = name;
+	printf("ERROR::GLAD::MISSING_ENTRY_POINT %s\n", name);
 }
-static void load_GL_VERSION_1_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_1) return;
-	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
-	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
-	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
-	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
-	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
-	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
-	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
-	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
-	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
-	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
-	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
-	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
-	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_load("glCullFace");
+	if(glad_glCullFace == NULL) {
+		glad_glCullFace = glad_lazy_glCullFace;
+		glad_lazy_missing("glCullFace");
+		return;
+	}
+	glad_glCullFace(mode);
 }
-static void load_GL_VERSION_1_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_2) return;
-	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
-	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
-	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
-	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_load("glFrontFace");
+	if(glad_glFrontFace == NULL) {
+		glad_glFrontFace = glad_lazy_glFrontFace;
+		glad_lazy_missing("glFrontFace");
+		return;
+	}
+	glad_glFrontFace(mode);
 }
-static void load_GL_VERSION_1_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_3) return;
-	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
-	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
-	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
-	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
-	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
-	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
-	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
-	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
-	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)glad_lazy_load("glHint");
+	if(glad_glHint == NULL) {
+		glad_glHint = glad_lazy_glHint;
+		glad_lazy_missing("glHint");
+		return;
+	}
+	glad_glHint(target, mode);
 }
-static void load_GL_VERSION_1_4(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_4) return;
-	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
-	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
-	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
-	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
-	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
-	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
-	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
-	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
-	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_load("glLineWidth");
+	if(glad_glLineWidth == NULL) {
+		glad_glLineWidth = glad_lazy_glLineWidth;
+		glad_lazy_missing("glLineWidth");
+		return;
+	}
+	glad_glLineWidth(width);
 }
-static void load_GL_VERSION_1_5(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_5) return;
-	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
-	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
-	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
-	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
-	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
-	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
-	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
-	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
-	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
-	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
-	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
-	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
-	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
-	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
-	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
-	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
-	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
-	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
-	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_load("glPointSize");
+	if(glad_glPointSize == NULL) {
+		glad_glPointSize = glad_lazy_glPointSize;
+		glad_lazy_missing("glPointSize");
+		return;
+	}
+	glad_glPointSize(size);
 }
-static void load_GL_VERSION_2_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_2_0) return;
-	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
-	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
-	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
-	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
-	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
-	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
-	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
-	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
-	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
-	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
-	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
-	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
-	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
-	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
-	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
-	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
-	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
-	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
-	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
-	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
-	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
-	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
-	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
-	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
-	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
-	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
-	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
-	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
-	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
-	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
-	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
-	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
-	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
-	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
-	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
-	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
-	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
-	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
-	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
-	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
-	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
-	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
-	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
-	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
-	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
-	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
-	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
-	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
-	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
-	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
-	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
-	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
-	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
-	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
-	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
-	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
-	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
-	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
-	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
-	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
-	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
-	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
-	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
-	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
-	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
-	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
-	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
-	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
-	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
-	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
-	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
-	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
-	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
-	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
-	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
-	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
-	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
-	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
-	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
-	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
-	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
-	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
-	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
-	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
-	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
-	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
-	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
-	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
-	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
-	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
-	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
-	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
-	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_load("glPolygonMode");
+	if(glad_glPolygonMode == NULL) {
+		glad_glPolygonMode = glad_lazy_glPolygonMode;
+		glad_lazy_missing("glPolygonMode");
+		return;
+	}
+	glad_glPolygonMode(face, mode);
 }
-static void load_GL_VERSION_2_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_2_1) return;
-	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
-	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
-	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
-	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
-	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
-	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)glad_lazy_load("glScissor");
+	if(glad_glScissor == NULL) {
+		glad_glScissor = glad_lazy_glScissor;
+		glad_lazy_missing("glScissor");
+		return;
+	}
+	glad_glScissor(x, y, width, height);
 }
-static void load_GL_VERSION_3_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_0) return;
-	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
-	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
-	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
-	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
-	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
-	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
-	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
-	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
-	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
-	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
-	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
-	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
-	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
-	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
-	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
-	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
-	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
-	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
-	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
-	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
-	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
-	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
-	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
-	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
-	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
-	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
-	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
-	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
-	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
-	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
-	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
-	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
-	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
-	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
-	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
-	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
-	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
-	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
-	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
-	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
-	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
-	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
-	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
-	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
-	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
-	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
-	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
-	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
-	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
-	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
-	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
-	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
-	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
-	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
-	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
-	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
-	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
-	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
-	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
-	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
-	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
-	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
-	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
-	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
-	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
-	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
-	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
-	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
-	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
-	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
-	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
-	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
-	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
-	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
-	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
-	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
-	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
-	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
-	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
-	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
-	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
-	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
-	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
-	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_load("glTexParameterf");
+	if(glad_glTexParameterf == NULL) {
+		glad_glTexParameterf = glad_lazy_glTexParameterf;
+		glad_lazy_missing("glTexParameterf");
+		return;
+	}
+	glad_glTexParameterf(target, pname, param);
 }
-static void load_GL_VERSION_3_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_1) return;
-	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
-	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
-	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
-	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
-	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
-	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
-	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
-	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
-	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
-	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
-	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
-	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
-	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
-	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
-	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_load("glTexParameterfv");
+	if(glad_glTexParameterfv == NULL) {
+		glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+		glad_lazy_missing("glTexParameterfv");
+		return;
+	}
+	glad_glTexParameterfv(target, pname, params);
 }
-static void load_GL_VERSION_3_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_2) return;
-	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
-	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
-	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
-	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
-	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
-	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
-	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
-	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
-	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
-	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
-	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
-	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
-	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
-	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
-	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
-	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
-	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
-	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
-	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_load("glTexParameteri");
+	if(glad_glTexParameteri == NULL) {
+		glad_glTexParameteri = glad_lazy_glTexParameteri;
+		glad_lazy_missing("glTexParameteri");
+		return;
+	}
+	glad_glTexParameteri(target, pname, param);
 }
-static void load_GL_VERSION_3_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_3) return;
-	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
-	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
-	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
-	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
-	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
-	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
-	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
-	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
-	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
-	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
-	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
-	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
-	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
-	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
-	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
-	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
-	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
-	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
-	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
-	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
-	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
-	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
-	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
-	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
-	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
-	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
-	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
-	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
-	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
-	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
-	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
-	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
-	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
-	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
-	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
-	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
-	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
-	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
-	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
-	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
-	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
-	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
-	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
-	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
-	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
-	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
-	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
-	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
-	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
-	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
-	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
-	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
-	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
-	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
-	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
-	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
-	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
-	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_load("glTexParameteriv");
+	if(glad_glTexParameteriv == NULL) {
+		glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+		glad_lazy_missing("glTexParameteriv");
+		return;
+	}
+	glad_glTexParameteriv(target, pname, params);
 }
-static void load_GL_VERSION_4_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_0) return;
-	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
-	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
-	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
-	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
-	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
-	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
-	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
-	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
-	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
-	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
-	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
-	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
-	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
-	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
-	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
-	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
-	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
-	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
-	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
-	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
-	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
-	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
-	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
-	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
-	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
-	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
-	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
-	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
-	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
-	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
-	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
-	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
-	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
-	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
-	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
-	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
-	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
-	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
-	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
-	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
-	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
-	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
-	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
-	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
-	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
-	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_load("glTexImage1D");
+	if(glad_glTexImage1D == NULL) {
+		glad_glTexImage1D = glad_lazy_glTexImage1D;
+		glad_lazy_missing("glTexImage1D");
+		return;
+	}
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
 }
-static void load_GL_VERSION_4_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_1) return;
-	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
-	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
-	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
-	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
-	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
-	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
-	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
-	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
-	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
-	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
-	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
-	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
-	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
-	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_load("glTexImage2D");
+	if(glad_glTexImage2D == NULL) {
+		glad_glTexImage2D = glad_lazy_glTexImage2D;
+		glad_lazy_missing("glTexImage2D");
+		return;
+	}
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_load("glDrawBuffer");
+	if(glad_glDrawBuffer == NULL) {
+		glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+		glad_lazy_missing("glDrawBuffer");
+		return;
+	}
+	glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)glad_lazy_load("glClear");
+	if(glad_glClear == NULL) {
+		glad_glClear = glad_lazy_glClear;
+		glad_lazy_missing("glClear");
+		return;
+	}
+	glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_load("glClearColor");
+	if(glad_glClearColor == NULL) {
+		glad_glClearColor = glad_lazy_glClearColor;
+		glad_lazy_missing("glClearColor");
+		return;
+	}
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_load("glClearStencil");
+	if(glad_glClearStencil == NULL) {
+		glad_glClearStencil = glad_lazy_glClearStencil;
+		glad_lazy_missing("glClearStencil");
+		return;
+	}
+	glad_glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_load("glClearDepth");
+	if(glad_glClearDepth == NULL) {
+		glad_glClearDepth = glad_lazy_glClearDepth;
+		glad_lazy_missing("glClearDepth");
+		return;
+	}
+	glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_load("glStencilMask");
+	if(glad_glStencilMask == NULL) {
+		glad_glStencilMask = glad_lazy_glStencilMask;
+		glad_lazy_missing("glStencilMask");
+		return;
+	}
+	glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_load("glColorMask");
+	if(glad_glColorMask == NULL) {
+		glad_glColorMask = glad_lazy_glColorMask;
+		glad_lazy_missing("glColorMask");
+		return;
+	}
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_load("glDepthMask");
+	if(glad_glDepthMask == NULL) {
+		glad_glDepthMask = glad_lazy_glDepthMask;
+		glad_lazy_missing("glDepthMask");
+		return;
+	}
+	glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)glad_lazy_load("glDisable");
+	if(glad_glDisable == NULL) {
+		glad_glDisable = glad_lazy_glDisable;
+		glad_lazy_missing("glDisable");
+		return;
+	}
+	glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)glad_lazy_load("glEnable");
+	if(glad_glEnable == NULL) {
+		glad_glEnable = glad_lazy_glEnable;
+		glad_lazy_missing("glEnable");
+		return;
+	}
+	glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)glad_lazy_load("glFinish");
+	if(glad_glFinish == NULL) {
+		glad_glFinish = glad_lazy_glFinish;
+		glad_lazy_missing("glFinish");
+		return;
+	}
+	glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)glad_lazy_load("glFlush");
+	if(glad_glFlush == NULL) {
+		glad_glFlush = glad_lazy_glFlush;
+		glad_lazy_missing("glFlush");
+		return;
+	}
+	glad_glFlush();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_load("glBlendFunc");
+	if(glad_glBlendFunc == NULL) {
+		glad_glBlendFunc = glad_lazy_glBlendFunc;
+		glad_lazy_missing("glBlendFunc");
+		return;
+	}
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_load("glLogicOp");
+	if(glad_glLogicOp == NULL) {
+		glad_glLogicOp = glad_lazy_glLogicOp;
+		glad_lazy_missing("glLogicOp");
+		return;
+	}
+	glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_load("glStencilFunc");
+	if(glad_glStencilFunc == NULL) {
+		glad_glStencilFunc = glad_lazy_glStencilFunc;
+		glad_lazy_missing("glStencilFunc");
+		return;
+	}
+	glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_load("glStencilOp");
+	if(glad_glStencilOp == NULL) {
+		glad_glStencilOp = glad_lazy_glStencilOp;
+		glad_lazy_missing("glStencilOp");
+		return;
+	}
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_load("glDepthFunc");
+	if(glad_glDepthFunc == NULL) {
+		glad_glDepthFunc = glad_lazy_glDepthFunc;
+		glad_lazy_missing("glDepthFunc");
+		return;
+	}
+	glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_load("glPixelStoref");
+	if(glad_glPixelStoref == NULL) {
+		glad_glPixelStoref = glad_lazy_glPixelStoref;
+		glad_lazy_missing("glPixelStoref");
+		return;
+	}
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_load("glPixelStorei");
+	if(glad_glPixelStorei == NULL) {
+		glad_glPixelStorei = glad_lazy_glPixelStorei;
+		glad_lazy_missing("glPixelStorei");
+		return;
+	}
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_load("glReadBuffer");
+	if(glad_glReadBuffer == NULL) {
+		glad_glReadBuffer = glad_lazy_glReadBuffer;
+		glad_lazy_missing("glReadBuffer");
+		return;
+	}
+	glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_load("glReadPixels");
+	if(glad_glReadPixels == NULL) {
+		glad_glReadPixels = glad_lazy_glReadPixels;
+		glad_lazy_missing("glReadPixels");
+		return;
+	}
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_load("glGetBooleanv");
+	if(glad_glGetBooleanv == NULL) {
+		glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+		glad_lazy_missing("glGetBooleanv");
+		return;
+	}
+	glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_load("glGetDoublev");
+	if(glad_glGetDoublev == NULL) {
+		glad_glGetDoublev = glad_lazy_glGetDoublev;
+		glad_lazy_missing("glGetDoublev");
+		return;
+	}
+	glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)glad_lazy_load("glGetError");
+	if(glad_glGetError == NULL) {
+		glad_glGetError = glad_lazy_glGetError;
+		glad_lazy_missing("glGetError");
+		return (GLenum)0;
+	}
+	return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_load("glGetFloatv");
+	if(glad_glGetFloatv == NULL) {
+		glad_glGetFloatv = glad_lazy_glGetFloatv;
+		glad_lazy_missing("glGetFloatv");
+		return;
+	}
+	glad_glGetFloatv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_load("glGetIntegerv");
+	if(glad_glGetIntegerv == NULL) {
+		glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+		glad_lazy_missing("glGetIntegerv");
+		return;
+	}
+	glad_glGetIntegerv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_load("glGetTexImage");
+	if(glad_glGetTexImage == NULL) {
+		glad_glGetTexImage = glad_lazy_glGetTexImage;
+		glad_lazy_missing("glGetTexImage");
+		return;
+	}
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_load("glGetTexParameterfv");
+	if(glad_glGetTexParameterfv == NULL) {
+		glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+		glad_lazy_missing("glGetTexParameterfv");
+		return;
+	}
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_load("glGetTexParameteriv");
+	if(glad_glGetTexParameteriv == NULL) {
+		glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+		glad_lazy_missing("glGetTexParameteriv");
+		return;
+	}
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_load("glGetTexLevelParameterfv");
+	if(glad_glGetTexLevelParameterfv == NULL) {
+		glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+		glad_lazy_missing("glGetTexLevelParameterfv");
+		return;
+	}
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_load("glGetTexLevelParameteriv");
+	if(glad_glGetTexLevelParameteriv == NULL) {
+		glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+		glad_lazy_missing("glGetTexLevelParameteriv");
+		return;
+	}
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_load("glIsEnabled");
+	if(glad_glIsEnabled == NULL) {
+		glad_glIsEnabled = glad_lazy_glIsEnabled;
+		glad_lazy_missing("glIsEnabled");
+		return (GLboolean)0;
+	}
+	return glad_glIsEnabled(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_load("glDepthRange");
+	if(glad_glDepthRange == NULL) {
+		glad_glDepthRange = glad_lazy_glDepthRange;
+		glad_lazy_missing("glDepthRange");
+		return;
+	}
+	glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_load("glViewport");
+	if(glad_glViewport == NULL) {
+		glad_glViewport = glad_lazy_glViewport;
+		glad_lazy_missing("glViewport");
+		return;
+	}
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_load("glDrawArrays");
+	if(glad_glDrawArrays == NULL) {
+		glad_glDrawArrays = glad_lazy_glDrawArrays;
+		glad_lazy_missing("glDrawArrays");
+		return;
+	}
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_load("glDrawElements");
+	if(glad_glDrawElements == NULL) {
+		glad_glDrawElements = glad_lazy_glDrawElements;
+		glad_lazy_missing("glDrawElements");
+		return;
+	}
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_load("glPolygonOffset");
+	if(glad_glPolygonOffset == NULL) {
+		glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+		glad_lazy_missing("glPolygonOffset");
+		return;
+	}
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_load("glCopyTexImage1D");
+	if(glad_glCopyTexImage1D == NULL) {
+		glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+		glad_lazy_missing("glCopyTexImage1D");
+		return;
+	}
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_load("glCopyTexImage2D");
+	if(glad_glCopyTexImage2D == NULL) {
+		glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+		glad_lazy_missing("glCopyTexImage2D");
+		return;
+	}
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_load("glCopyTexSubImage1D");
+	if(glad_glCopyTexSubImage1D == NULL) {
+		glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+		glad_lazy_missing("glCopyTexSubImage1D");
+		return;
+	}
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_load("glCopyTexSubImage2D");
+	if(glad_glCopyTexSubImage2D == NULL) {
+		glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+		glad_lazy_missing("glCopyTexSubImage2D");
+		return;
+	}
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_load("glTexSubImage1D");
+	if(glad_glTexSubImage1D == NULL) {
+		glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+		glad_lazy_missing("glTexSubImage1D");
+		return;
+	}
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_load("glTexSubImage2D");
+	if(glad_glTexSubImage2D == NULL) {
+		glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+		glad_lazy_missing("glTexSubImage2D");
+		return;
+	}
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_load("glBindTexture");
+	if(glad_glBindTexture == NULL) {
+		glad_glBindTexture = glad_lazy_glBindTexture;
+		glad_lazy_missing("glBindTexture");
+		return;
+	}
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_load("glDeleteTextures");
+	if(glad_glDeleteTextures == NULL) {
+		glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+		glad_lazy_missing("glDeleteTextures");
+		return;
+	}
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_load("glGenTextures");
+	if(glad_glGenTextures == NULL) {
+		glad_glGenTextures = glad_lazy_glGenTextures;
+		glad_lazy_missing("glGenTextures");
+		return;
+	}
+	glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_load("glIsTexture");
+	if(glad_glIsTexture == NULL) {
+		glad_glIsTexture = glad_lazy_glIsTexture;
+		glad_lazy_missing("glIsTexture");
+		return (GLboolean)0;
+	}
+	return glad_glIsTexture(texture);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_load("glDrawRangeElements");
+	if(glad_glDrawRangeElements == NULL) {
+		glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+		glad_lazy_missing("glDrawRangeElements");
+		return;
+	}
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_load("glTexImage3D");
+	if(glad_glTexImage3D == NULL) {
+		glad_glTexImage3D = glad_lazy_glTexImage3D;
+		glad_lazy_missing("glTexImage3D");
+		return;
+	}
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_load("glTexSubImage3D");
+	if(glad_glTexSubImage3D == NULL) {
+		glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+		glad_lazy_missing("glTexSubImage3D");
+		return;
+	}
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_load("glCopyTexSubImage3D");
+	if(glad_glCopyTexSubImage3D == NULL) {
+		glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+		glad_lazy_missing("glCopyTexSubImage3D");
+		return;
+	}
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_load("glActiveTexture");
+	if(glad_glActiveTexture == NULL) {
+		glad_glActiveTexture = glad_lazy_glActiveTexture;
+		glad_lazy_missing("glActiveTexture");
+		return;
+	}
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_load("glSampleCoverage");
+	if(glad_glSampleCoverage == NULL) {
+		glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+		glad_lazy_missing("glSampleCoverage");
+		return;
+	}
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_load("glCompressedTexImage3D");
+	if(glad_glCompressedTexImage3D == NULL) {
+		glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+		glad_lazy_missing("glCompressedTexImage3D");
+		return;
+	}
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_load("glCompressedTexImage2D");
+	if(glad_glCompressedTexImage2D == NULL) {
+		glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+		glad_lazy_missing("glCompressedTexImage2D");
+		return;
+	}
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_load("glCompressedTexImage1D");
+	if(glad_glCompressedTexImage1D == NULL) {
+		glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+		glad_lazy_missing("glCompressedTexImage1D");
+		return;
+	}
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_load("glCompressedTexSubImage3D");
+	if(glad_glCompressedTexSubImage3D == NULL) {
+		glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+		glad_lazy_missing("glCompressedTexSubImage3D");
+		return;
+	}
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_load("glCompressedTexSubImage2D");
+	if(glad_glCompressedTexSubImage2D == NULL) {
+		glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+		glad_lazy_missing("glCompressedTexSubImage2D");
+		return;
+	}
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_load("glCompressedTexSubImage1D");
+	if(glad_glCompressedTexSubImage1D == NULL) {
+		glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+		glad_lazy_missing("glCompressedTexSubImage1D");
+		return;
+	}
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_load("glGetCompressedTexImage");
+	if(glad_glGetCompressedTexImage == NULL) {
+		glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+		glad_lazy_missing("glGetCompressedTexImage");
+		return;
+	}
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_load("glBlendFuncSeparate");
+	if(glad_glBlendFuncSeparate == NULL) {
+		glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+		glad_lazy_missing("glBlendFuncSeparate");
+		return;
+	}
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_load("glMultiDrawArrays");
+	if(glad_glMultiDrawArrays == NULL) {
+		glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+		glad_lazy_missing("glMultiDrawArrays");
+		return;
+	}
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_load("glMultiDrawElements");
+	if(glad_glMultiDrawElements == NULL) {
+		glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+		glad_lazy_missing("glMultiDrawElements");
+		return;
+	}
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_load("glPointParameterf");
+	if(glad_glPointParameterf == NULL) {
+		glad_glPointParameterf = glad_lazy_glPointParameterf;
+		glad_lazy_missing("glPointParameterf");
+		return;
+	}
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_load("glPointParameterfv");
+	if(glad_glPointParameterfv == NULL) {
+		glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+		glad_lazy_missing("glPointParameterfv");
+		return;
+	}
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_load("glPointParameteri");
+	if(glad_glPointParameteri == NULL) {
+		glad_glPointParameteri = glad_lazy_glPointParameteri;
+		glad_lazy_missing("glPointParameteri");
+		return;
+	}
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_load("glPointParameteriv");
+	if(glad_glPointParameteriv == NULL) {
+		glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+		glad_lazy_missing("glPointParameteriv");
+		return;
+	}
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_load("glBlendColor");
+	if(glad_glBlendColor == NULL) {
+		glad_glBlendColor = glad_lazy_glBlendColor;
+		glad_lazy_missing("glBlendColor");
+		return;
+	}
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_load("glBlendEquation");
+	if(glad_glBlendEquation == NULL) {
+		glad_glBlendEquation = glad_lazy_glBlendEquation;
+		glad_lazy_missing("glBlendEquation");
+		return;
+	}
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_load("glGenQueries");
+	if(glad_glGenQueries == NULL) {
+		glad_glGenQueries = glad_lazy_glGenQueries;
+		glad_lazy_missing("glGenQueries");
+		return;
+	}
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_load("glDeleteQueries");
+	if(glad_glDeleteQueries == NULL) {
+		glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+		glad_lazy_missing("glDeleteQueries");
+		return;
+	}
+	glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_load("glIsQuery");
+	if(glad_glIsQuery == NULL) {
+		glad_glIsQuery = glad_lazy_glIsQuery;
+		glad_lazy_missing("glIsQuery");
+		return (GLboolean)0;
+	}
+	return glad_glIsQuery(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_load("glBeginQuery");
+	if(glad_glBeginQuery == NULL) {
+		glad_glBeginQuery = glad_lazy_glBeginQuery;
+		glad_lazy_missing("glBeginQuery");
+		return;
+	}
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_load("glEndQuery");
+	if(glad_glEndQuery == NULL) {
+		glad_glEndQuery = glad_lazy_glEndQuery;
+		glad_lazy_missing("glEndQuery");
+		return;
+	}
+	glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_load("glGetQueryiv");
+	if(glad_glGetQueryiv == NULL) {
+		glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+		glad_lazy_missing("glGetQueryiv");
+		return;
+	}
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_load("glGetQueryObjectiv");
+	if(glad_glGetQueryObjectiv == NULL) {
+		glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+		glad_lazy_missing("glGetQueryObjectiv");
+		return;
+	}
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_load("glGetQueryObjectuiv");
+	if(glad_glGetQueryObjectuiv == NULL) {
+		glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+		glad_lazy_missing("glGetQueryObjectuiv");
+		return;
+	}
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_load("glBindBuffer");
+	if(glad_glBindBuffer == NULL) {
+		glad_glBindBuffer = glad_lazy_glBindBuffer;
+		glad_lazy_missing("glBindBuffer");
+		return;
+	}
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_load("glDeleteBuffers");
+	if(glad_glDeleteBuffers == NULL) {
+		glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+		glad_lazy_missing("glDeleteBuffers");
+		return;
+	}
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_load("glGenBuffers");
+	if(glad_glGenBuffers == NULL) {
+		glad_glGenBuffers = glad_lazy_glGenBuffers;
+		glad_lazy_missing("glGenBuffers");
+		return;
+	}
+	glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_load("glIsBuffer");
+	if(glad_glIsBuffer == NULL) {
+		glad_glIsBuffer = glad_lazy_glIsBuffer;
+		glad_lazy_missing("glIsBuffer");
+		return (GLboolean)0;
+	}
+	return glad_glIsBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_load("glBufferData");
+	if(glad_glBufferData == NULL) {
+		glad_glBufferData = glad_lazy_glBufferData;
+		glad_lazy_missing("glBufferData");
+		return;
+	}
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_load("glBufferSubData");
+	if(glad_glBufferSubData == NULL) {
+		glad_glBufferSubData = glad_lazy_glBufferSubData;
+		glad_lazy_missing("glBufferSubData");
+		return;
+	}
+	glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_load("glGetBufferSubData");
+	if(glad_glGetBufferSubData == NULL) {
+		glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+		glad_lazy_missing("glGetBufferSubData");
+		return;
+	}
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void *APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_load("glMapBuffer");
+	if(glad_glMapBuffer == NULL) {
+		glad_glMapBuffer = glad_lazy_glMapBuffer;
+		glad_lazy_missing("glMapBuffer");
+		return (void *)0;
+	}
+	return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_load("glUnmapBuffer");
+	if(glad_glUnmapBuffer == NULL) {
+		glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+		glad_lazy_missing("glUnmapBuffer");
+		return (GLboolean)0;
+	}
+	return glad_glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_load("glGetBufferParameteriv");
+	if(glad_glGetBufferParameteriv == NULL) {
+		glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+		glad_lazy_missing("glGetBufferParameteriv");
+		return;
+	}
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_load("glGetBufferPointerv");
+	if(glad_glGetBufferPointerv == NULL) {
+		glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+		glad_lazy_missing("glGetBufferPointerv");
+		return;
+	}
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_load("glBlendEquationSeparate");
+	if(glad_glBlendEquationSeparate == NULL) {
+		glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+		glad_lazy_missing("glBlendEquationSeparate");
+		return;
+	}
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_load("glDrawBuffers");
+	if(glad_glDrawBuffers == NULL) {
+		glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+		glad_lazy_missing("glDrawBuffers");
+		return;
+	}
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_load("glStencilOpSeparate");
+	if(glad_glStencilOpSeparate == NULL) {
+		glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+		glad_lazy_missing("glStencilOpSeparate");
+		return;
+	}
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_load("glStencilFuncSeparate");
+	if(glad_glStencilFuncSeparate == NULL) {
+		glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+		glad_lazy_missing("glStencilFuncSeparate");
+		return;
+	}
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_load("glStencilMaskSeparate");
+	if(glad_glStencilMaskSeparate == NULL) {
+		glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+		glad_lazy_missing("glStencilMaskSeparate");
+		return;
+	}
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_load("glAttachShader");
+	if(glad_glAttachShader == NULL) {
+		glad_glAttachShader = glad_lazy_glAttachShader;
+		glad_lazy_missing("glAttachShader");
+		return;
+	}
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_load("glBindAttribLocation");
+	if(glad_glBindAttribLocation == NULL) {
+		glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+		glad_lazy_missing("glBindAttribLocation");
+		return;
+	}
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_load("glCompileShader");
+	if(glad_glCompileShader == NULL) {
+		glad_glCompileShader = glad_lazy_glCompileShader;
+		glad_lazy_missing("glCompileShader");
+		return;
+	}
+	glad_glCompileShader(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_load("glCreateProgram");
+	if(glad_glCreateProgram == NULL) {
+		glad_glCreateProgram = glad_lazy_glCreateProgram;
+		glad_lazy_missing("glCreateProgram");
+		return (GLuint)0;
+	}
+	return glad_glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_load("glCreateShader");
+	if(glad_glCreateShader == NULL) {
+		glad_glCreateShader = glad_lazy_glCreateShader;
+		glad_lazy_missing("glCreateShader");
+		return (GLuint)0;
+	}
+	return glad_glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_load("glDeleteProgram");
+	if(glad_glDeleteProgram == NULL) {
+		glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+		glad_lazy_missing("glDeleteProgram");
+		return;
+	}
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_load("glDeleteShader");
+	if(glad_glDeleteShader == NULL) {
+		glad_glDeleteShader = glad_lazy_glDeleteShader;
+		glad_lazy_missing("glDeleteShader");
+		return;
+	}
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_load("glDetachShader");
+	if(glad_glDetachShader == NULL) {
+		glad_glDetachShader = glad_lazy_glDetachShader;
+		glad_lazy_missing("glDetachShader");
+		return;
+	}
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_load("glDisableVertexAttribArray");
+	if(glad_glDisableVertexAttribArray == NULL) {
+		glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+		glad_lazy_missing("glDisableVertexAttribArray");
+		return;
+	}
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_load("glEnableVertexAttribArray");
+	if(glad_glEnableVertexAttribArray == NULL) {
+		glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+		glad_lazy_missing("glEnableVertexAttribArray");
+		return;
+	}
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_load("glGetActiveAttrib");
+	if(glad_glGetActiveAttrib == NULL) {
+		glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+		glad_lazy_missing("glGetActiveAttrib");
+		return;
+	}
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_load("glGetActiveUniform");
+	if(glad_glGetActiveUniform == NULL) {
+		glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+		glad_lazy_missing("glGetActiveUniform");
+		return;
+	}
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_load("glGetAttachedShaders");
+	if(glad_glGetAttachedShaders == NULL) {
+		glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+		glad_lazy_missing("glGetAttachedShaders");
+		return;
+	}
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_load("glGetAttribLocation");
+	if(glad_glGetAttribLocation == NULL) {
+		glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+		glad_lazy_missing("glGetAttribLocation");
+		return (GLint)0;
+	}
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_load("glGetProgramiv");
+	if(glad_glGetProgramiv == NULL) {
+		glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+		glad_lazy_missing("glGetProgramiv");
+		return;
+	}
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_load("glGetProgramInfoLog");
+	if(glad_glGetProgramInfoLog == NULL) {
+		glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+		glad_lazy_missing("glGetProgramInfoLog");
+		return;
+	}
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_load("glGetShaderiv");
+	if(glad_glGetShaderiv == NULL) {
+		glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+		glad_lazy_missing("glGetShaderiv");
+		return;
+	}
+	glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_load("glGetShaderInfoLog");
+	if(glad_glGetShaderInfoLog == NULL) {
+		glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+		glad_lazy_missing("glGetShaderInfoLog");
+		return;
+	}
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_load("glGetShaderSource");
+	if(glad_glGetShaderSource == NULL) {
+		glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+		glad_lazy_missing("glGetShaderSource");
+		return;
+	}
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_load("glGetUniformLocation");
+	if(glad_glGetUniformLocation == NULL) {
+		glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+		glad_lazy_missing("glGetUniformLocation");
+		return (GLint)0;
+	}
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_load("glGetUniformfv");
+	if(glad_glGetUniformfv == NULL) {
+		glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+		glad_lazy_missing("glGetUniformfv");
+		return;
+	}
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_load("glGetUniformiv");
+	if(glad_glGetUniformiv == NULL) {
+		glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+		glad_lazy_missing("glGetUniformiv");
+		return;
+	}
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_load("glGetVertexAttribdv");
+	if(glad_glGetVertexAttribdv == NULL) {
+		glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+		glad_lazy_missing("glGetVertexAttribdv");
+		return;
+	}
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_load("glGetVertexAttribfv");
+	if(glad_glGetVertexAttribfv == NULL) {
+		glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+		glad_lazy_missing("glGetVertexAttribfv");
+		return;
+	}
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_load("glGetVertexAttribiv");
+	if(glad_glGetVertexAttribiv == NULL) {
+		glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+		glad_lazy_missing("glGetVertexAttribiv");
+		return;
+	}
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_load("glGetVertexAttribPointerv");
+	if(glad_glGetVertexAttribPointerv == NULL) {
+		glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+		glad_lazy_missing("glGetVertexAttribPointerv");
+		return;
+	}
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_load("glIsProgram");
+	if(glad_glIsProgram == NULL) {
+		glad_glIsProgram = glad_lazy_glIsProgram;
+		glad_lazy_missing("glIsProgram");
+		return (GLboolean)0;
+	}
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)glad_lazy_load("glIsShader");
+	if(glad_glIsShader == NULL) {
+		glad_glIsShader = glad_lazy_glIsShader;
+		glad_lazy_missing("glIsShader");
+		return (GLboolean)0;
+	}
+	return glad_glIsShader(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_load("glLinkProgram");
+	if(glad_glLinkProgram == NULL) {
+		glad_glLinkProgram = glad_lazy_glLinkProgram;
+		glad_lazy_missing("glLinkProgram");
+		return;
+	}
+	glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_load("glShaderSource");
+	if(glad_glShaderSource == NULL) {
+		glad_glShaderSource = glad_lazy_glShaderSource;
+		glad_lazy_missing("glShaderSource");
+		return;
+	}
+	glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_load("glUseProgram");
+	if(glad_glUseProgram == NULL) {
+		glad_glUseProgram = glad_lazy_glUseProgram;
+		glad_lazy_missing("glUseProgram");
+		return;
+	}
+	glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_load("glUniform1f");
+	if(glad_glUniform1f == NULL) {
+		glad_glUniform1f = glad_lazy_glUniform1f;
+		glad_lazy_missing("glUniform1f");
+		return;
+	}
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_load("glUniform2f");
+	if(glad_glUniform2f == NULL) {
+		glad_glUniform2f = glad_lazy_glUniform2f;
+		glad_lazy_missing("glUniform2f");
+		return;
+	}
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_load("glUniform3f");
+	if(glad_glUniform3f == NULL) {
+		glad_glUniform3f = glad_lazy_glUniform3f;
+		glad_lazy_missing("glUniform3f");
+		return;
+	}
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_load("glUniform4f");
+	if(glad_glUniform4f == NULL) {
+		glad_glUniform4f = glad_lazy_glUniform4f;
+		glad_lazy_missing("glUniform4f");
+		return;
+	}
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_load("glUniform1i");
+	if(glad_glUniform1i == NULL) {
+		glad_glUniform1i = glad_lazy_glUniform1i;
+		glad_lazy_missing("glUniform1i");
+		return;
+	}
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_load("glUniform2i");
+	if(glad_glUniform2i == NULL) {
+		glad_glUniform2i = glad_lazy_glUniform2i;
+		glad_lazy_missing("glUniform2i");
+		return;
+	}
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_load("glUniform3i");
+	if(glad_glUniform3i == NULL) {
+		glad_glUniform3i = glad_lazy_glUniform3i;
+		glad_lazy_missing("glUniform3i");
+		return;
+	}
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_load("glUniform4i");
+	if(glad_glUniform4i == NULL) {
+		glad_glUniform4i = glad_lazy_glUniform4i;
+		glad_lazy_missing("glUniform4i");
+		return;
+	}
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_load("glUniform1fv");
+	if(glad_glUniform1fv == NULL) {
+		glad_glUniform1fv = glad_lazy_glUniform1fv;
+		glad_lazy_missing("glUniform1fv");
+		return;
+	}
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_load("glUniform2fv");
+	if(glad_glUniform2fv == NULL) {
+		glad_glUniform2fv = glad_lazy_glUniform2fv;
+		glad_lazy_missing("glUniform2fv");
+		return;
+	}
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_load("glUniform3fv");
+	if(glad_glUniform3fv == NULL) {
+		glad_glUniform3fv = glad_lazy_glUniform3fv;
+		glad_lazy_missing("glUniform3fv");
+		return;
+	}
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_load("glUniform4fv");
+	if(glad_glUniform4fv == NULL) {
+		glad_glUniform4fv = glad_lazy_glUniform4fv;
+		glad_lazy_missing("glUniform4fv");
+		return;
+	}
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_load("glUniform1iv");
+	if(glad_glUniform1iv == NULL) {
+		glad_glUniform1iv = glad_lazy_glUniform1iv;
+		glad_lazy_missing("glUniform1iv");
+		return;
+	}
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_load("glUniform2iv");
+	if(glad_glUniform2iv == NULL) {
+		glad_glUniform2iv = glad_lazy_glUniform2iv;
+		glad_lazy_missing("glUniform2iv");
+		return;
+	}
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_load("glUniform3iv");
+	if(glad_glUniform3iv == NULL) {
+		glad_glUniform3iv = glad_lazy_glUniform3iv;
+		glad_lazy_missing("glUniform3iv");
+		return;
+	}
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_load("glUniform4iv");
+	if(glad_glUniform4iv == NULL) {
+		glad_glUniform4iv = glad_lazy_glUniform4iv;
+		glad_lazy_missing("glUniform4iv");
+		return;
+	}
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_load("glUniformMatrix2fv");
+	if(glad_glUniformMatrix2fv == NULL) {
+		glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+		glad_lazy_missing("glUniformMatrix2fv");
+		return;
+	}
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_load("glUniformMatrix3fv");
+	if(glad_glUniformMatrix3fv == NULL) {
+		glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+		glad_lazy_missing("glUniformMatrix3fv");
+		return;
+	}
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_load("glUniformMatrix4fv");
+	if(glad_glUniformMatrix4fv == NULL) {
+		glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+		glad_lazy_missing("glUniformMatrix4fv");
+		return;
+	}
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_load("glValidateProgram");
+	if(glad_glValidateProgram == NULL) {
+		glad_glValidateProgram = glad_lazy_glValidateProgram;
+		glad_lazy_missing("glValidateProgram");
+		return;
+	}
+	glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_load("glVertexAttrib1d");
+	if(glad_glVertexAttrib1d == NULL) {
+		glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+		glad_lazy_missing("glVertexAttrib1d");
+		return;
+	}
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_load("glVertexAttrib1dv");
+	if(glad_glVertexAttrib1dv == NULL) {
+		glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+		glad_lazy_missing("glVertexAttrib1dv");
+		return;
+	}
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_load("glVertexAttrib1f");
+	if(glad_glVertexAttrib1f == NULL) {
+		glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+		glad_lazy_missing("glVertexAttrib1f");
+		return;
+	}
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_load("glVertexAttrib1fv");
+	if(glad_glVertexAttrib1fv == NULL) {
+		glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+		glad_lazy_missing("glVertexAttrib1fv");
+		return;
+	}
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_load("glVertexAttrib1s");
+	if(glad_glVertexAttrib1s == NULL) {
+		glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+		glad_lazy_missing("glVertexAttrib1s");
+		return;
+	}
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_load("glVertexAttrib1sv");
+	if(glad_glVertexAttrib1sv == NULL) {
+		glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+		glad_lazy_missing("glVertexAttrib1sv");
+		return;
+	}
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_load("glVertexAttrib2d");
+	if(glad_glVertexAttrib2d == NULL) {
+		glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+		glad_lazy_missing("glVertexAttrib2d");
+		return;
+	}
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_load("glVertexAttrib2dv");
+	if(glad_glVertexAttrib2dv == NULL) {
+		glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+		glad_lazy_missing("glVertexAttrib2dv");
+		return;
+	}
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_load("glVertexAttrib2f");
+	if(glad_glVertexAttrib2f == NULL) {
+		glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+		glad_lazy_missing("glVertexAttrib2f");
+		return;
+	}
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_load("glVertexAttrib2fv");
+	if(glad_glVertexAttrib2fv == NULL) {
+		glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+		glad_lazy_missing("glVertexAttrib2fv");
+		return;
+	}
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_load("glVertexAttrib2s");
+	if(glad_glVertexAttrib2s == NULL) {
+		glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+		glad_lazy_missing("glVertexAttrib2s");
+		return;
+	}
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_load("glVertexAttrib2sv");
+	if(glad_glVertexAttrib2sv == NULL) {
+		glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+		glad_lazy_missing("glVertexAttrib2sv");
+		return;
+	}
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_load("glVertexAttrib3d");
+	if(glad_glVertexAttrib3d == NULL) {
+		glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+		glad_lazy_missing("glVertexAttrib3d");
+		return;
+	}
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_load("glVertexAttrib3dv");
+	if(glad_glVertexAttrib3dv == NULL) {
+		glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+		glad_lazy_missing("glVertexAttrib3dv");
+		return;
+	}
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_load("glVertexAttrib3f");
+	if(glad_glVertexAttrib3f == NULL) {
+		glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+		glad_lazy_missing("glVertexAttrib3f");
+		return;
+	}
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_load("glVertexAttrib3fv");
+	if(glad_glVertexAttrib3fv == NULL) {
+		glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+		glad_lazy_missing("glVertexAttrib3fv");
+		return;
+	}
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_load("glVertexAttrib3s");
+	if(glad_glVertexAttrib3s == NULL) {
+		glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+		glad_lazy_missing("glVertexAttrib3s");
+		return;
+	}
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_load("glVertexAttrib3sv");
+	if(glad_glVertexAttrib3sv == NULL) {
+		glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+		glad_lazy_missing("glVertexAttrib3sv");
+		return;
+	}
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_load("glVertexAttrib4Nbv");
+	if(glad_glVertexAttrib4Nbv == NULL) {
+		glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+		glad_lazy_missing("glVertexAttrib4Nbv");
+		return;
+	}
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_load("glVertexAttrib4Niv");
+	if(glad_glVertexAttrib4Niv == NULL) {
+		glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+		glad_lazy_missing("glVertexAttrib4Niv");
+		return;
+	}
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_load("glVertexAttrib4Nsv");
+	if(glad_glVertexAttrib4Nsv == NULL) {
+		glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+		glad_lazy_missing("glVertexAttrib4Nsv");
+		return;
+	}
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_load("glVertexAttrib4Nub");
+	if(glad_glVertexAttrib4Nub == NULL) {
+		glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+		glad_lazy_missing("glVertexAttrib4Nub");
+		return;
+	}
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_load("glVertexAttrib4Nubv");
+	if(glad_glVertexAttrib4Nubv == NULL) {
+		glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+		glad_lazy_missing("glVertexAttrib4Nubv");
+		return;
+	}
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_load("glVertexAttrib4Nuiv");
+	if(glad_glVertexAttrib4Nuiv == NULL) {
+		glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+		glad_lazy_missing("glVertexAttrib4Nuiv");
+		return;
+	}
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_load("glVertexAttrib4Nusv");
+	if(glad_glVertexAttrib4Nusv == NULL) {
+		glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+		glad_lazy_missing("glVertexAttrib4Nusv");
+		return;
+	}
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_load("glVertexAttrib4bv");
+	if(glad_glVertexAttrib4bv == NULL) {
+		glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+		glad_lazy_missing("glVertexAttrib4bv");
+		return;
+	}
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_load("glVertexAttrib4d");
+	if(glad_glVertexAttrib4d == NULL) {
+		glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+		glad_lazy_missing("glVertexAttrib4d");
+		return;
+	}
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_load("glVertexAttrib4dv");
+	if(glad_glVertexAttrib4dv == NULL) {
+		glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+		glad_lazy_missing("glVertexAttrib4dv");
+		return;
+	}
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_load("glVertexAttrib4f");
+	if(glad_glVertexAttrib4f == NULL) {
+		glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+		glad_lazy_missing("glVertexAttrib4f");
+		return;
+	}
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_load("glVertexAttrib4fv");
+	if(glad_glVertexAttrib4fv == NULL) {
+		glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+		glad_lazy_missing("glVertexAttrib4fv");
+		return;
+	}
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_load("glVertexAttrib4iv");
+	if(glad_glVertexAttrib4iv == NULL) {
+		glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+		glad_lazy_missing("glVertexAttrib4iv");
+		return;
+	}
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_load("glVertexAttrib4s");
+	if(glad_glVertexAttrib4s == NULL) {
+		glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+		glad_lazy_missing("glVertexAttrib4s");
+		return;
+	}
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_load("glVertexAttrib4sv");
+	if(glad_glVertexAttrib4sv == NULL) {
+		glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+		glad_lazy_missing("glVertexAttrib4sv");
+		return;
+	}
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_load("glVertexAttrib4ubv");
+	if(glad_glVertexAttrib4ubv == NULL) {
+		glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+		glad_lazy_missing("glVertexAttrib4ubv");
+		return;
+	}
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_load("glVertexAttrib4uiv");
+	if(glad_glVertexAttrib4uiv == NULL) {
+		glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+		glad_lazy_missing("glVertexAttrib4uiv");
+		return;
+	}
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_load("glVertexAttrib4usv");
+	if(glad_glVertexAttrib4usv == NULL) {
+		glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+		glad_lazy_missing("glVertexAttrib4usv");
+		return;
+	}
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_load("glVertexAttribPointer");
+	if(glad_glVertexAttribPointer == NULL) {
+		glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+		glad_lazy_missing("glVertexAttribPointer");
+		return;
+	}
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_load("glUniformMatrix2x3fv");
+	if(glad_glUniformMatrix2x3fv == NULL) {
+		glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+		glad_lazy_missing("glUniformMatrix2x3fv");
+		return;
+	}
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_load("glUniformMatrix3x2fv");
+	if(glad_glUniformMatrix3x2fv == NULL) {
+		glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+		glad_lazy_missing("glUniformMatrix3x2fv");
+		return;
+	}
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_load("glUniformMatrix2x4fv");
+	if(glad_glUniformMatrix2x4fv == NULL) {
+		glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+		glad_lazy_missing("glUniformMatrix2x4fv");
+		return;
+	}
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_load("glUniformMatrix4x2fv");
+	if(glad_glUniformMatrix4x2fv == NULL) {
+		glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+		glad_lazy_missing("glUniformMatrix4x2fv");
+		return;
+	}
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_load("glUniformMatrix3x4fv");
+	if(glad_glUniformMatrix3x4fv == NULL) {
+		glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+		glad_lazy_missing("glUniformMatrix3x4fv");
+		return;
+	}
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_load("glUniformMatrix4x3fv");
+	if(glad_glUniformMatrix4x3fv == NULL) {
+		glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+		glad_lazy_missing("glUniformMatrix4x3fv");
+		return;
+	}
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_load("glColorMaski");
+	if(glad_glColorMaski == NULL) {
+		glad_glColorMaski = glad_lazy_glColorMaski;
+		glad_lazy_missing("glColorMaski");
+		return;
+	}
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_load("glGetBooleani_v");
+	if(glad_glGetBooleani_v == NULL) {
+		glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+		glad_lazy_missing("glGetBooleani_v");
+		return;
+	}
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_load("glGetIntegeri_v");
+	if(glad_glGetIntegeri_v == NULL) {
+		glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+		glad_lazy_missing("glGetIntegeri_v");
+		return;
+	}
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)glad_lazy_load("glEnablei");
+	if(glad_glEnablei == NULL) {
+		glad_glEnablei = glad_lazy_glEnablei;
+		glad_lazy_missing("glEnablei");
+		return;
+	}
+	glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_load("glDisablei");
+	if(glad_glDisablei == NULL) {
+		glad_glDisablei = glad_lazy_glDisablei;
+		glad_lazy_missing("glDisablei");
+		return;
+	}
+	glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_load("glIsEnabledi");
+	if(glad_glIsEnabledi == NULL) {
+		glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+		glad_lazy_missing("glIsEnabledi");
+		return (GLboolean)0;
+	}
+	return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_load("glBeginTransformFeedback");
+	if(glad_glBeginTransformFeedback == NULL) {
+		glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+		glad_lazy_missing("glBeginTransformFeedback");
+		return;
+	}
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_load("glEndTransformFeedback");
+	if(glad_glEndTransformFeedback == NULL) {
+		glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+		glad_lazy_missing("glEndTransformFeedback");
+		return;
+	}
+	glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_load("glBindBufferRange");
+	if(glad_glBindBufferRange == NULL) {
+		glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+		glad_lazy_missing("glBindBufferRange");
+		return;
+	}
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_load("glBindBufferBase");
+	if(glad_glBindBufferBase == NULL) {
+		glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+		glad_lazy_missing("glBindBufferBase");
+		return;
+	}
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_load("glTransformFeedbackVaryings");
+	if(glad_glTransformFeedbackVaryings == NULL) {
+		glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+		glad_lazy_missing("glTransformFeedbackVaryings");
+		return;
+	}
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_load("glGetTransformFeedbackVarying");
+	if(glad_glGetTransformFeedbackVarying == NULL) {
+		glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+		glad_lazy_missing("glGetTransformFeedbackVarying");
+		return;
+	}
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_load("glClampColor");
+	if(glad_glClampColor == NULL) {
+		glad_glClampColor = glad_lazy_glClampColor;
+		glad_lazy_missing("glClampColor");
+		return;
+	}
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_load("glBeginConditionalRender");
+	if(glad_glBeginConditionalRender == NULL) {
+		glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+		glad_lazy_missing("glBeginConditionalRender");
+		return;
+	}
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_load("glEndConditionalRender");
+	if(glad_glEndConditionalRender == NULL) {
+		glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+		glad_lazy_missing("glEndConditionalRender");
+		return;
+	}
+	glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_load("glVertexAttribIPointer");
+	if(glad_glVertexAttribIPointer == NULL) {
+		glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+		glad_lazy_missing("glVertexAttribIPointer");
+		return;
+	}
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_load("glGetVertexAttribIiv");
+	if(glad_glGetVertexAttribIiv == NULL) {
+		glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+		glad_lazy_missing("glGetVertexAttribIiv");
+		return;
+	}
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_load("glGetVertexAttribIuiv");
+	if(glad_glGetVertexAttribIuiv == NULL) {
+		glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+		glad_lazy_missing("glGetVertexAttribIuiv");
+		return;
+	}
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_load("glVertexAttribI1i");
+	if(glad_glVertexAttribI1i == NULL) {
+		glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+		glad_lazy_missing("glVertexAttribI1i");
+		return;
+	}
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_load("glVertexAttribI2i");
+	if(glad_glVertexAttribI2i == NULL) {
+		glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+		glad_lazy_missing("glVertexAttribI2i");
+		return;
+	}
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_load("glVertexAttribI3i");
+	if(glad_glVertexAttribI3i == NULL) {
+		glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+		glad_lazy_missing("glVertexAttribI3i");
+		return;
+	}
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_load("glVertexAttribI4i");
+	if(glad_glVertexAttribI4i == NULL) {
+		glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+		glad_lazy_missing("glVertexAttribI4i");
+		return;
+	}
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_load("glVertexAttribI1ui");
+	if(glad_glVertexAttribI1ui == NULL) {
+		glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+		glad_lazy_missing("glVertexAttribI1ui");
+		return;
+	}
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_load("glVertexAttribI2ui");
+	if(glad_glVertexAttribI2ui == NULL) {
+		glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+		glad_lazy_missing("glVertexAttribI2ui");
+		return;
+	}
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_load("glVertexAttribI3ui");
+	if(glad_glVertexAttribI3ui == NULL) {
+		glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+		glad_lazy_missing("glVertexAttribI3ui");
+		return;
+	}
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_load("glVertexAttribI4ui");
+	if(glad_glVertexAttribI4ui == NULL) {
+		glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+		glad_lazy_missing("glVertexAttribI4ui");
+		return;
+	}
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_load("glVertexAttribI1iv");
+	if(glad_glVertexAttribI1iv == NULL) {
+		glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+		glad_lazy_missing("glVertexAttribI1iv");
+		return;
+	}
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_load("glVertexAttribI2iv");
+	if(glad_glVertexAttribI2iv == NULL) {
+		glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+		glad_lazy_missing("glVertexAttribI2iv");
+		return;
+	}
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_load("glVertexAttribI3iv");
+	if(glad_glVertexAttribI3iv == NULL) {
+		glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+		glad_lazy_missing("glVertexAttribI3iv");
+		return;
+	}
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_load("glVertexAttribI4iv");
+	if(glad_glVertexAttribI4iv == NULL) {
+		glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+		glad_lazy_missing("glVertexAttribI4iv");
+		return;
+	}
+	glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_load("glVertexAttribI1uiv");
+	if(glad_glVertexAttribI1uiv == NULL) {
+		glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+		glad_lazy_missing("glVertexAttribI1uiv");
+		return;
+	}
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_load("glVertexAttribI2uiv");
+	if(glad_glVertexAttribI2uiv == NULL) {
+		glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+		glad_lazy_missing("glVertexAttribI2uiv");
+		return;
+	}
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_load("glVertexAttribI3uiv");
+	if(glad_glVertexAttribI3uiv == NULL) {
+		glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+		glad_lazy_missing("glVertexAttribI3uiv");
+		return;
+	}
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_load("glVertexAttribI4uiv");
+	if(glad_glVertexAttribI4uiv == NULL) {
+		glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+		glad_lazy_missing("glVertexAttribI4uiv");
+		return;
+	}
+	glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_load("glVertexAttribI4bv");
+	if(glad_glVertexAttribI4bv == NULL) {
+		glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+		glad_lazy_missing("glVertexAttribI4bv");
+		return;
+	}
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_load("glVertexAttribI4sv");
+	if(glad_glVertexAttribI4sv == NULL) {
+		glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+		glad_lazy_missing("glVertexAttribI4sv");
+		return;
+	}
+	glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_load("glVertexAttribI4ubv");
+	if(glad_glVertexAttribI4ubv == NULL) {
+		glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+		glad_lazy_missing("glVertexAttribI4ubv");
+		return;
+	}
+	glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_load("glVertexAttribI4usv");
+	if(glad_glVertexAttribI4usv == NULL) {
+		glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+		glad_lazy_missing("glVertexAttribI4usv");
+		return;
+	}
+	glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_load("glGetUniformuiv");
+	if(glad_glGetUniformuiv == NULL) {
+		glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+		glad_lazy_missing("glGetUniformuiv");
+		return;
+	}
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_load("glBindFragDataLocation");
+	if(glad_glBindFragDataLocation == NULL) {
+		glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+		glad_lazy_missing("glBindFragDataLocation");
+		return;
+	}
+	glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_load("glGetFragDataLocation");
+	if(glad_glGetFragDataLocation == NULL) {
+		glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+		glad_lazy_missing("glGetFragDataLocation");
+		return (GLint)0;
+	}
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_load("glUniform1ui");
+	if(glad_glUniform1ui == NULL) {
+		glad_glUniform1ui = glad_lazy_glUniform1ui;
+		glad_lazy_missing("glUniform1ui");
+		return;
+	}
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_load("glUniform2ui");
+	if(glad_glUniform2ui == NULL) {
+		glad_glUniform2ui = glad_lazy_glUniform2ui;
+		glad_lazy_missing("glUniform2ui");
+		return;
+	}
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_load("glUniform3ui");
+	if(glad_glUniform3ui == NULL) {
+		glad_glUniform3ui = glad_lazy_glUniform3ui;
+		glad_lazy_missing("glUniform3ui");
+		return;
+	}
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_load("glUniform4ui");
+	if(glad_glUniform4ui == NULL) {
+		glad_glUniform4ui = glad_lazy_glUniform4ui;
+		glad_lazy_missing("glUniform4ui");
+		return;
+	}
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_load("glUniform1uiv");
+	if(glad_glUniform1uiv == NULL) {
+		glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+		glad_lazy_missing("glUniform1uiv");
+		return;
+	}
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_load("glUniform2uiv");
+	if(glad_glUniform2uiv == NULL) {
+		glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+		glad_lazy_missing("glUniform2uiv");
+		return;
+	}
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_load("glUniform3uiv");
+	if(glad_glUniform3uiv == NULL) {
+		glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+		glad_lazy_missing("glUniform3uiv");
+		return;
+	}
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_load("glUniform4uiv");
+	if(glad_glUniform4uiv == NULL) {
+		glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+		glad_lazy_missing("glUniform4uiv");
+		return;
+	}
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_load("glTexParameterIiv");
+	if(glad_glTexParameterIiv == NULL) {
+		glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+		glad_lazy_missing("glTexParameterIiv");
+		return;
+	}
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_load("glTexParameterIuiv");
+	if(glad_glTexParameterIuiv == NULL) {
+		glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+		glad_lazy_missing("glTexParameterIuiv");
+		return;
+	}
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_load("glGetTexParameterIiv");
+	if(glad_glGetTexParameterIiv == NULL) {
+		glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+		glad_lazy_missing("glGetTexParameterIiv");
+		return;
+	}
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_load("glGetTexParameterIuiv");
+	if(glad_glGetTexParameterIuiv == NULL) {
+		glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+		glad_lazy_missing("glGetTexParameterIuiv");
+		return;
+	}
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_load("glClearBufferiv");
+	if(glad_glClearBufferiv == NULL) {
+		glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+		glad_lazy_missing("glClearBufferiv");
+		return;
+	}
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_load("glClearBufferuiv");
+	if(glad_glClearBufferuiv == NULL) {
+		glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+		glad_lazy_missing("glClearBufferuiv");
+		return;
+	}
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_load("glClearBufferfv");
+	if(glad_glClearBufferfv == NULL) {
+		glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+		glad_lazy_missing("glClearBufferfv");
+		return;
+	}
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_load("glClearBufferfi");
+	if(glad_glClearBufferfi == NULL) {
+		glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+		glad_lazy_missing("glClearBufferfi");
+		return;
+	}
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte *APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_load("glGetStringi");
+	if(glad_glGetStringi == NULL) {
+		glad_glGetStringi = glad_lazy_glGetStringi;
+		glad_lazy_missing("glGetStringi");
+		return (const GLubyte *)0;
+	}
+	return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_load("glIsRenderbuffer");
+	if(glad_glIsRenderbuffer == NULL) {
+		glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+		glad_lazy_missing("glIsRenderbuffer");
+		return (GLboolean)0;
+	}
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_load("glBindRenderbuffer");
+	if(glad_glBindRenderbuffer == NULL) {
+		glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+		glad_lazy_missing("glBindRenderbuffer");
+		return;
+	}
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_load("glDeleteRenderbuffers");
+	if(glad_glDeleteRenderbuffers == NULL) {
+		glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+		glad_lazy_missing("glDeleteRenderbuffers");
+		return;
+	}
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_load("glGenRenderbuffers");
+	if(glad_glGenRenderbuffers == NULL) {
+		glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+		glad_lazy_missing("glGenRenderbuffers");
+		return;
+	}
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_load("glRenderbufferStorage");
+	if(glad_glRenderbufferStorage == NULL) {
+		glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+		glad_lazy_missing("glRenderbufferStorage");
+		return;
+	}
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_load("glGetRenderbufferParameteriv");
+	if(glad_glGetRenderbufferParameteriv == NULL) {
+		glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+		glad_lazy_missing("glGetRenderbufferParameteriv");
+		return;
+	}
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_load("glIsFramebuffer");
+	if(glad_glIsFramebuffer == NULL) {
+		glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+		glad_lazy_missing("glIsFramebuffer");
+		return (GLboolean)0;
+	}
+	return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_load("glBindFramebuffer");
+	if(glad_glBindFramebuffer == NULL) {
+		glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+		glad_lazy_missing("glBindFramebuffer");
+		return;
+	}
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_load("glDeleteFramebuffers");
+	if(glad_glDeleteFramebuffers == NULL) {
+		glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+		glad_lazy_missing("glDeleteFramebuffers");
+		return;
+	}
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_load("glGenFramebuffers");
+	if(glad_glGenFramebuffers == NULL) {
+		glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+		glad_lazy_missing("glGenFramebuffers");
+		return;
+	}
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_load("glCheckFramebufferStatus");
+	if(glad_glCheckFramebufferStatus == NULL) {
+		glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+		glad_lazy_missing("glCheckFramebufferStatus");
+		return (GLenum)0;
+	}
+	return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_load("glFramebufferTexture1D");
+	if(glad_glFramebufferTexture1D == NULL) {
+		glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+		glad_lazy_missing("glFramebufferTexture1D");
+		return;
+	}
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_load("glFramebufferTexture2D");
+	if(glad_glFramebufferTexture2D == NULL) {
+		glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+		glad_lazy_missing("glFramebufferTexture2D");
+		return;
+	}
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_load("glFramebufferTexture3D");
+	if(glad_glFramebufferTexture3D == NULL) {
+		glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+		glad_lazy_missing("glFramebufferTexture3D");
+		return;
+	}
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_load("glFramebufferRenderbuffer");
+	if(glad_glFramebufferRenderbuffer == NULL) {
+		glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+		glad_lazy_missing("glFramebufferRenderbuffer");
+		return;
+	}
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_load("glGetFramebufferAttachmentParameteriv");
+	if(glad_glGetFramebufferAttachmentParameteriv == NULL) {
+		glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+		glad_lazy_missing("glGetFramebufferAttachmentParameteriv");
+		return;
+	}
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_load("glGenerateMipmap");
+	if(glad_glGenerateMipmap == NULL) {
+		glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+		glad_lazy_missing("glGenerateMipmap");
+		return;
+	}
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_load("glBlitFramebuffer");
+	if(glad_glBlitFramebuffer == NULL) {
+		glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+		glad_lazy_missing("glBlitFramebuffer");
+		return;
+	}
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_load("glRenderbufferStorageMultisample");
+	if(glad_glRenderbufferStorageMultisample == NULL) {
+		glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+		glad_lazy_missing("glRenderbufferStorageMultisample");
+		return;
+	}
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_load("glFramebufferTextureLayer");
+	if(glad_glFramebufferTextureLayer == NULL) {
+		glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+		glad_lazy_missing("glFramebufferTextureLayer");
+		return;
+	}
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void *APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_load("glMapBufferRange");
+	if(glad_glMapBufferRange == NULL) {
+		glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+		glad_lazy_missing("glMapBufferRange");
+		return (void *)0;
+	}
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_load("glFlushMappedBufferRange");
+	if(glad_glFlushMappedBufferRange == NULL) {
+		glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+		glad_lazy_missing("glFlushMappedBufferRange");
+		return;
+	}
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_load("glBindVertexArray");
+	if(glad_glBindVertexArray == NULL) {
+		glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+		glad_lazy_missing("glBindVertexArray");
+		return;
+	}
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_load("glDeleteVertexArrays");
+	if(glad_glDeleteVertexArrays == NULL) {
+		glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+		glad_lazy_missing("glDeleteVertexArrays");
+		return;
+	}
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_load("glGenVertexArrays");
+	if(glad_glGenVertexArrays == NULL) {
+		glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+		glad_lazy_missing("glGenVertexArrays");
+		return;
+	}
+	glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_load("glIsVertexArray");
+	if(glad_glIsVertexArray == NULL) {
+		glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+		glad_lazy_missing("glIsVertexArray");
+		return (GLboolean)0;
+	}
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_load("glDrawArraysInstanced");
+	if(glad_glDrawArraysInstanced == NULL) {
+		glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+		glad_lazy_missing("glDrawArraysInstanced");
+		return;
+	}
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_load("glDrawElementsInstanced");
+	if(glad_glDrawElementsInstanced == NULL) {
+		glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+		glad_lazy_missing("glDrawElementsInstanced");
+		return;
+	}
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_load("glTexBuffer");
+	if(glad_glTexBuffer == NULL) {
+		glad_glTexBuffer = glad_lazy_glTexBuffer;
+		glad_lazy_missing("glTexBuffer");
+		return;
+	}
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_load("glPrimitiveRestartIndex");
+	if(glad_glPrimitiveRestartIndex == NULL) {
+		glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+		glad_lazy_missing("glPrimitiveRestartIndex");
+		return;
+	}
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_load("glCopyBufferSubData");
+	if(glad_glCopyBufferSubData == NULL) {
+		glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+		glad_lazy_missing("glCopyBufferSubData");
+		return;
+	}
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_load("glGetUniformIndices");
+	if(glad_glGetUniformIndices == NULL) {
+		glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+		glad_lazy_missing("glGetUniformIndices");
+		return;
+	}
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_load("glGetActiveUniformsiv");
+	if(glad_glGetActiveUniformsiv == NULL) {
+		glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+		glad_lazy_missing("glGetActiveUniformsiv");
+		return;
+	}
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_load("glGetActiveUniformName");
+	if(glad_glGetActiveUniformName == NULL) {
+		glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+		glad_lazy_missing("glGetActiveUniformName");
+		return;
+	}
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_load("glGetUniformBlockIndex");
+	if(glad_glGetUniformBlockIndex == NULL) {
+		glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+		glad_lazy_missing("glGetUniformBlockIndex");
+		return (GLuint)0;
+	}
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_load("glGetActiveUniformBlockiv");
+	if(glad_glGetActiveUniformBlockiv == NULL) {
+		glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+		glad_lazy_missing("glGetActiveUniformBlockiv");
+		return;
+	}
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_load("glGetActiveUniformBlockName");
+	if(glad_glGetActiveUniformBlockName == NULL) {
+		glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+		glad_lazy_missing("glGetActiveUniformBlockName");
+		return;
+	}
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_load("glUniformBlockBinding");
+	if(glad_glUniformBlockBinding == NULL) {
+		glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+		glad_lazy_missing("glUniformBlockBinding");
+		return;
+	}
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_load("glDrawElementsBaseVertex");
+	if(glad_glDrawElementsBaseVertex == NULL) {
+		glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+		glad_lazy_missing("glDrawElementsBaseVertex");
+		return;
+	}
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_load("glDrawRangeElementsBaseVertex");
+	if(glad_glDrawRangeElementsBaseVertex == NULL) {
+		glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+		glad_lazy_missing("glDrawRangeElementsBaseVertex");
+		return;
+	}
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_load("glDrawElementsInstancedBaseVertex");
+	if(glad_glDrawElementsInstancedBaseVertex == NULL) {
+		glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+		glad_lazy_missing("glDrawElementsInstancedBaseVertex");
+		return;
+	}
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_load("glMultiDrawElementsBaseVertex");
+	if(glad_glMultiDrawElementsBaseVertex == NULL) {
+		glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+		glad_lazy_missing("glMultiDrawElementsBaseVertex");
+		return;
+	}
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_load("glProvokingVertex");
+	if(glad_glProvokingVertex == NULL) {
+		glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+		glad_lazy_missing("glProvokingVertex");
+		return;
+	}
+	glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_load("glFenceSync");
+	if(glad_glFenceSync == NULL) {
+		glad_glFenceSync = glad_lazy_glFenceSync;
+		glad_lazy_missing("glFenceSync");
+		return (GLsync)0;
+	}
+	return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)glad_lazy_load("glIsSync");
+	if(glad_glIsSync == NULL) {
+		glad_glIsSync = glad_lazy_glIsSync;
+		glad_lazy_missing("glIsSync");
+		return (GLboolean)0;
+	}
+	return glad_glIsSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_load("glDeleteSync");
+	if(glad_glDeleteSync == NULL) {
+		glad_glDeleteSync = glad_lazy_glDeleteSync;
+		glad_lazy_missing("glDeleteSync");
+		return;
+	}
+	glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_load("glClientWaitSync");
+	if(glad_glClientWaitSync == NULL) {
+		glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+		glad_lazy_missing("glClientWaitSync");
+		return (GLenum)0;
+	}
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_load("glWaitSync");
+	if(glad_glWaitSync == NULL) {
+		glad_glWaitSync = glad_lazy_glWaitSync;
+		glad_lazy_missing("glWaitSync");
+		return;
+	}
+	glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_load("glGetInteger64v");
+	if(glad_glGetInteger64v == NULL) {
+		glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+		glad_lazy_missing("glGetInteger64v");
+		return;
+	}
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_load("glGetSynciv");
+	if(glad_glGetSynciv == NULL) {
+		glad_glGetSynciv = glad_lazy_glGetSynciv;
+		glad_lazy_missing("glGetSynciv");
+		return;
+	}
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_load("glGetInteger64i_v");
+	if(glad_glGetInteger64i_v == NULL) {
+		glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+		glad_lazy_missing("glGetInteger64i_v");
+		return;
+	}
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_load("glGetBufferParameteri64v");
+	if(glad_glGetBufferParameteri64v == NULL) {
+		glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+		glad_lazy_missing("glGetBufferParameteri64v");
+		return;
+	}
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_load("glFramebufferTexture");
+	if(glad_glFramebufferTexture == NULL) {
+		glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+		glad_lazy_missing("glFramebufferTexture");
+		return;
+	}
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_load("glTexImage2DMultisample");
+	if(glad_glTexImage2DMultisample == NULL) {
+		glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+		glad_lazy_missing("glTexImage2DMultisample");
+		return;
+	}
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_load("glTexImage3DMultisample");
+	if(glad_glTexImage3DMultisample == NULL) {
+		glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+		glad_lazy_missing("glTexImage3DMultisample");
+		return;
+	}
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_load("glGetMultisamplefv");
+	if(glad_glGetMultisamplefv == NULL) {
+		glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+		glad_lazy_missing("glGetMultisamplefv");
+		return;
+	}
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_load("glSampleMaski");
+	if(glad_glSampleMaski == NULL) {
+		glad_glSampleMaski = glad_lazy_glSampleMaski;
+		glad_lazy_missing("glSampleMaski");
+		return;
+	}
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_load("glBindFragDataLocationIndexed");
+	if(glad_glBindFragDataLocationIndexed == NULL) {
+		glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+		glad_lazy_missing("glBindFragDataLocationIndexed");
+		return;
+	}
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_load("glGetFragDataIndex");
+	if(glad_glGetFragDataIndex == NULL) {
+		glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+		glad_lazy_missing("glGetFragDataIndex");
+		return (GLint)0;
+	}
+	return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_load("glGenSamplers");
+	if(glad_glGenSamplers == NULL) {
+		glad_glGenSamplers = glad_lazy_glGenSamplers;
+		glad_lazy_missing("glGenSamplers");
+		return;
+	}
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_load("glDeleteSamplers");
+	if(glad_glDeleteSamplers == NULL) {
+		glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+		glad_lazy_missing("glDeleteSamplers");
+		return;
+	}
+	glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_load("glIsSampler");
+	if(glad_glIsSampler == NULL) {
+		glad_glIsSampler = glad_lazy_glIsSampler;
+		glad_lazy_missing("glIsSampler");
+		return (GLboolean)0;
+	}
+	return glad_glIsSampler(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_load("glBindSampler");
+	if(glad_glBindSampler == NULL) {
+		glad_glBindSampler = glad_lazy_glBindSampler;
+		glad_lazy_missing("glBindSampler");
+		return;
+	}
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_load("glSamplerParameteri");
+	if(glad_glSamplerParameteri == NULL) {
+		glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+		glad_lazy_missing("glSamplerParameteri");
+		return;
+	}
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_load("glSamplerParameteriv");
+	if(glad_glSamplerParameteriv == NULL) {
+		glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+		glad_lazy_missing("glSamplerParameteriv");
+		return;
+	}
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_load("glSamplerParameterf");
+	if(glad_glSamplerParameterf == NULL) {
+		glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+		glad_lazy_missing("glSamplerParameterf");
+		return;
+	}
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_load("glSamplerParameterfv");
+	if(glad_glSamplerParameterfv == NULL) {
+		glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+		glad_lazy_missing("glSamplerParameterfv");
+		return;
+	}
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_load("glSamplerParameterIiv");
+	if(glad_glSamplerParameterIiv == NULL) {
+		glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+		glad_lazy_missing("glSamplerParameterIiv");
+		return;
+	}
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_load("glSamplerParameterIuiv");
+	if(glad_glSamplerParameterIuiv == NULL) {
+		glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+		glad_lazy_missing("glSamplerParameterIuiv");
+		return;
+	}
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_load("glGetSamplerParameteriv");
+	if(glad_glGetSamplerParameteriv == NULL) {
+		glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+		glad_lazy_missing("glGetSamplerParameteriv");
+		return;
+	}
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_load("glGetSamplerParameterIiv");
+	if(glad_glGetSamplerParameterIiv == NULL) {
+		glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+		glad_lazy_missing("glGetSamplerParameterIiv");
+		return;
+	}
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_load("glGetSamplerParameterfv");
+	if(glad_glGetSamplerParameterfv == NULL) {
+		glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+		glad_lazy_missing("glGetSamplerParameterfv");
+		return;
+	}
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_load("glGetSamplerParameterIuiv");
+	if(glad_glGetSamplerParameterIuiv == NULL) {
+		glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+		glad_lazy_missing("glGetSamplerParameterIuiv");
+		return;
+	}
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_load("glQueryCounter");
+	if(glad_glQueryCounter == NULL) {
+		glad_glQueryCounter = glad_lazy_glQueryCounter;
+		glad_lazy_missing("glQueryCounter");
+		return;
+	}
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_load("glGetQueryObjecti64v");
+	if(glad_glGetQueryObjecti64v == NULL) {
+		glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+		glad_lazy_missing("glGetQueryObjecti64v");
+		return;
+	}
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_load("glGetQueryObjectui64v");
+	if(glad_glGetQueryObjectui64v == NULL) {
+		glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+		glad_lazy_missing("glGetQueryObjectui64v");
+		return;
+	}
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_load("glVertexAttribDivisor");
+	if(glad_glVertexAttribDivisor == NULL) {
+		glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+		glad_lazy_missing("glVertexAttribDivisor");
+		return;
+	}
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_load("glVertexAttribP1ui");
+	if(glad_glVertexAttribP1ui == NULL) {
+		glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+		glad_lazy_missing("glVertexAttribP1ui");
+		return;
+	}
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_load("glVertexAttribP1uiv");
+	if(glad_glVertexAttribP1uiv == NULL) {
+		glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+		glad_lazy_missing("glVertexAttribP1uiv");
+		return;
+	}
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_load("glVertexAttribP2ui");
+	if(glad_glVertexAttribP2ui == NULL) {
+		glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+		glad_lazy_missing("glVertexAttribP2ui");
+		return;
+	}
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_load("glVertexAttribP2uiv");
+	if(glad_glVertexAttribP2uiv == NULL) {
+		glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+		glad_lazy_missing("glVertexAttribP2uiv");
+		return;
+	}
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_load("glVertexAttribP3ui");
+	if(glad_glVertexAttribP3ui == NULL) {
+		glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+		glad_lazy_missing("glVertexAttribP3ui");
+		return;
+	}
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_load("glVertexAttribP3uiv");
+	if(glad_glVertexAttribP3uiv == NULL) {
+		glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+		glad_lazy_missing("glVertexAttribP3uiv");
+		return;
+	}
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_load("glVertexAttribP4ui");
+	if(glad_glVertexAttribP4ui == NULL) {
+		glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+		glad_lazy_missing("glVertexAttribP4ui");
+		return;
+	}
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_load("glVertexAttribP4uiv");
+	if(glad_glVertexAttribP4uiv == NULL) {
+		glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+		glad_lazy_missing("glVertexAttribP4uiv");
+		return;
+	}
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_load("glVertexP2ui");
+	if(glad_glVertexP2ui == NULL) {
+		glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+		glad_lazy_missing("glVertexP2ui");
+		return;
+	}
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_load("glVertexP2uiv");
+	if(glad_glVertexP2uiv == NULL) {
+		glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+		glad_lazy_missing("glVertexP2uiv");
+		return;
+	}
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_load("glVertexP3ui");
+	if(glad_glVertexP3ui == NULL) {
+		glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+		glad_lazy_missing("glVertexP3ui");
+		return;
+	}
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_load("glVertexP3uiv");
+	if(glad_glVertexP3uiv == NULL) {
+		glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+		glad_lazy_missing("glVertexP3uiv");
+		return;
+	}
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_load("glVertexP4ui");
+	if(glad_glVertexP4ui == NULL) {
+		glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+		glad_lazy_missing("glVertexP4ui");
+		return;
+	}
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_load("glVertexP4uiv");
+	if(glad_glVertexP4uiv == NULL) {
+		glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+		glad_lazy_missing("glVertexP4uiv");
+		return;
+	}
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_load("glTexCoordP1ui");
+	if(glad_glTexCoordP1ui == NULL) {
+		glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+		glad_lazy_missing("glTexCoordP1ui");
+		return;
+	}
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_load("glTexCoordP1uiv");
+	if(glad_glTexCoordP1uiv == NULL) {
+		glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+		glad_lazy_missing("glTexCoordP1uiv");
+		return;
+	}
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_load("glTexCoordP2ui");
+	if(glad_glTexCoordP2ui == NULL) {
+		glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+		glad_lazy_missing("glTexCoordP2ui");
+		return;
+	}
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_load("glTexCoordP2uiv");
+	if(glad_glTexCoordP2uiv == NULL) {
+		glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+		glad_lazy_missing("glTexCoordP2uiv");
+		return;
+	}
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_load("glTexCoordP3ui");
+	if(glad_glTexCoordP3ui == NULL) {
+		glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+		glad_lazy_missing("glTexCoordP3ui");
+		return;
+	}
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_load("glTexCoordP3uiv");
+	if(glad_glTexCoordP3uiv == NULL) {
+		glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+		glad_lazy_missing("glTexCoordP3uiv");
+		return;
+	}
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_load("glTexCoordP4ui");
+	if(glad_glTexCoordP4ui == NULL) {
+		glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+		glad_lazy_missing("glTexCoordP4ui");
+		return;
+	}
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_load("glTexCoordP4uiv");
+	if(glad_glTexCoordP4uiv == NULL) {
+		glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+		glad_lazy_missing("glTexCoordP4uiv");
+		return;
+	}
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_load("glMultiTexCoordP1ui");
+	if(glad_glMultiTexCoordP1ui == NULL) {
+		glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+		glad_lazy_missing("glMultiTexCoordP1ui");
+		return;
+	}
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_load("glMultiTexCoordP1uiv");
+	if(glad_glMultiTexCoordP1uiv == NULL) {
+		glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+		glad_lazy_missing("glMultiTexCoordP1uiv");
+		return;
+	}
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_load("glMultiTexCoordP2ui");
+	if(glad_glMultiTexCoordP2ui == NULL) {
+		glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+		glad_lazy_missing("glMultiTexCoordP2ui");
+		return;
+	}
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_load("glMultiTexCoordP2uiv");
+	if(glad_glMultiTexCoordP2uiv == NULL) {
+		glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+		glad_lazy_missing("glMultiTexCoordP2uiv");
+		return;
+	}
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_load("glMultiTexCoordP3ui");
+	if(glad_glMultiTexCoordP3ui == NULL) {
+		glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+		glad_lazy_missing("glMultiTexCoordP3ui");
+		return;
+	}
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_load("glMultiTexCoordP3uiv");
+	if(glad_glMultiTexCoordP3uiv == NULL) {
+		glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+		glad_lazy_missing("glMultiTexCoordP3uiv");
+		return;
+	}
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_load("glMultiTexCoordP4ui");
+	if(glad_glMultiTexCoordP4ui == NULL) {
+		glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+		glad_lazy_missing("glMultiTexCoordP4ui");
+		return;
+	}
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_load("glMultiTexCoordP4uiv");
+	if(glad_glMultiTexCoordP4uiv == NULL) {
+		glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+		glad_lazy_missing("glMultiTexCoordP4uiv");
+		return;
+	}
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_load("glNormalP3ui");
+	if(glad_glNormalP3ui == NULL) {
+		glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+		glad_lazy_missing("glNormalP3ui");
+		return;
+	}
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_load("glNormalP3uiv");
+	if(glad_glNormalP3uiv == NULL) {
+		glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+		glad_lazy_missing("glNormalP3uiv");
+		return;
+	}
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_load("glColorP3ui");
+	if(glad_glColorP3ui == NULL) {
+		glad_glColorP3ui = glad_lazy_glColorP3ui;
+		glad_lazy_missing("glColorP3ui");
+		return;
+	}
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_load("glColorP3uiv");
+	if(glad_glColorP3uiv == NULL) {
+		glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+		glad_lazy_missing("glColorP3uiv");
+		return;
+	}
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_load("glColorP4ui");
+	if(glad_glColorP4ui == NULL) {
+		glad_glColorP4ui = glad_lazy_glColorP4ui;
+		glad_lazy_missing("glColorP4ui");
+		return;
+	}
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_load("glColorP4uiv");
+	if(glad_glColorP4uiv == NULL) {
+		glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+		glad_lazy_missing("glColorP4uiv");
+		return;
+	}
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_load("glSecondaryColorP3ui");
+	if(glad_glSecondaryColorP3ui == NULL) {
+		glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+		glad_lazy_missing("glSecondaryColorP3ui");
+		return;
+	}
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_load("glSecondaryColorP3uiv");
+	if(glad_glSecondaryColorP3uiv == NULL) {
+		glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+		glad_lazy_missing("glSecondaryColorP3uiv");
+		return;
+	}
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) {
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glad_lazy_load("glMinSampleShading");
+	if(glad_glMinSampleShading == NULL) {
+		glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+		glad_lazy_missing("glMinSampleShading");
+		return;
+	}
+	glad_glMinSampleShading(value);
+}
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glad_lazy_load("glBlendEquationi");
+	if(glad_glBlendEquationi == NULL) {
+		glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+		glad_lazy_missing("glBlendEquationi");
+		return;
+	}
+	glad_glBlendEquationi(buf, mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glad_lazy_load("glBlendEquationSeparatei");
+	if(glad_glBlendEquationSeparatei == NULL) {
+		glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+		glad_lazy_missing("glBlendEquationSeparatei");
+		return;
+	}
+	glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)glad_lazy_load("glBlendFunci");
+	if(glad_glBlendFunci == NULL) {
+		glad_glBlendFunci = glad_lazy_glBlendFunci;
+		glad_lazy_missing("glBlendFunci");
+		return;
+	}
+	glad_glBlendFunci(buf, src, dst);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glad_lazy_load("glBlendFuncSeparatei");
+	if(glad_glBlendFuncSeparatei == NULL) {
+		glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+		glad_lazy_missing("glBlendFuncSeparatei");
+		return;
+	}
+	glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_load("glDrawArraysIndirect");
+	if(glad_glDrawArraysIndirect == NULL) {
+		glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+		glad_lazy_missing("glDrawArraysIndirect");
+		return;
+	}
+	glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_load("glDrawElementsIndirect");
+	if(glad_glDrawElementsIndirect == NULL) {
+		glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+		glad_lazy_missing("glDrawElementsIndirect");
+		return;
+	}
+	glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) {
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)glad_lazy_load("glUniform1d");
+	if(glad_glUniform1d == NULL) {
+		glad_glUniform1d = glad_lazy_glUniform1d;
+		glad_lazy_missing("glUniform1d");
+		return;
+	}
+	glad_glUniform1d(location, x);
+}
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)glad_lazy_load("glUniform2d");
+	if(glad_glUniform2d == NULL) {
+		glad_glUniform2d = glad_lazy_glUniform2d;
+		glad_lazy_missing("glUniform2d");
+		return;
+	}
+	glad_glUniform2d(location, x, y);
+}
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)glad_lazy_load("glUniform3d");
+	if(glad_glUniform3d == NULL) {
+		glad_glUniform3d = glad_lazy_glUniform3d;
+		glad_lazy_missing("glUniform3d");
+		return;
+	}
+	glad_glUniform3d(location, x, y, z);
+}
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)glad_lazy_load("glUniform4d");
+	if(glad_glUniform4d == NULL) {
+		glad_glUniform4d = glad_lazy_glUniform4d;
+		glad_lazy_missing("glUniform4d");
+		return;
+	}
+	glad_glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)glad_lazy_load("glUniform1dv");
+	if(glad_glUniform1dv == NULL) {
+		glad_glUniform1dv = glad_lazy_glUniform1dv;
+		glad_lazy_missing("glUniform1dv");
+		return;
+	}
+	glad_glUniform1dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)glad_lazy_load("glUniform2dv");
+	if(glad_glUniform2dv == NULL) {
+		glad_glUniform2dv = glad_lazy_glUniform2dv;
+		glad_lazy_missing("glUniform2dv");
+		return;
+	}
+	glad_glUniform2dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)glad_lazy_load("glUniform3dv");
+	if(glad_glUniform3dv == NULL) {
+		glad_glUniform3dv = glad_lazy_glUniform3dv;
+		glad_lazy_missing("glUniform3dv");
+		return;
+	}
+	glad_glUniform3dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)glad_lazy_load("glUniform4dv");
+	if(glad_glUniform4dv == NULL) {
+		glad_glUniform4dv = glad_lazy_glUniform4dv;
+		glad_lazy_missing("glUniform4dv");
+		return;
+	}
+	glad_glUniform4dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glad_lazy_load("glUniformMatrix2dv");
+	if(glad_glUniformMatrix2dv == NULL) {
+		glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+		glad_lazy_missing("glUniformMatrix2dv");
+		return;
+	}
+	glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glad_lazy_load("glUniformMatrix3dv");
+	if(glad_glUniformMatrix3dv == NULL) {
+		glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+		glad_lazy_missing("glUniformMatrix3dv");
+		return;
+	}
+	glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glad_lazy_load("glUniformMatrix4dv");
+	if(glad_glUniformMatrix4dv == NULL) {
+		glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+		glad_lazy_missing("glUniformMatrix4dv");
+		return;
+	}
+	glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glad_lazy_load("glUniformMatrix2x3dv");
+	if(glad_glUniformMatrix2x3dv == NULL) {
+		glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+		glad_lazy_missing("glUniformMatrix2x3dv");
+		return;
+	}
+	glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glad_lazy_load("glUniformMatrix2x4dv");
+	if(glad_glUniformMatrix2x4dv == NULL) {
+		glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+		glad_lazy_missing("glUniformMatrix2x4dv");
+		return;
+	}
+	glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glad_lazy_load("glUniformMatrix3x2dv");
+	if(glad_glUniformMatrix3x2dv == NULL) {
+		glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+		glad_lazy_missing("glUniformMatrix3x2dv");
+		return;
+	}
+	glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glad_lazy_load("glUniformMatrix3x4dv");
+	if(glad_glUniformMatrix3x4dv == NULL) {
+		glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+		glad_lazy_missing("glUniformMatrix3x4dv");
+		return;
+	}
+	glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glad_lazy_load("glUniformMatrix4x2dv");
+	if(glad_glUniformMatrix4x2dv == NULL) {
+		glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+		glad_lazy_missing("glUniformMatrix4x2dv");
+		return;
+	}
+	glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glad_lazy_load("glUniformMatrix4x3dv");
+	if(glad_glUniformMatrix4x3dv == NULL) {
+		glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+		glad_lazy_missing("glUniformMatrix4x3dv");
+		return;
+	}
+	glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glad_lazy_load("glGetUniformdv");
+	if(glad_glGetUniformdv == NULL) {
+		glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+		glad_lazy_missing("glGetUniformdv");
+		return;
+	}
+	glad_glGetUniformdv(program, location, params);
+}
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_lazy_load("glGetSubroutineUniformLocation");
+	if(glad_glGetSubroutineUniformLocation == NULL) {
+		glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+		glad_lazy_missing("glGetSubroutineUniformLocation");
+		return (GLint)0;
+	}
+	return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glad_lazy_load("glGetSubroutineIndex");
+	if(glad_glGetSubroutineIndex == NULL) {
+		glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+		glad_lazy_missing("glGetSubroutineIndex");
+		return (GLuint)0;
+	}
+	return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_lazy_load("glGetActiveSubroutineUniformiv");
+	if(glad_glGetActiveSubroutineUniformiv == NULL) {
+		glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+		glad_lazy_missing("glGetActiveSubroutineUniformiv");
+		return;
+	}
+	glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_lazy_load("glGetActiveSubroutineUniformName");
+	if(glad_glGetActiveSubroutineUniformName == NULL) {
+		glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+		glad_lazy_missing("glGetActiveSubroutineUniformName");
+		return;
+	}
+	glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glad_lazy_load("glGetActiveSubroutineName");
+	if(glad_glGetActiveSubroutineName == NULL) {
+		glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+		glad_lazy_missing("glGetActiveSubroutineName");
+		return;
+	}
+	glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glad_lazy_load("glUniformSubroutinesuiv");
+	if(glad_glUniformSubroutinesuiv == NULL) {
+		glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+		glad_lazy_missing("glUniformSubroutinesuiv");
+		return;
+	}
+	glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_lazy_load("glGetUniformSubroutineuiv");
+	if(glad_glGetUniformSubroutineuiv == NULL) {
+		glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+		glad_lazy_missing("glGetUniformSubroutineuiv");
+		return;
+	}
+	glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glad_lazy_load("glGetProgramStageiv");
+	if(glad_glGetProgramStageiv == NULL) {
+		glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+		glad_lazy_missing("glGetProgramStageiv");
+		return;
+	}
+	glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) {
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glad_lazy_load("glPatchParameteri");
+	if(glad_glPatchParameteri == NULL) {
+		glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+		glad_lazy_missing("glPatchParameteri");
+		return;
+	}
+	glad_glPatchParameteri(pname, value);
+}
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glad_lazy_load("glPatchParameterfv");
+	if(glad_glPatchParameterfv == NULL) {
+		glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+		glad_lazy_missing("glPatchParameterfv");
+		return;
+	}
+	glad_glPatchParameterfv(pname, values);
+}
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glad_lazy_load("glBindTransformFeedback");
+	if(glad_glBindTransformFeedback == NULL) {
+		glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+		glad_lazy_missing("glBindTransformFeedback");
+		return;
+	}
+	glad_glBindTransformFeedback(target, id);
+}
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_lazy_load("glDeleteTransformFeedbacks");
+	if(glad_glDeleteTransformFeedbacks == NULL) {
+		glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+		glad_lazy_missing("glDeleteTransformFeedbacks");
+		return;
+	}
+	glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glad_lazy_load("glGenTransformFeedbacks");
+	if(glad_glGenTransformFeedbacks == NULL) {
+		glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+		glad_lazy_missing("glGenTransformFeedbacks");
+		return;
+	}
+	glad_glGenTransformFeedbacks(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) {
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glad_lazy_load("glIsTransformFeedback");
+	if(glad_glIsTransformFeedback == NULL) {
+		glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+		glad_lazy_missing("glIsTransformFeedback");
+		return (GLboolean)0;
+	}
+	return glad_glIsTransformFeedback(id);
+}
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_lazy_load("glPauseTransformFeedback");
+	if(glad_glPauseTransformFeedback == NULL) {
+		glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+		glad_lazy_missing("glPauseTransformFeedback");
+		return;
+	}
+	glad_glPauseTransformFeedback();
+}
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_lazy_load("glResumeTransformFeedback");
+	if(glad_glResumeTransformFeedback == NULL) {
+		glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+		glad_lazy_missing("glResumeTransformFeedback");
+		return;
+	}
+	glad_glResumeTransformFeedback();
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_lazy_load("glDrawTransformFeedback");
+	if(glad_glDrawTransformFeedback == NULL) {
+		glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+		glad_lazy_missing("glDrawTransformFeedback");
+		return;
+	}
+	glad_glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_lazy_load("glDrawTransformFeedbackStream");
+	if(glad_glDrawTransformFeedbackStream == NULL) {
+		glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+		glad_lazy_missing("glDrawTransformFeedbackStream");
+		return;
+	}
+	glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glad_lazy_load("glBeginQueryIndexed");
+	if(glad_glBeginQueryIndexed == NULL) {
+		glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+		glad_lazy_missing("glBeginQueryIndexed");
+		return;
+	}
+	glad_glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glad_lazy_load("glEndQueryIndexed");
+	if(glad_glEndQueryIndexed == NULL) {
+		glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+		glad_lazy_missing("glEndQueryIndexed");
+		return;
+	}
+	glad_glEndQueryIndexed(target, index);
+}
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glad_lazy_load("glGetQueryIndexediv");
+	if(glad_glGetQueryIndexediv == NULL) {
+		glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+		glad_lazy_missing("glGetQueryIndexediv");
+		return;
+	}
+	glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glad_lazy_load("glReleaseShaderCompiler");
+	if(glad_glReleaseShaderCompiler == NULL) {
+		glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+		glad_lazy_missing("glReleaseShaderCompiler");
+		return;
+	}
+	glad_glReleaseShaderCompiler();
+}
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)glad_lazy_load("glShaderBinary");
+	if(glad_glShaderBinary == NULL) {
+		glad_glShaderBinary = glad_lazy_glShaderBinary;
+		glad_lazy_missing("glShaderBinary");
+		return;
+	}
+	glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glad_lazy_load("glGetShaderPrecisionFormat");
+	if(glad_glGetShaderPrecisionFormat == NULL) {
+		glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+		glad_lazy_missing("glGetShaderPrecisionFormat");
+		return;
+	}
+	glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) {
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)glad_lazy_load("glDepthRangef");
+	if(glad_glDepthRangef == NULL) {
+		glad_glDepthRangef = glad_lazy_glDepthRangef;
+		glad_lazy_missing("glDepthRangef");
+		return;
+	}
+	glad_glDepthRangef(n, f);
+}
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) {
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)glad_lazy_load("glClearDepthf");
+	if(glad_glClearDepthf == NULL) {
+		glad_glClearDepthf = glad_lazy_glClearDepthf;
+		glad_lazy_missing("glClearDepthf");
+		return;
+	}
+	glad_glClearDepthf(d);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_load("glGetProgramBinary");
+	if(glad_glGetProgramBinary == NULL) {
+		glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+		glad_lazy_missing("glGetProgramBinary");
+		return;
+	}
+	glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)glad_lazy_load("glProgramBinary");
+	if(glad_glProgramBinary == NULL) {
+		glad_glProgramBinary = glad_lazy_glProgramBinary;
+		glad_lazy_missing("glProgramBinary");
+		return;
+	}
+	glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_load("glProgramParameteri");
+	if(glad_glProgramParameteri == NULL) {
+		glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+		glad_lazy_missing("glProgramParameteri");
+		return;
+	}
+	glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glad_lazy_load("glUseProgramStages");
+	if(glad_glUseProgramStages == NULL) {
+		glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+		glad_lazy_missing("glUseProgramStages");
+		return;
+	}
+	glad_glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glad_lazy_load("glActiveShaderProgram");
+	if(glad_glActiveShaderProgram == NULL) {
+		glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+		glad_lazy_missing("glActiveShaderProgram");
+		return;
+	}
+	glad_glActiveShaderProgram(pipeline, program);
+}
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glad_lazy_load("glCreateShaderProgramv");
+	if(glad_glCreateShaderProgramv == NULL) {
+		glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+		glad_lazy_missing("glCreateShaderProgramv");
+		return (GLuint)0;
+	}
+	return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) {
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glad_lazy_load("glBindProgramPipeline");
+	if(glad_glBindProgramPipeline == NULL) {
+		glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+		glad_lazy_missing("glBindProgramPipeline");
+		return;
+	}
+	glad_glBindProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glad_lazy_load("glDeleteProgramPipelines");
+	if(glad_glDeleteProgramPipelines == NULL) {
+		glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+		glad_lazy_missing("glDeleteProgramPipelines");
+		return;
+	}
+	glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glad_lazy_load("glGenProgramPipelines");
+	if(glad_glGenProgramPipelines == NULL) {
+		glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+		glad_lazy_missing("glGenProgramPipelines");
+		return;
+	}
+	glad_glGenProgramPipelines(n, pipelines);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) {
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glad_lazy_load("glIsProgramPipeline");
+	if(glad_glIsProgramPipeline == NULL) {
+		glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+		glad_lazy_missing("glIsProgramPipeline");
+		return (GLboolean)0;
+	}
+	return glad_glIsProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glad_lazy_load("glGetProgramPipelineiv");
+	if(glad_glGetProgramPipelineiv == NULL) {
+		glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+		glad_lazy_missing("glGetProgramPipelineiv");
+		return;
+	}
+	glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glad_lazy_load("glProgramUniform1i");
+	if(glad_glProgramUniform1i == NULL) {
+		glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+		glad_lazy_missing("glProgramUniform1i");
+		return;
+	}
+	glad_glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glad_lazy_load("glProgramUniform1iv");
+	if(glad_glProgramUniform1iv == NULL) {
+		glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+		glad_lazy_missing("glProgramUniform1iv");
+		return;
+	}
+	glad_glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glad_lazy_load("glProgramUniform1f");
+	if(glad_glProgramUniform1f == NULL) {
+		glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+		glad_lazy_missing("glProgramUniform1f");
+		return;
+	}
+	glad_glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glad_lazy_load("glProgramUniform1fv");
+	if(glad_glProgramUniform1fv == NULL) {
+		glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+		glad_lazy_missing("glProgramUniform1fv");
+		return;
+	}
+	glad_glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glad_lazy_load("glProgramUniform1d");
+	if(glad_glProgramUniform1d == NULL) {
+		glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+		glad_lazy_missing("glProgramUniform1d");
+		return;
+	}
+	glad_glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glad_lazy_load("glProgramUniform1dv");
+	if(glad_glProgramUniform1dv == NULL) {
+		glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+		glad_lazy_missing("glProgramUniform1dv");
+		return;
+	}
+	glad_glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glad_lazy_load("glProgramUniform1ui");
+	if(glad_glProgramUniform1ui == NULL) {
+		glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+		glad_lazy_missing("glProgramUniform1ui");
+		return;
+	}
+	glad_glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glad_lazy_load("glProgramUniform1uiv");
+	if(glad_glProgramUniform1uiv == NULL) {
+		glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+		glad_lazy_missing("glProgramUniform1uiv");
+		return;
+	}
+	glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glad_lazy_load("glProgramUniform2i");
+	if(glad_glProgramUniform2i == NULL) {
+		glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+		glad_lazy_missing("glProgramUniform2i");
+		return;
+	}
+	glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glad_lazy_load("glProgramUniform2iv");
+	if(glad_glProgramUniform2iv == NULL) {
+		glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+		glad_lazy_missing("glProgramUniform2iv");
+		return;
+	}
+	glad_glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glad_lazy_load("glProgramUniform2f");
+	if(glad_glProgramUniform2f == NULL) {
+		glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+		glad_lazy_missing("glProgramUniform2f");
+		return;
+	}
+	glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glad_lazy_load("glProgramUniform2fv");
+	if(glad_glProgramUniform2fv == NULL) {
+		glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+		glad_lazy_missing("glProgramUniform2fv");
+		return;
+	}
+	glad_glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glad_lazy_load("glProgramUniform2d");
+	if(glad_glProgramUniform2d == NULL) {
+		glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+		glad_lazy_missing("glProgramUniform2d");
+		return;
+	}
+	glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glad_lazy_load("glProgramUniform2dv");
+	if(glad_glProgramUniform2dv == NULL) {
+		glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+		glad_lazy_missing("glProgramUniform2dv");
+		return;
+	}
+	glad_glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glad_lazy_load("glProgramUniform2ui");
+	if(glad_glProgramUniform2ui == NULL) {
+		glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+		glad_lazy_missing("glProgramUniform2ui");
+		return;
+	}
+	glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glad_lazy_load("glProgramUniform2uiv");
+	if(glad_glProgramUniform2uiv == NULL) {
+		glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+		glad_lazy_missing("glProgramUniform2uiv");
+		return;
+	}
+	glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glad_lazy_load("glProgramUniform3i");
+	if(glad_glProgramUniform3i == NULL) {
+		glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+		glad_lazy_missing("glProgramUniform3i");
+		return;
+	}
+	glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glad_lazy_load("glProgramUniform3iv");
+	if(glad_glProgramUniform3iv == NULL) {
+		glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+		glad_lazy_missing("glProgramUniform3iv");
+		return;
+	}
+	glad_glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glad_lazy_load("glProgramUniform3f");
+	if(glad_glProgramUniform3f == NULL) {
+		glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+		glad_lazy_missing("glProgramUniform3f");
+		return;
+	}
+	glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glad_lazy_load("glProgramUniform3fv");
+	if(glad_glProgramUniform3fv == NULL) {
+		glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+		glad_lazy_missing("glProgramUniform3fv");
+		return;
+	}
+	glad_glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glad_lazy_load("glProgramUniform3d");
+	if(glad_glProgramUniform3d == NULL) {
+		glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+		glad_lazy_missing("glProgramUniform3d");
+		return;
+	}
+	glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glad_lazy_load("glProgramUniform3dv");
+	if(glad_glProgramUniform3dv == NULL) {
+		glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+		glad_lazy_missing("glProgramUniform3dv");
+		return;
+	}
+	glad_glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glad_lazy_load("glProgramUniform3ui");
+	if(glad_glProgramUniform3ui == NULL) {
+		glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+		glad_lazy_missing("glProgramUniform3ui");
+		return;
+	}
+	glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glad_lazy_load("glProgramUniform3uiv");
+	if(glad_glProgramUniform3uiv == NULL) {
+		glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+		glad_lazy_missing("glProgramUniform3uiv");
+		return;
+	}
+	glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glad_lazy_load("glProgramUniform4i");
+	if(glad_glProgramUniform4i == NULL) {
+		glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+		glad_lazy_missing("glProgramUniform4i");
+		return;
+	}
+	glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glad_lazy_load("glProgramUniform4iv");
+	if(glad_glProgramUniform4iv == NULL) {
+		glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+		glad_lazy_missing("glProgramUniform4iv");
+		return;
+	}
+	glad_glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glad_lazy_load("glProgramUniform4f");
+	if(glad_glProgramUniform4f == NULL) {
+		glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+		glad_lazy_missing("glProgramUniform4f");
+		return;
+	}
+	glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glad_lazy_load("glProgramUniform4fv");
+	if(glad_glProgramUniform4fv == NULL) {
+		glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+		glad_lazy_missing("glProgramUniform4fv");
+		return;
+	}
+	glad_glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glad_lazy_load("glProgramUniform4d");
+	if(glad_glProgramUniform4d == NULL) {
+		glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+		glad_lazy_missing("glProgramUniform4d");
+		return;
+	}
+	glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glad_lazy_load("glProgramUniform4dv");
+	if(glad_glProgramUniform4dv == NULL) {
+		glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+		glad_lazy_missing("glProgramUniform4dv");
+		return;
+	}
+	glad_glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glad_lazy_load("glProgramUniform4ui");
+	if(glad_glProgramUniform4ui == NULL) {
+		glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+		glad_lazy_missing("glProgramUniform4ui");
+		return;
+	}
+	glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glad_lazy_load("glProgramUniform4uiv");
+	if(glad_glProgramUniform4uiv == NULL) {
+		glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+		glad_lazy_missing("glProgramUniform4uiv");
+		return;
+	}
+	glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_lazy_load("glProgramUniformMatrix2fv");
+	if(glad_glProgramUniformMatrix2fv == NULL) {
+		glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+		glad_lazy_missing("glProgramUniformMatrix2fv");
+		return;
+	}
+	glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_lazy_load("glProgramUniformMatrix3fv");
+	if(glad_glProgramUniformMatrix3fv == NULL) {
+		glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+		glad_lazy_missing("glProgramUniformMatrix3fv");
+		return;
+	}
+	glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_lazy_load("glProgramUniformMatrix4fv");
+	if(glad_glProgramUniformMatrix4fv == NULL) {
+		glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+		glad_lazy_missing("glProgramUniformMatrix4fv");
+		return;
+	}
+	glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_lazy_load("glProgramUniformMatrix2dv");
+	if(glad_glProgramUniformMatrix2dv == NULL) {
+		glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+		glad_lazy_missing("glProgramUniformMatrix2dv");
+		return;
+	}
+	glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_lazy_load("glProgramUniformMatrix3dv");
+	if(glad_glProgramUniformMatrix3dv == NULL) {
+		glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+		glad_lazy_missing("glProgramUniformMatrix3dv");
+		return;
+	}
+	glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_lazy_load("glProgramUniformMatrix4dv");
+	if(glad_glProgramUniformMatrix4dv == NULL) {
+		glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+		glad_lazy_missing("glProgramUniformMatrix4dv");
+		return;
+	}
+	glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_lazy_load("glProgramUniformMatrix2x3fv");
+	if(glad_glProgramUniformMatrix2x3fv == NULL) {
+		glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+		glad_lazy_missing("glProgramUniformMatrix2x3fv");
+		return;
+	}
+	glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_lazy_load("glProgramUniformMatrix3x2fv");
+	if(glad_glProgramUniformMatrix3x2fv == NULL) {
+		glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+		glad_lazy_missing("glProgramUniformMatrix3x2fv");
+		return;
+	}
+	glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_lazy_load("glProgramUniformMatrix2x4fv");
+	if(glad_glProgramUniformMatrix2x4fv == NULL) {
+		glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+		glad_lazy_missing("glProgramUniformMatrix2x4fv");
+		return;
+	}
+	glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_lazy_load("glProgramUniformMatrix4x2fv");
+	if(glad_glProgramUniformMatrix4x2fv == NULL) {
+		glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+		glad_lazy_missing("glProgramUniformMatrix4x2fv");
+		return;
+	}
+	glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_lazy_load("glProgramUniformMatrix3x4fv");
+	if(glad_glProgramUniformMatrix3x4fv == NULL) {
+		glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+		glad_lazy_missing("glProgramUniformMatrix3x4fv");
+		return;
+	}
+	glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_lazy_load("glProgramUniformMatrix4x3fv");
+	if(glad_glProgramUniformMatrix4x3fv == NULL) {
+		glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+		glad_lazy_missing("glProgramUniformMatrix4x3fv");
+		return;
+	}
+	glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_lazy_load("glProgramUniformMatrix2x3dv");
+	if(glad_glProgramUniformMatrix2x3dv == NULL) {
+		glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+		glad_lazy_missing("glProgramUniformMatrix2x3dv");
+		return;
+	}
+	glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_lazy_load("glProgramUniformMatrix3x2dv");
+	if(glad_glProgramUniformMatrix3x2dv == NULL) {
+		glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+		glad_lazy_missing("glProgramUniformMatrix3x2dv");
+		return;
+	}
+	glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_lazy_load("glProgramUniformMatrix2x4dv");
+	if(glad_glProgramUniformMatrix2x4dv == NULL) {
+		glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+		glad_lazy_missing("glProgramUniformMatrix2x4dv");
+		return;
+	}
+	glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_lazy_load("glProgramUniformMatrix4x2dv");
+	if(glad_glProgramUniformMatrix4x2dv == NULL) {
+		glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+		glad_lazy_missing("glProgramUniformMatrix4x2dv");
+		return;
+	}
+	glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_lazy_load("glProgramUniformMatrix3x4dv");
+	if(glad_glProgramUniformMatrix3x4dv == NULL) {
+		glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+		glad_lazy_missing("glProgramUniformMatrix3x4dv");
+		return;
+	}
+	glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_lazy_load("glProgramUniformMatrix4x3dv");
+	if(glad_glProgramUniformMatrix4x3dv == NULL) {
+		glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+		glad_lazy_missing("glProgramUniformMatrix4x3dv");
+		return;
+	}
+	glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) {
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_lazy_load("glValidateProgramPipeline");
+	if(glad_glValidateProgramPipeline == NULL) {
+		glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+		glad_lazy_missing("glValidateProgramPipeline");
+		return;
+	}
+	glad_glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_lazy_load("glGetProgramPipelineInfoLog");
+	if(glad_glGetProgramPipelineInfoLog == NULL) {
+		glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+		glad_lazy_missing("glGetProgramPipelineInfoLog");
+		return;
+	}
+	glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glad_lazy_load("glVertexAttribL1d");
+	if(glad_glVertexAttribL1d == NULL) {
+		glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+		glad_lazy_missing("glVertexAttribL1d");
+		return;
+	}
+	glad_glVertexAttribL1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glad_lazy_load("glVertexAttribL2d");
+	if(glad_glVertexAttribL2d == NULL) {
+		glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+		glad_lazy_missing("glVertexAttribL2d");
+		return;
+	}
+	glad_glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glad_lazy_load("glVertexAttribL3d");
+	if(glad_glVertexAttribL3d == NULL) {
+		glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+		glad_lazy_missing("glVertexAttribL3d");
+		return;
+	}
+	glad_glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glad_lazy_load("glVertexAttribL4d");
+	if(glad_glVertexAttribL4d == NULL) {
+		glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+		glad_lazy_missing("glVertexAttribL4d");
+		return;
+	}
+	glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glad_lazy_load("glVertexAttribL1dv");
+	if(glad_glVertexAttribL1dv == NULL) {
+		glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+		glad_lazy_missing("glVertexAttribL1dv");
+		return;
+	}
+	glad_glVertexAttribL1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glad_lazy_load("glVertexAttribL2dv");
+	if(glad_glVertexAttribL2dv == NULL) {
+		glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+		glad_lazy_missing("glVertexAttribL2dv");
+		return;
+	}
+	glad_glVertexAttribL2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glad_lazy_load("glVertexAttribL3dv");
+	if(glad_glVertexAttribL3dv == NULL) {
+		glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+		glad_lazy_missing("glVertexAttribL3dv");
+		return;
+	}
+	glad_glVertexAttribL3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glad_lazy_load("glVertexAttribL4dv");
+	if(glad_glVertexAttribL4dv == NULL) {
+		glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+		glad_lazy_missing("glVertexAttribL4dv");
+		return;
+	}
+	glad_glVertexAttribL4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glad_lazy_load("glVertexAttribLPointer");
+	if(glad_glVertexAttribLPointer == NULL) {
+		glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+		glad_lazy_missing("glVertexAttribLPointer");
+		return;
+	}
+	glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glad_lazy_load("glGetVertexAttribLdv");
+	if(glad_glGetVertexAttribLdv == NULL) {
+		glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+		glad_lazy_missing("glGetVertexAttribLdv");
+		return;
+	}
+	glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glad_lazy_load("glViewportArrayv");
+	if(glad_glViewportArrayv == NULL) {
+		glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+		glad_lazy_missing("glViewportArrayv");
+		return;
+	}
+	glad_glViewportArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glad_lazy_load("glViewportIndexedf");
+	if(glad_glViewportIndexedf == NULL) {
+		glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+		glad_lazy_missing("glViewportIndexedf");
+		return;
+	}
+	glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glad_lazy_load("glViewportIndexedfv");
+	if(glad_glViewportIndexedfv == NULL) {
+		glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+		glad_lazy_missing("glViewportIndexedfv");
+		return;
+	}
+	glad_glViewportIndexedfv(index, v);
+}
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glad_lazy_load("glScissorArrayv");
+	if(glad_glScissorArrayv == NULL) {
+		glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+		glad_lazy_missing("glScissorArrayv");
+		return;
+	}
+	glad_glScissorArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glad_lazy_load("glScissorIndexed");
+	if(glad_glScissorIndexed == NULL) {
+		glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+		glad_lazy_missing("glScissorIndexed");
+		return;
+	}
+	glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glad_lazy_load("glScissorIndexedv");
+	if(glad_glScissorIndexedv == NULL) {
+		glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+		glad_lazy_missing("glScissorIndexedv");
+		return;
+	}
+	glad_glScissorIndexedv(index, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glad_lazy_load("glDepthRangeArrayv");
+	if(glad_glDepthRangeArrayv == NULL) {
+		glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+		glad_lazy_missing("glDepthRangeArrayv");
+		return;
+	}
+	glad_glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glad_lazy_load("glDepthRangeIndexed");
+	if(glad_glDepthRangeIndexed == NULL) {
+		glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+		glad_lazy_missing("glDepthRangeIndexed");
+		return;
+	}
+	glad_glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)glad_lazy_load("glGetFloati_v");
+	if(glad_glGetFloati_v == NULL) {
+		glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+		glad_lazy_missing("glGetFloati_v");
+		return;
+	}
+	glad_glGetFloati_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glad_lazy_load("glGetDoublei_v");
+	if(glad_glGetDoublei_v == NULL) {
+		glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+		glad_lazy_missing("glGetDoublei_v");
+		return;
+	}
+	glad_glGetDoublei_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_load("glDrawArraysInstancedBaseInstance");
+	if(glad_glDrawArraysInstancedBaseInstance == NULL) {
+		glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+		glad_lazy_missing("glDrawArraysInstancedBaseInstance");
+		return;
+	}
+	glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_load("glDrawElementsInstancedBaseInstance");
+	if(glad_glDrawElementsInstancedBaseInstance == NULL) {
+		glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+		glad_lazy_missing("glDrawElementsInstancedBaseInstance");
+		return;
+	}
+	glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_load("glDrawElementsInstancedBaseVertexBaseInstance");
+	if(glad_glDrawElementsInstancedBaseVertexBaseInstance == NULL) {
+		glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+		glad_lazy_missing("glDrawElementsInstancedBaseVertexBaseInstance");
+		return;
+	}
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glad_lazy_load("glGetInternalformativ");
+	if(glad_glGetInternalformativ == NULL) {
+		glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+		glad_lazy_missing("glGetInternalformativ");
+		return;
+	}
+	glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_lazy_load("glGetActiveAtomicCounterBufferiv");
+	if(glad_glGetActiveAtomicCounterBufferiv == NULL) {
+		glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+		glad_lazy_missing("glGetActiveAtomicCounterBufferiv");
+		return;
+	}
+	glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glad_lazy_load("glBindImageTexture");
+	if(glad_glBindImageTexture == NULL) {
+		glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+		glad_lazy_missing("glBindImageTexture");
+		return;
+	}
+	glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) {
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glad_lazy_load("glMemoryBarrier");
+	if(glad_glMemoryBarrier == NULL) {
+		glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+		glad_lazy_missing("glMemoryBarrier");
+		return;
+	}
+	glad_glMemoryBarrier(barriers);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glad_lazy_load("glTexStorage1D");
+	if(glad_glTexStorage1D == NULL) {
+		glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+		glad_lazy_missing("glTexStorage1D");
+		return;
+	}
+	glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glad_lazy_load("glTexStorage2D");
+	if(glad_glTexStorage2D == NULL) {
+		glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+		glad_lazy_missing("glTexStorage2D");
+		return;
+	}
+	glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glad_lazy_load("glTexStorage3D");
+	if(glad_glTexStorage3D == NULL) {
+		glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+		glad_lazy_missing("glTexStorage3D");
+		return;
+	}
+	glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_lazy_load("glDrawTransformFeedbackInstanced");
+	if(glad_glDrawTransformFeedbackInstanced == NULL) {
+		glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+		glad_lazy_missing("glDrawTransformFeedbackInstanced");
+		return;
+	}
+	glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_lazy_load("glDrawTransformFeedbackStreamInstanced");
+	if(glad_glDrawTransformFeedbackStreamInstanced == NULL) {
+		glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+		glad_lazy_missing("glDrawTransformFeedbackStreamInstanced");
+		return;
+	}
+	glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glad_lazy_load("glClearBufferData");
+	if(glad_glClearBufferData == NULL) {
+		glad_glClearBufferData = glad_lazy_glClearBufferData;
+		glad_lazy_missing("glClearBufferData");
+		return;
+	}
+	glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glad_lazy_load("glClearBufferSubData");
+	if(glad_glClearBufferSubData == NULL) {
+		glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+		glad_lazy_missing("glClearBufferSubData");
+		return;
+	}
+	glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glad_lazy_load("glDispatchCompute");
+	if(glad_glDispatchCompute == NULL) {
+		glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+		glad_lazy_missing("glDispatchCompute");
+		return;
+	}
+	glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) {
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_lazy_load("glDispatchComputeIndirect");
+	if(glad_glDispatchComputeIndirect == NULL) {
+		glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+		glad_lazy_missing("glDispatchComputeIndirect");
+		return;
+	}
+	glad_glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glad_lazy_load("glCopyImageSubData");
+	if(glad_glCopyImageSubData == NULL) {
+		glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+		glad_lazy_missing("glCopyImageSubData");
+		return;
+	}
+	glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glad_lazy_load("glFramebufferParameteri");
+	if(glad_glFramebufferParameteri == NULL) {
+		glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+		glad_lazy_missing("glFramebufferParameteri");
+		return;
+	}
+	glad_glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_lazy_load("glGetFramebufferParameteriv");
+	if(glad_glGetFramebufferParameteriv == NULL) {
+		glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+		glad_lazy_missing("glGetFramebufferParameteriv");
+		return;
+	}
+	glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glad_lazy_load("glGetInternalformati64v");
+	if(glad_glGetInternalformati64v == NULL) {
+		glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+		glad_lazy_missing("glGetInternalformati64v");
+		return;
+	}
+	glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_load("glInvalidateTexSubImage");
+	if(glad_glInvalidateTexSubImage == NULL) {
+		glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+		glad_lazy_missing("glInvalidateTexSubImage");
+		return;
+	}
+	glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_load("glInvalidateTexImage");
+	if(glad_glInvalidateTexImage == NULL) {
+		glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+		glad_lazy_missing("glInvalidateTexImage");
+		return;
+	}
+	glad_glInvalidateTexImage(texture, level);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_load("glInvalidateBufferSubData");
+	if(glad_glInvalidateBufferSubData == NULL) {
+		glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+		glad_lazy_missing("glInvalidateBufferSubData");
+		return;
+	}
+	glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_load("glInvalidateBufferData");
+	if(glad_glInvalidateBufferData == NULL) {
+		glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+		glad_lazy_missing("glInvalidateBufferData");
+		return;
+	}
+	glad_glInvalidateBufferData(buffer);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_load("glInvalidateFramebuffer");
+	if(glad_glInvalidateFramebuffer == NULL) {
+		glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+		glad_lazy_missing("glInvalidateFramebuffer");
+		return;
+	}
+	glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_load("glInvalidateSubFramebuffer");
+	if(glad_glInvalidateSubFramebuffer == NULL) {
+		glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+		glad_lazy_missing("glInvalidateSubFramebuffer");
+		return;
+	}
+	glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_load("glMultiDrawArraysIndirect");
+	if(glad_glMultiDrawArraysIndirect == NULL) {
+		glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+		glad_lazy_missing("glMultiDrawArraysIndirect");
+		return;
+	}
+	glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_load("glMultiDrawElementsIndirect");
+	if(glad_glMultiDrawElementsIndirect == NULL) {
+		glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+		glad_lazy_missing("glMultiDrawElementsIndirect");
+		return;
+	}
+	glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glad_lazy_load("glGetProgramInterfaceiv");
+	if(glad_glGetProgramInterfaceiv == NULL) {
+		glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+		glad_lazy_missing("glGetProgramInterfaceiv");
+		return;
+	}
+	glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_lazy_load("glGetProgramResourceIndex");
+	if(glad_glGetProgramResourceIndex == NULL) {
+		glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+		glad_lazy_missing("glGetProgramResourceIndex");
+		return (GLuint)0;
+	}
+	return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glad_lazy_load("glGetProgramResourceName");
+	if(glad_glGetProgramResourceName == NULL) {
+		glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+		glad_lazy_missing("glGetProgramResourceName");
+		return;
+	}
+	glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glad_lazy_load("glGetProgramResourceiv");
+	if(glad_glGetProgramResourceiv == NULL) {
+		glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+		glad_lazy_missing("glGetProgramResourceiv");
+		return;
+	}
+	glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_lazy_load("glGetProgramResourceLocation");
+	if(glad_glGetProgramResourceLocation == NULL) {
+		glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+		glad_lazy_missing("glGetProgramResourceLocation");
+		return (GLint)0;
+	}
+	return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_lazy_load("glGetProgramResourceLocationIndex");
+	if(glad_glGetProgramResourceLocationIndex == NULL) {
+		glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+		glad_lazy_missing("glGetProgramResourceLocationIndex");
+		return (GLint)0;
+	}
+	return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_lazy_load("glShaderStorageBlockBinding");
+	if(glad_glShaderStorageBlockBinding == NULL) {
+		glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+		glad_lazy_missing("glShaderStorageBlockBinding");
+		return;
+	}
+	glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glad_lazy_load("glTexBufferRange");
+	if(glad_glTexBufferRange == NULL) {
+		glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+		glad_lazy_missing("glTexBufferRange");
+		return;
+	}
+	glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_lazy_load("glTexStorage2DMultisample");
+	if(glad_glTexStorage2DMultisample == NULL) {
+		glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+		glad_lazy_missing("glTexStorage2DMultisample");
+		return;
+	}
+	glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_lazy_load("glTexStorage3DMultisample");
+	if(glad_glTexStorage3DMultisample == NULL) {
+		glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+		glad_lazy_missing("glTexStorage3DMultisample");
+		return;
+	}
+	glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)glad_lazy_load("glTextureView");
+	if(glad_glTextureView == NULL) {
+		glad_glTextureView = glad_lazy_glTextureView;
+		glad_lazy_missing("glTextureView");
+		return;
+	}
+	glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glad_lazy_load("glBindVertexBuffer");
+	if(glad_glBindVertexBuffer == NULL) {
+		glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+		glad_lazy_missing("glBindVertexBuffer");
+		return;
+	}
+	glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glad_lazy_load("glVertexAttribFormat");
+	if(glad_glVertexAttribFormat == NULL) {
+		glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+		glad_lazy_missing("glVertexAttribFormat");
+		return;
+	}
+	glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glad_lazy_load("glVertexAttribIFormat");
+	if(glad_glVertexAttribIFormat == NULL) {
+		glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+		glad_lazy_missing("glVertexAttribIFormat");
+		return;
+	}
+	glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glad_lazy_load("glVertexAttribLFormat");
+	if(glad_glVertexAttribLFormat == NULL) {
+		glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+		glad_lazy_missing("glVertexAttribLFormat");
+		return;
+	}
+	glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glad_lazy_load("glVertexAttribBinding");
+	if(glad_glVertexAttribBinding == NULL) {
+		glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+		glad_lazy_missing("glVertexAttribBinding");
+		return;
+	}
+	glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glad_lazy_load("glVertexBindingDivisor");
+	if(glad_glVertexBindingDivisor == NULL) {
+		glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+		glad_lazy_missing("glVertexBindingDivisor");
+		return;
+	}
+	glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_load("glDebugMessageControl");
+	if(glad_glDebugMessageControl == NULL) {
+		glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+		glad_lazy_missing("glDebugMessageControl");
+		return;
+	}
+	glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_load("glDebugMessageInsert");
+	if(glad_glDebugMessageInsert == NULL) {
+		glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+		glad_lazy_missing("glDebugMessageInsert");
+		return;
+	}
+	glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_load("glDebugMessageCallback");
+	if(glad_glDebugMessageCallback == NULL) {
+		glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+		glad_lazy_missing("glDebugMessageCallback");
+		return;
+	}
+	glad_glDebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_load("glGetDebugMessageLog");
+	if(glad_glGetDebugMessageLog == NULL) {
+		glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+		glad_lazy_missing("glGetDebugMessageLog");
+		return (GLuint)0;
+	}
+	return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glad_lazy_load("glPushDebugGroup");
+	if(glad_glPushDebugGroup == NULL) {
+		glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+		glad_lazy_missing("glPushDebugGroup");
+		return;
+	}
+	glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glad_lazy_load("glPopDebugGroup");
+	if(glad_glPopDebugGroup == NULL) {
+		glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+		glad_lazy_missing("glPopDebugGroup");
+		return;
+	}
+	glad_glPopDebugGroup();
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)glad_lazy_load("glObjectLabel");
+	if(glad_glObjectLabel == NULL) {
+		glad_glObjectLabel = glad_lazy_glObjectLabel;
+		glad_lazy_missing("glObjectLabel");
+		return;
+	}
+	glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glad_lazy_load("glGetObjectLabel");
+	if(glad_glGetObjectLabel == NULL) {
+		glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+		glad_lazy_missing("glGetObjectLabel");
+		return;
+	}
+	glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glad_lazy_load("glObjectPtrLabel");
+	if(glad_glObjectPtrLabel == NULL) {
+		glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+		glad_lazy_missing("glObjectPtrLabel");
+		return;
+	}
+	glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glad_lazy_load("glGetObjectPtrLabel");
+	if(glad_glGetObjectPtrLabel == NULL) {
+		glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+		glad_lazy_missing("glGetObjectPtrLabel");
+		return;
+	}
+	glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)glad_lazy_load("glGetPointerv");
+	if(glad_glGetPointerv == NULL) {
+		glad_glGetPointerv = glad_lazy_glGetPointerv;
+		glad_lazy_missing("glGetPointerv");
+		return;
+	}
+	glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glad_lazy_load("glBufferStorage");
+	if(glad_glBufferStorage == NULL) {
+		glad_glBufferStorage = glad_lazy_glBufferStorage;
+		glad_lazy_missing("glBufferStorage");
+		return;
+	}
+	glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)glad_lazy_load("glClearTexImage");
+	if(glad_glClearTexImage == NULL) {
+		glad_glClearTexImage = glad_lazy_glClearTexImage;
+		glad_lazy_missing("glClearTexImage");
+		return;
+	}
+	glad_glClearTexImage(texture, level, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)glad_lazy_load("glClearTexSubImage");
+	if(glad_glClearTexSubImage == NULL) {
+		glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+		glad_lazy_missing("glClearTexSubImage");
+		return;
+	}
+	glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY glad_lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)glad_lazy_load("glBindBuffersBase");
+	if(glad_glBindBuffersBase == NULL) {
+		glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+		glad_lazy_missing("glBindBuffersBase");
+		return;
+	}
+	glad_glBindBuffersBase(target, first, count, buffers);
+}
+static void APIENTRY glad_lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)glad_lazy_load("glBindBuffersRange");
+	if(glad_glBindBuffersRange == NULL) {
+		glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+		glad_lazy_missing("glBindBuffersRange");
+		return;
+	}
+	glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY glad_lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)glad_lazy_load("glBindTextures");
+	if(glad_glBindTextures == NULL) {
+		glad_glBindTextures = glad_lazy_glBindTextures;
+		glad_lazy_missing("glBindTextures");
+		return;
+	}
+	glad_glBindTextures(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)glad_lazy_load("glBindSamplers");
+	if(glad_glBindSamplers == NULL) {
+		glad_glBindSamplers = glad_lazy_glBindSamplers;
+		glad_lazy_missing("glBindSamplers");
+		return;
+	}
+	glad_glBindSamplers(first, count, samplers);
+}
+static void APIENTRY glad_lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)glad_lazy_load("glBindImageTextures");
+	if(glad_glBindImageTextures == NULL) {
+		glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+		glad_lazy_missing("glBindImageTextures");
+		return;
+	}
+	glad_glBindImageTextures(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)glad_lazy_load("glBindVertexBuffers");
+	if(glad_glBindVertexBuffers == NULL) {
+		glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+		glad_lazy_missing("glBindVertexBuffers");
+		return;
+	}
+	glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glClipControl(GLenum origin, GLenum depth) {
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)glad_lazy_load("glClipControl");
+	if(glad_glClipControl == NULL) {
+		glad_glClipControl = glad_lazy_glClipControl;
+		glad_lazy_missing("glClipControl");
+		return;
+	}
+	glad_glClipControl(origin, depth);
+}
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_lazy_load("glCreateTransformFeedbacks");
+	if(glad_glCreateTransformFeedbacks == NULL) {
+		glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+		glad_lazy_missing("glCreateTransformFeedbacks");
+		return;
+	}
+	glad_glCreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_lazy_load("glTransformFeedbackBufferBase");
+	if(glad_glTransformFeedbackBufferBase == NULL) {
+		glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+		glad_lazy_missing("glTransformFeedbackBufferBase");
+		return;
+	}
+	glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_lazy_load("glTransformFeedbackBufferRange");
+	if(glad_glTransformFeedbackBufferRange == NULL) {
+		glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+		glad_lazy_missing("glTransformFeedbackBufferRange");
+		return;
+	}
+	glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_lazy_load("glGetTransformFeedbackiv");
+	if(glad_glGetTransformFeedbackiv == NULL) {
+		glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+		glad_lazy_missing("glGetTransformFeedbackiv");
+		return;
+	}
+	glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_lazy_load("glGetTransformFeedbacki_v");
+	if(glad_glGetTransformFeedbacki_v == NULL) {
+		glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+		glad_lazy_missing("glGetTransformFeedbacki_v");
+		return;
+	}
+	glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_lazy_load("glGetTransformFeedbacki64_v");
+	if(glad_glGetTransformFeedbacki64_v == NULL) {
+		glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+		glad_lazy_missing("glGetTransformFeedbacki64_v");
+		return;
+	}
+	glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glad_lazy_load("glCreateBuffers");
+	if(glad_glCreateBuffers == NULL) {
+		glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+		glad_lazy_missing("glCreateBuffers");
+		return;
+	}
+	glad_glCreateBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_load("glNamedBufferStorage");
+	if(glad_glNamedBufferStorage == NULL) {
+		glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+		glad_lazy_missing("glNamedBufferStorage");
+		return;
+	}
+	glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glad_lazy_load("glNamedBufferData");
+	if(glad_glNamedBufferData == NULL) {
+		glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+		glad_lazy_missing("glNamedBufferData");
+		return;
+	}
+	glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glNamedBufferSubData");
+	if(glad_glNamedBufferSubData == NULL) {
+		glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+		glad_lazy_missing("glNamedBufferSubData");
+		return;
+	}
+	glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glCopyNamedBufferSubData");
+	if(glad_glCopyNamedBufferSubData == NULL) {
+		glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+		glad_lazy_missing("glCopyNamedBufferSubData");
+		return;
+	}
+	glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glad_lazy_load("glClearNamedBufferData");
+	if(glad_glClearNamedBufferData == NULL) {
+		glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+		glad_lazy_missing("glClearNamedBufferData");
+		return;
+	}
+	glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glClearNamedBufferSubData");
+	if(glad_glClearNamedBufferSubData == NULL) {
+		glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+		glad_lazy_missing("glClearNamedBufferSubData");
+		return;
+	}
+	glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void *APIENTRY glad_lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glad_lazy_load("glMapNamedBuffer");
+	if(glad_glMapNamedBuffer == NULL) {
+		glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+		glad_lazy_missing("glMapNamedBuffer");
+		return (void *)0;
+	}
+	return glad_glMapNamedBuffer(buffer, access);
+}
+static void *APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_load("glMapNamedBufferRange");
+	if(glad_glMapNamedBufferRange == NULL) {
+		glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+		glad_lazy_missing("glMapNamedBufferRange");
+		return (void *)0;
+	}
+	return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) {
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_load("glUnmapNamedBuffer");
+	if(glad_glUnmapNamedBuffer == NULL) {
+		glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+		glad_lazy_missing("glUnmapNamedBuffer");
+		return (GLboolean)0;
+	}
+	return glad_glUnmapNamedBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_lazy_load("glFlushMappedNamedBufferRange");
+	if(glad_glFlushMappedNamedBufferRange == NULL) {
+		glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+		glad_lazy_missing("glFlushMappedNamedBufferRange");
+		return;
+	}
+	glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedBufferParameteriv");
+	if(glad_glGetNamedBufferParameteriv == NULL) {
+		glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+		glad_lazy_missing("glGetNamedBufferParameteriv");
+		return;
+	}
+	glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_lazy_load("glGetNamedBufferParameteri64v");
+	if(glad_glGetNamedBufferParameteri64v == NULL) {
+		glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+		glad_lazy_missing("glGetNamedBufferParameteri64v");
+		return;
+	}
+	glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_lazy_load("glGetNamedBufferPointerv");
+	if(glad_glGetNamedBufferPointerv == NULL) {
+		glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+		glad_lazy_missing("glGetNamedBufferPointerv");
+		return;
+	}
+	glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glGetNamedBufferSubData");
+	if(glad_glGetNamedBufferSubData == NULL) {
+		glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+		glad_lazy_missing("glGetNamedBufferSubData");
+		return;
+	}
+	glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glad_lazy_load("glCreateFramebuffers");
+	if(glad_glCreateFramebuffers == NULL) {
+		glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+		glad_lazy_missing("glCreateFramebuffers");
+		return;
+	}
+	glad_glCreateFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_load("glNamedFramebufferRenderbuffer");
+	if(glad_glNamedFramebufferRenderbuffer == NULL) {
+		glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+		glad_lazy_missing("glNamedFramebufferRenderbuffer");
+		return;
+	}
+	glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_lazy_load("glNamedFramebufferParameteri");
+	if(glad_glNamedFramebufferParameteri == NULL) {
+		glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+		glad_lazy_missing("glNamedFramebufferParameteri");
+		return;
+	}
+	glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_lazy_load("glNamedFramebufferTexture");
+	if(glad_glNamedFramebufferTexture == NULL) {
+		glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+		glad_lazy_missing("glNamedFramebufferTexture");
+		return;
+	}
+	glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_load("glNamedFramebufferTextureLayer");
+	if(glad_glNamedFramebufferTextureLayer == NULL) {
+		glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+		glad_lazy_missing("glNamedFramebufferTextureLayer");
+		return;
+	}
+	glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_lazy_load("glNamedFramebufferDrawBuffer");
+	if(glad_glNamedFramebufferDrawBuffer == NULL) {
+		glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+		glad_lazy_missing("glNamedFramebufferDrawBuffer");
+		return;
+	}
+	glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_lazy_load("glNamedFramebufferDrawBuffers");
+	if(glad_glNamedFramebufferDrawBuffers == NULL) {
+		glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+		glad_lazy_missing("glNamedFramebufferDrawBuffers");
+		return;
+	}
+	glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_lazy_load("glNamedFramebufferReadBuffer");
+	if(glad_glNamedFramebufferReadBuffer == NULL) {
+		glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+		glad_lazy_missing("glNamedFramebufferReadBuffer");
+		return;
+	}
+	glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_lazy_load("glInvalidateNamedFramebufferData");
+	if(glad_glInvalidateNamedFramebufferData == NULL) {
+		glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+		glad_lazy_missing("glInvalidateNamedFramebufferData");
+		return;
+	}
+	glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_lazy_load("glInvalidateNamedFramebufferSubData");
+	if(glad_glInvalidateNamedFramebufferSubData == NULL) {
+		glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+		glad_lazy_missing("glInvalidateNamedFramebufferSubData");
+		return;
+	}
+	glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_lazy_load("glClearNamedFramebufferiv");
+	if(glad_glClearNamedFramebufferiv == NULL) {
+		glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+		glad_lazy_missing("glClearNamedFramebufferiv");
+		return;
+	}
+	glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_lazy_load("glClearNamedFramebufferuiv");
+	if(glad_glClearNamedFramebufferuiv == NULL) {
+		glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+		glad_lazy_missing("glClearNamedFramebufferuiv");
+		return;
+	}
+	glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_lazy_load("glClearNamedFramebufferfv");
+	if(glad_glClearNamedFramebufferfv == NULL) {
+		glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+		glad_lazy_missing("glClearNamedFramebufferfv");
+		return;
+	}
+	glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_lazy_load("glClearNamedFramebufferfi");
+	if(glad_glClearNamedFramebufferfi == NULL) {
+		glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+		glad_lazy_missing("glClearNamedFramebufferfi");
+		return;
+	}
+	glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_lazy_load("glBlitNamedFramebuffer");
+	if(glad_glBlitNamedFramebuffer == NULL) {
+		glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+		glad_lazy_missing("glBlitNamedFramebuffer");
+		return;
+	}
+	glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_lazy_load("glCheckNamedFramebufferStatus");
+	if(glad_glCheckNamedFramebufferStatus == NULL) {
+		glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+		glad_lazy_missing("glCheckNamedFramebufferStatus");
+		return (GLenum)0;
+	}
+	return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedFramebufferParameteriv");
+	if(glad_glGetNamedFramebufferParameteriv == NULL) {
+		glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+		glad_lazy_missing("glGetNamedFramebufferParameteriv");
+		return;
+	}
+	glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_load("glGetNamedFramebufferAttachmentParameteriv");
+	if(glad_glGetNamedFramebufferAttachmentParameteriv == NULL) {
+		glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+		glad_lazy_missing("glGetNamedFramebufferAttachmentParameteriv");
+		return;
+	}
+	glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glad_lazy_load("glCreateRenderbuffers");
+	if(glad_glCreateRenderbuffers == NULL) {
+		glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+		glad_lazy_missing("glCreateRenderbuffers");
+		return;
+	}
+	glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_lazy_load("glNamedRenderbufferStorage");
+	if(glad_glNamedRenderbufferStorage == NULL) {
+		glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+		glad_lazy_missing("glNamedRenderbufferStorage");
+		return;
+	}
+	glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_load("glNamedRenderbufferStorageMultisample");
+	if(glad_glNamedRenderbufferStorageMultisample == NULL) {
+		glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+		glad_lazy_missing("glNamedRenderbufferStorageMultisample");
+		return;
+	}
+	glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedRenderbufferParameteriv");
+	if(glad_glGetNamedRenderbufferParameteriv == NULL) {
+		glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+		glad_lazy_missing("glGetNamedRenderbufferParameteriv");
+		return;
+	}
+	glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)glad_lazy_load("glCreateTextures");
+	if(glad_glCreateTextures == NULL) {
+		glad_glCreateTextures = glad_lazy_glCreateTextures;
+		glad_lazy_missing("glCreateTextures");
+		return;
+	}
+	glad_glCreateTextures(target, n, textures);
+}
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glad_lazy_load("glTextureBuffer");
+	if(glad_glTextureBuffer == NULL) {
+		glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+		glad_lazy_missing("glTextureBuffer");
+		return;
+	}
+	glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glad_lazy_load("glTextureBufferRange");
+	if(glad_glTextureBufferRange == NULL) {
+		glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+		glad_lazy_missing("glTextureBufferRange");
+		return;
+	}
+	glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glad_lazy_load("glTextureStorage1D");
+	if(glad_glTextureStorage1D == NULL) {
+		glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+		glad_lazy_missing("glTextureStorage1D");
+		return;
+	}
+	glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glad_lazy_load("glTextureStorage2D");
+	if(glad_glTextureStorage2D == NULL) {
+		glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+		glad_lazy_missing("glTextureStorage2D");
+		return;
+	}
+	glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glad_lazy_load("glTextureStorage3D");
+	if(glad_glTextureStorage3D == NULL) {
+		glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+		glad_lazy_missing("glTextureStorage3D");
+		return;
+	}
+	glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_lazy_load("glTextureStorage2DMultisample");
+	if(glad_glTextureStorage2DMultisample == NULL) {
+		glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+		glad_lazy_missing("glTextureStorage2DMultisample");
+		return;
+	}
+	glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_lazy_load("glTextureStorage3DMultisample");
+	if(glad_glTextureStorage3DMultisample == NULL) {
+		glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+		glad_lazy_missing("glTextureStorage3DMultisample");
+		return;
+	}
+	glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glad_lazy_load("glTextureSubImage1D");
+	if(glad_glTextureSubImage1D == NULL) {
+		glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+		glad_lazy_missing("glTextureSubImage1D");
+		return;
+	}
+	glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_load("glTextureSubImage2D");
+	if(glad_glTextureSubImage2D == NULL) {
+		glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+		glad_lazy_missing("glTextureSubImage2D");
+		return;
+	}
+	glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glad_lazy_load("glTextureSubImage3D");
+	if(glad_glTextureSubImage3D == NULL) {
+		glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+		glad_lazy_missing("glTextureSubImage3D");
+		return;
+	}
+	glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_lazy_load("glCompressedTextureSubImage1D");
+	if(glad_glCompressedTextureSubImage1D == NULL) {
+		glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+		glad_lazy_missing("glCompressedTextureSubImage1D");
+		return;
+	}
+	glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_lazy_load("glCompressedTextureSubImage2D");
+	if(glad_glCompressedTextureSubImage2D == NULL) {
+		glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+		glad_lazy_missing("glCompressedTextureSubImage2D");
+		return;
+	}
+	glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_lazy_load("glCompressedTextureSubImage3D");
+	if(glad_glCompressedTextureSubImage3D == NULL) {
+		glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+		glad_lazy_missing("glCompressedTextureSubImage3D");
+		return;
+	}
+	glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_lazy_load("glCopyTextureSubImage1D");
+	if(glad_glCopyTextureSubImage1D == NULL) {
+		glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+		glad_lazy_missing("glCopyTextureSubImage1D");
+		return;
+	}
+	glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_lazy_load("glCopyTextureSubImage2D");
+	if(glad_glCopyTextureSubImage2D == NULL) {
+		glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+		glad_lazy_missing("glCopyTextureSubImage2D");
+		return;
+	}
+	glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_lazy_load("glCopyTextureSubImage3D");
+	if(glad_glCopyTextureSubImage3D == NULL) {
+		glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+		glad_lazy_missing("glCopyTextureSubImage3D");
+		return;
+	}
+	glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glad_lazy_load("glTextureParameterf");
+	if(glad_glTextureParameterf == NULL) {
+		glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+		glad_lazy_missing("glTextureParameterf");
+		return;
+	}
+	glad_glTextureParameterf(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glad_lazy_load("glTextureParameterfv");
+	if(glad_glTextureParameterfv == NULL) {
+		glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+		glad_lazy_missing("glTextureParameterfv");
+		return;
+	}
+	glad_glTextureParameterfv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glad_lazy_load("glTextureParameteri");
+	if(glad_glTextureParameteri == NULL) {
+		glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+		glad_lazy_missing("glTextureParameteri");
+		return;
+	}
+	glad_glTextureParameteri(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glad_lazy_load("glTextureParameterIiv");
+	if(glad_glTextureParameterIiv == NULL) {
+		glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+		glad_lazy_missing("glTextureParameterIiv");
+		return;
+	}
+	glad_glTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glad_lazy_load("glTextureParameterIuiv");
+	if(glad_glTextureParameterIuiv == NULL) {
+		glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+		glad_lazy_missing("glTextureParameterIuiv");
+		return;
+	}
+	glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glad_lazy_load("glTextureParameteriv");
+	if(glad_glTextureParameteriv == NULL) {
+		glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+		glad_lazy_missing("glTextureParameteriv");
+		return;
+	}
+	glad_glTextureParameteriv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) {
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_load("glGenerateTextureMipmap");
+	if(glad_glGenerateTextureMipmap == NULL) {
+		glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+		glad_lazy_missing("glGenerateTextureMipmap");
+		return;
+	}
+	glad_glGenerateTextureMipmap(texture);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glad_lazy_load("glBindTextureUnit");
+	if(glad_glBindTextureUnit == NULL) {
+		glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+		glad_lazy_missing("glBindTextureUnit");
+		return;
+	}
+	glad_glBindTextureUnit(unit, texture);
+}
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glad_lazy_load("glGetTextureImage");
+	if(glad_glGetTextureImage == NULL) {
+		glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+		glad_lazy_missing("glGetTextureImage");
+		return;
+	}
+	glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_lazy_load("glGetCompressedTextureImage");
+	if(glad_glGetCompressedTextureImage == NULL) {
+		glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+		glad_lazy_missing("glGetCompressedTextureImage");
+		return;
+	}
+	glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_lazy_load("glGetTextureLevelParameterfv");
+	if(glad_glGetTextureLevelParameterfv == NULL) {
+		glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+		glad_lazy_missing("glGetTextureLevelParameterfv");
+		return;
+	}
+	glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_lazy_load("glGetTextureLevelParameteriv");
+	if(glad_glGetTextureLevelParameteriv == NULL) {
+		glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+		glad_lazy_missing("glGetTextureLevelParameteriv");
+		return;
+	}
+	glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glad_lazy_load("glGetTextureParameterfv");
+	if(glad_glGetTextureParameterfv == NULL) {
+		glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+		glad_lazy_missing("glGetTextureParameterfv");
+		return;
+	}
+	glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glad_lazy_load("glGetTextureParameterIiv");
+	if(glad_glGetTextureParameterIiv == NULL) {
+		glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+		glad_lazy_missing("glGetTextureParameterIiv");
+		return;
+	}
+	glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_lazy_load("glGetTextureParameterIuiv");
+	if(glad_glGetTextureParameterIuiv == NULL) {
+		glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+		glad_lazy_missing("glGetTextureParameterIuiv");
+		return;
+	}
+	glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glad_lazy_load("glGetTextureParameteriv");
+	if(glad_glGetTextureParameteriv == NULL) {
+		glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+		glad_lazy_missing("glGetTextureParameteriv");
+		return;
+	}
+	glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glad_lazy_load("glCreateVertexArrays");
+	if(glad_glCreateVertexArrays == NULL) {
+		glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+		glad_lazy_missing("glCreateVertexArrays");
+		return;
+	}
+	glad_glCreateVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_lazy_load("glDisableVertexArrayAttrib");
+	if(glad_glDisableVertexArrayAttrib == NULL) {
+		glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+		glad_lazy_missing("glDisableVertexArrayAttrib");
+		return;
+	}
+	glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_lazy_load("glEnableVertexArrayAttrib");
+	if(glad_glEnableVertexArrayAttrib == NULL) {
+		glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+		glad_lazy_missing("glEnableVertexArrayAttrib");
+		return;
+	}
+	glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_lazy_load("glVertexArrayElementBuffer");
+	if(glad_glVertexArrayElementBuffer == NULL) {
+		glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+		glad_lazy_missing("glVertexArrayElementBuffer");
+		return;
+	}
+	glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_lazy_load("glVertexArrayVertexBuffer");
+	if(glad_glVertexArrayVertexBuffer == NULL) {
+		glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+		glad_lazy_missing("glVertexArrayVertexBuffer");
+		return;
+	}
+	glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_lazy_load("glVertexArrayVertexBuffers");
+	if(glad_glVertexArrayVertexBuffers == NULL) {
+		glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+		glad_lazy_missing("glVertexArrayVertexBuffers");
+		return;
+	}
+	glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_lazy_load("glVertexArrayAttribBinding");
+	if(glad_glVertexArrayAttribBinding == NULL) {
+		glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+		glad_lazy_missing("glVertexArrayAttribBinding");
+		return;
+	}
+	glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_lazy_load("glVertexArrayAttribFormat");
+	if(glad_glVertexArrayAttribFormat == NULL) {
+		glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+		glad_lazy_missing("glVertexArrayAttribFormat");
+		return;
+	}
+	glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_lazy_load("glVertexArrayAttribIFormat");
+	if(glad_glVertexArrayAttribIFormat == NULL) {
+		glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+		glad_lazy_missing("glVertexArrayAttribIFormat");
+		return;
+	}
+	glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_lazy_load("glVertexArrayAttribLFormat");
+	if(glad_glVertexArrayAttribLFormat == NULL) {
+		glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+		glad_lazy_missing("glVertexArrayAttribLFormat");
+		return;
+	}
+	glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_lazy_load("glVertexArrayBindingDivisor");
+	if(glad_glVertexArrayBindingDivisor == NULL) {
+		glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+		glad_lazy_missing("glVertexArrayBindingDivisor");
+		return;
+	}
+	glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glad_lazy_load("glGetVertexArrayiv");
+	if(glad_glGetVertexArrayiv == NULL) {
+		glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+		glad_lazy_missing("glGetVertexArrayiv");
+		return;
+	}
+	glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_lazy_load("glGetVertexArrayIndexediv");
+	if(glad_glGetVertexArrayIndexediv == NULL) {
+		glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+		glad_lazy_missing("glGetVertexArrayIndexediv");
+		return;
+	}
+	glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_lazy_load("glGetVertexArrayIndexed64iv");
+	if(glad_glGetVertexArrayIndexed64iv == NULL) {
+		glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+		glad_lazy_missing("glGetVertexArrayIndexed64iv");
+		return;
+	}
+	glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glad_lazy_load("glCreateSamplers");
+	if(glad_glCreateSamplers == NULL) {
+		glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+		glad_lazy_missing("glCreateSamplers");
+		return;
+	}
+	glad_glCreateSamplers(n, samplers);
+}
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glad_lazy_load("glCreateProgramPipelines");
+	if(glad_glCreateProgramPipelines == NULL) {
+		glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+		glad_lazy_missing("glCreateProgramPipelines");
+		return;
+	}
+	glad_glCreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)glad_lazy_load("glCreateQueries");
+	if(glad_glCreateQueries == NULL) {
+		glad_glCreateQueries = glad_lazy_glCreateQueries;
+		glad_lazy_missing("glCreateQueries");
+		return;
+	}
+	glad_glCreateQueries(target, n, ids);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_lazy_load("glGetQueryBufferObjecti64v");
+	if(glad_glGetQueryBufferObjecti64v == NULL) {
+		glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+		glad_lazy_missing("glGetQueryBufferObjecti64v");
+		return;
+	}
+	glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_lazy_load("glGetQueryBufferObjectiv");
+	if(glad_glGetQueryBufferObjectiv == NULL) {
+		glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+		glad_lazy_missing("glGetQueryBufferObjectiv");
+		return;
+	}
+	glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_lazy_load("glGetQueryBufferObjectui64v");
+	if(glad_glGetQueryBufferObjectui64v == NULL) {
+		glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+		glad_lazy_missing("glGetQueryBufferObjectui64v");
+		return;
+	}
+	glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_lazy_load("glGetQueryBufferObjectuiv");
+	if(glad_glGetQueryBufferObjectuiv == NULL) {
+		glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+		glad_lazy_missing("glGetQueryBufferObjectuiv");
+		return;
+	}
+	glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glMemoryBarrierByRegion(GLbitfield barriers) {
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)glad_lazy_load("glMemoryBarrierByRegion");
+	if(glad_glMemoryBarrierByRegion == NULL) {
+		glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+		glad_lazy_missing("glMemoryBarrierByRegion");
+		return;
+	}
+	glad_glMemoryBarrierByRegion(barriers);
+}
+static void APIENTRY glad_lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)glad_lazy_load("glGetTextureSubImage");
+	if(glad_glGetTextureSubImage == NULL) {
+		glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+		glad_lazy_missing("glGetTextureSubImage");
+		return;
+	}
+	glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_lazy_load("glGetCompressedTextureSubImage");
+	if(glad_glGetCompressedTextureSubImage == NULL) {
+		glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+		glad_lazy_missing("glGetCompressedTextureSubImage");
+		return;
+	}
+	glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLenum APIENTRY glad_lazy_glGetGraphicsResetStatus(void) {
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)glad_lazy_load("glGetGraphicsResetStatus");
+	if(glad_glGetGraphicsResetStatus == NULL) {
+		glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+		glad_lazy_missing("glGetGraphicsResetStatus");
+		return (GLenum)0;
+	}
+	return glad_glGetGraphicsResetStatus();
+}
+static void APIENTRY glad_lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_lazy_load("glGetnCompressedTexImage");
+	if(glad_glGetnCompressedTexImage == NULL) {
+		glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+		glad_lazy_missing("glGetnCompressedTexImage");
+		return;
+	}
+	glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)glad_lazy_load("glGetnTexImage");
+	if(glad_glGetnTexImage == NULL) {
+		glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+		glad_lazy_missing("glGetnTexImage");
+		return;
+	}
+	glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)glad_lazy_load("glGetnUniformdv");
+	if(glad_glGetnUniformdv == NULL) {
+		glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+		glad_lazy_missing("glGetnUniformdv");
+		return;
+	}
+	glad_glGetnUniformdv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)glad_lazy_load("glGetnUniformfv");
+	if(glad_glGetnUniformfv == NULL) {
+		glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+		glad_lazy_missing("glGetnUniformfv");
+		return;
+	}
+	glad_glGetnUniformfv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)glad_lazy_load("glGetnUniformiv");
+	if(glad_glGetnUniformiv == NULL) {
+		glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+		glad_lazy_missing("glGetnUniformiv");
+		return;
+	}
+	glad_glGetnUniformiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)glad_lazy_load("glGetnUniformuiv");
+	if(glad_glGetnUniformuiv == NULL) {
+		glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+		glad_lazy_missing("glGetnUniformuiv");
+		return;
+	}
+	glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)glad_lazy_load("glReadnPixels");
+	if(glad_glReadnPixels == NULL) {
+		glad_glReadnPixels = glad_lazy_glReadnPixels;
+		glad_lazy_missing("glReadnPixels");
+		return;
+	}
+	glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY glad_lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)glad_lazy_load("glGetnMapdv");
+	if(glad_glGetnMapdv == NULL) {
+		glad_glGetnMapdv = glad_lazy_glGetnMapdv;
+		glad_lazy_missing("glGetnMapdv");
+		return;
+	}
+	glad_glGetnMapdv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)glad_lazy_load("glGetnMapfv");
+	if(glad_glGetnMapfv == NULL) {
+		glad_glGetnMapfv = glad_lazy_glGetnMapfv;
+		glad_lazy_missing("glGetnMapfv");
+		return;
+	}
+	glad_glGetnMapfv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)glad_lazy_load("glGetnMapiv");
+	if(glad_glGetnMapiv == NULL) {
+		glad_glGetnMapiv = glad_lazy_glGetnMapiv;
+		glad_lazy_missing("glGetnMapiv");
+		return;
+	}
+	glad_glGetnMapiv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)glad_lazy_load("glGetnPixelMapfv");
+	if(glad_glGetnPixelMapfv == NULL) {
+		glad_glGetnPixelMapfv = glad_lazy_glGetnPixelMapfv;
+		glad_lazy_missing("glGetnPixelMapfv");
+		return;
+	}
+	glad_glGetnPixelMapfv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)glad_lazy_load("glGetnPixelMapuiv");
+	if(glad_glGetnPixelMapuiv == NULL) {
+		glad_glGetnPixelMapuiv = glad_lazy_glGetnPixelMapuiv;
+		glad_lazy_missing("glGetnPixelMapuiv");
+		return;
+	}
+	glad_glGetnPixelMapuiv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)glad_lazy_load("glGetnPixelMapusv");
+	if(glad_glGetnPixelMapusv == NULL) {
+		glad_glGetnPixelMapusv = glad_lazy_glGetnPixelMapusv;
+		glad_lazy_missing("glGetnPixelMapusv");
+		return;
+	}
+	glad_glGetnPixelMapusv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)glad_lazy_load("glGetnPolygonStipple");
+	if(glad_glGetnPolygonStipple == NULL) {
+		glad_glGetnPolygonStipple = glad_lazy_glGetnPolygonStipple;
+		glad_lazy_missing("glGetnPolygonStipple");
+		return;
+	}
+	glad_glGetnPolygonStipple(bufSize, pattern);
+}
+static void APIENTRY glad_lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)glad_lazy_load("glGetnColorTable");
+	if(glad_glGetnColorTable == NULL) {
+		glad_glGetnColorTable = glad_lazy_glGetnColorTable;
+		glad_lazy_missing("glGetnColorTable");
+		return;
+	}
+	glad_glGetnColorTable(target, format, type, bufSize, table);
+}
+static void APIENTRY glad_lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)glad_lazy_load("glGetnConvolutionFilter");
+	if(glad_glGetnConvolutionFilter == NULL) {
+		glad_glGetnConvolutionFilter = glad_lazy_glGetnConvolutionFilter;
+		glad_lazy_missing("glGetnConvolutionFilter");
+		return;
+	}
+	glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+}
+static void APIENTRY glad_lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)glad_lazy_load("glGetnSeparableFilter");
+	if(glad_glGetnSeparableFilter == NULL) {
+		glad_glGetnSeparableFilter = glad_lazy_glGetnSeparableFilter;
+		glad_lazy_missing("glGetnSeparableFilter");
+		return;
+	}
+	glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY glad_lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)glad_lazy_load("glGetnHistogram");
+	if(glad_glGetnHistogram == NULL) {
+		glad_glGetnHistogram = glad_lazy_glGetnHistogram;
+		glad_lazy_missing("glGetnHistogram");
+		return;
+	}
+	glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)glad_lazy_load("glGetnMinmax");
+	if(glad_glGetnMinmax == NULL) {
+		glad_glGetnMinmax = glad_lazy_glGetnMinmax;
+		glad_lazy_missing("glGetnMinmax");
+		return;
+	}
+	glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_lazy_glTextureBarrier(void) {
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)glad_lazy_load("glTextureBarrier");
+	if(glad_glTextureBarrier == NULL) {
+		glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+		glad_lazy_missing("glTextureBarrier");
+		return;
+	}
+	glad_glTextureBarrier();
+}
+static void APIENTRY glad_lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)glad_lazy_load("glSpecializeShader");
+	if(glad_glSpecializeShader == NULL) {
+		glad_glSpecializeShader = glad_lazy_glSpecializeShader;
+		glad_lazy_missing("glSpecializeShader");
+		return;
+	}
+	glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glad_lazy_load("glMultiDrawArraysIndirectCount");
+	if(glad_glMultiDrawArraysIndirectCount == NULL) {
+		glad_glMultiDrawArraysIndirectCount = glad_lazy_glMultiDrawArraysIndirectCount;
+		glad_lazy_missing("glMultiDrawArraysIndirectCount");
+		return;
+	}
+	glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glad_lazy_load("glMultiDrawElementsIndirectCount");
+	if(glad_glMultiDrawElementsIndirectCount == NULL) {
+		glad_glMultiDrawElementsIndirectCount = glad_lazy_glMultiDrawElementsIndirectCount;
+		glad_lazy_missing("glMultiDrawElementsIndirectCount");
+		return;
+	}
+	glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)glad_lazy_load("glPolygonOffsetClamp");
+	if(glad_glPolygonOffsetClamp == NULL) {
+		glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+		glad_lazy_missing("glPolygonOffsetClamp");
+		return;
+	}
+	glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+	glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = glad_lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+	glad_glUniform1d = glad_lazy_glUniform1d;
+	glad_glUniform2d = glad_lazy_glUniform2d;
+	glad_glUniform3d = glad_lazy_glUniform3d;
+	glad_glUniform4d = glad_lazy_glUniform4d;
+	glad_glUniform1dv = glad_lazy_glUniform1dv;
+	glad_glUniform2dv = glad_lazy_glUniform2dv;
+	glad_glUniform3dv = glad_lazy_glUniform3dv;
+	glad_glUniform4dv = glad_lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+	glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = glad_lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = glad_lazy_glDepthRangef;
+	glad_glClearDepthf = glad_lazy_glClearDepthf;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+	glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+	glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+	glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+	glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+}
+static void lazy_GL_VERSION_4_2(void) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+	glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+	glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+	glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+	glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_VERSION_4_3(void) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = glad_lazy_glClearBufferData;
+	glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+	glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+	glad_glTextureView = glad_lazy_glTextureView;
+	glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_VERSION_4_4(void) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+	glad_glClearTexImage = glad_lazy_glClearTexImage;
+	glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+	glad_glBindTextures = glad_lazy_glBindTextures;
+	glad_glBindSamplers = glad_lazy_glBindSamplers;
+	glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+}
+static void lazy_GL_VERSION_4_5(void) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = glad_lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = glad_lazy_glCreateTextures;
+	glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+	glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+	glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+	glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+	glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = glad_lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+	glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+	glad_glReadnPixels = glad_lazy_glReadnPixels;
+	glad_glGetnMapdv = glad_lazy_glGetnMapdv;
+	glad_glGetnMapfv = glad_lazy_glGetnMapfv;
+	glad_glGetnMapiv = glad_lazy_glGetnMapiv;
+	glad_glGetnPixelMapfv = glad_lazy_glGetnPixelMapfv;
+	glad_glGetnPixelMapuiv = glad_lazy_glGetnPixelMapuiv;
+	glad_glGetnPixelMapusv = glad_lazy_glGetnPixelMapusv;
+	glad_glGetnPolygonStipple = glad_lazy_glGetnPolygonStipple;
+	glad_glGetnColorTable = glad_lazy_glGetnColorTable;
+	glad_glGetnConvolutionFilter = glad_lazy_glGetnConvolutionFilter;
+	glad_glGetnSeparableFilter = glad_lazy_glGetnSeparableFilter;
+	glad_glGetnHistogram = glad_lazy_glGetnHistogram;
+	glad_glGetnMinmax = glad_lazy_glGetnMinmax;
+	glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+}
+static void lazy_GL_VERSION_4_6(void) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = glad_lazy_glSpecializeShader;
+	glad_glMultiDrawArraysIndirectCount = glad_lazy_glMultiDrawArraysIndirectCount;
+	glad_glMultiDrawElementsIndirectCount = glad_lazy_glMultiDrawElementsIndirectCount;
+	glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+}
+#else
+static void load_GL_VERSION_1_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	glad_glHint = (PFNGLHINTPROC)load("glHint");
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	glad_glClear = (PFNGLCLEARPROC)load("glClear");
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
+	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
+	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
+	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
+	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static void load_GL_VERSION_4_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
+}
+static void load_GL_VERSION_4_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
 	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
 	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
 	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
@@ -1395,216 +8452,5964 @@ static void load_GL_VERSION_4_1(GLADloadproc load) {
 	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
 	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
 }
-static void load_GL_VERSION_4_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_2) return;
-	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
-	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
-	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
-	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
-	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
-	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
-	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
-	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
-	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
-	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
-	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
-	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+static void load_GL_VERSION_4_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+}
+static void load_GL_VERSION_4_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_VERSION_4_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+}
+static void load_GL_VERSION_4_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
+	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)load("glGetnMapdv");
+	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)load("glGetnMapfv");
+	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)load("glGetnMapiv");
+	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)load("glGetnPixelMapfv");
+	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)load("glGetnPixelMapuiv");
+	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)load("glGetnPixelMapusv");
+	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)load("glGetnPolygonStipple");
+	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)load("glGetnColorTable");
+	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)load("glGetnConvolutionFilter");
+	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)load("glGetnSeparableFilter");
+	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)load("glGetnHistogram");
+	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)load("glGetnMinmax");
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+}
+static void load_GL_VERSION_4_6(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)load("glSpecializeShader");
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)load("glMultiDrawArraysIndirectCount");
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
+}
+#endif
+/* GLAD_TRACE: after loading, every non-NULL glad_gl* pointer is swapped for a shim
+ * that counts the call and the time spent in the driver before forwarding to the real
+ * entry point. Counters are plain (not atomic), so trace from one GL thread only.
+ * gladTraceEndFrame/gladTraceSummary (glad_trace.h) print and reset them. */
+#ifdef GLAD_TRACE
+#ifdef GLAD_LAZY_LOAD
+#error "GLAD_TRACE and GLAD_LAZY_LOAD cannot be combined: lazy trampolines overwrite the trace shims"
+#endif
+#include <time.h>
+
+#define GLAD_TRACE_FUNCTIONS 699
+#define GLAD_TRACE_BAR_WIDTH 40
+
+struct glad_trace_counter {
+    khronos_uint64_t calls;
+    khronos_uint64_t nanoseconds;
+};
+
+static struct glad_trace_counter glad_trace_frame[GLAD_TRACE_FUNCTIONS];
+static struct glad_trace_counter glad_trace_total[GLAD_TRACE_FUNCTIONS];
+static khronos_uint64_t glad_trace_frames = 0;
+static FILE *glad_trace_out = NULL;
+
+static khronos_uint64_t glad_trace_now(void) {
+    struct timespec ts;
+#ifdef _WIN32
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (khronos_uint64_t)ts.tv_sec * 1000000000u + (khronos_uint64_t)ts.tv_nsec;
+}
+
+static void glad_trace_end(int index, khronos_uint64_t start) {
+    glad_trace_frame[index].calls++;
+    glad_trace_frame[index].nanoseconds += glad_trace_now() - start;
+}
+
+static const char *glad_trace_names[GLAD_TRACE_FUNCTIONS] = {
+	"glActiveShaderProgram",
+	"glActiveTexture",
+	"glAttachShader",
+	"glBeginConditionalRender",
+	"glBeginQuery",
+	"glBeginQueryIndexed",
+	"glBeginTransformFeedback",
+	"glBindAttribLocation",
+	"glBindBuffer",
+	"glBindBufferBase",
+	"glBindBufferRange",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindFragDataLocation",
+	"glBindFragDataLocationIndexed",
+	"glBindFramebuffer",
+	"glBindImageTexture",
+	"glBindImageTextures",
+	"glBindProgramPipeline",
+	"glBindRenderbuffer",
+	"glBindSampler",
+	"glBindSamplers",
+	"glBindTexture",
+	"glBindTextureUnit",
+	"glBindTextures",
+	"glBindTransformFeedback",
+	"glBindVertexArray",
+	"glBindVertexBuffer",
+	"glBindVertexBuffers",
+	"glBlendColor",
+	"glBlendEquation",
+	"glBlendEquationSeparate",
+	"glBlendEquationSeparatei",
+	"glBlendEquationi",
+	"glBlendFunc",
+	"glBlendFuncSeparate",
+	"glBlendFuncSeparatei",
+	"glBlendFunci",
+	"glBlitFramebuffer",
+	"glBlitNamedFramebuffer",
+	"glBufferData",
+	"glBufferStorage",
+	"glBufferSubData",
+	"glCheckFramebufferStatus",
+	"glCheckNamedFramebufferStatus",
+	"glClampColor",
+	"glClear",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glClearBufferfi",
+	"glClearBufferfv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearColor",
+	"glClearDepth",
+	"glClearDepthf",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glClearNamedFramebufferfi",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearStencil",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glClientWaitSync",
+	"glClipControl",
+	"glColorMask",
+	"glColorMaski",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glCompileShader",
+	"glCompressedTexImage1D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage3D",
+	"glCompressedTexSubImage1D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyBufferSubData",
+	"glCopyImageSubData",
+	"glCopyNamedBufferSubData",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glCopyTexSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glCreateBuffers",
+	"glCreateFramebuffers",
+	"glCreateProgram",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glCreateRenderbuffers",
+	"glCreateSamplers",
+	"glCreateShader",
+	"glCreateShaderProgramv",
+	"glCreateTextures",
+	"glCreateTransformFeedbacks",
+	"glCreateVertexArrays",
+	"glCullFace",
+	"glDebugMessageCallback",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDeleteBuffers",
+	"glDeleteFramebuffers",
+	"glDeleteProgram",
+	"glDeleteProgramPipelines",
+	"glDeleteQueries",
+	"glDeleteRenderbuffers",
+	"glDeleteSamplers",
+	"glDeleteShader",
+	"glDeleteSync",
+	"glDeleteTextures",
+	"glDeleteTransformFeedbacks",
+	"glDeleteVertexArrays",
+	"glDepthFunc",
+	"glDepthMask",
+	"glDepthRange",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glDepthRangef",
+	"glDetachShader",
+	"glDisable",
+	"glDisableVertexArrayAttrib",
+	"glDisableVertexAttribArray",
+	"glDisablei",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glDrawArrays",
+	"glDrawArraysIndirect",
+	"glDrawArraysInstanced",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawBuffer",
+	"glDrawBuffers",
+	"glDrawElements",
+	"glDrawElementsBaseVertex",
+	"glDrawElementsIndirect",
+	"glDrawElementsInstanced",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertex",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glDrawRangeElements",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStream",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glEnable",
+	"glEnableVertexArrayAttrib",
+	"glEnableVertexAttribArray",
+	"glEnablei",
+	"glEndConditionalRender",
+	"glEndQuery",
+	"glEndQueryIndexed",
+	"glEndTransformFeedback",
+	"glFenceSync",
+	"glFinish",
+	"glFlush",
+	"glFlushMappedBufferRange",
+	"glFlushMappedNamedBufferRange",
+	"glFramebufferParameteri",
+	"glFramebufferRenderbuffer",
+	"glFramebufferTexture",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferTextureLayer",
+	"glFrontFace",
+	"glGenBuffers",
+	"glGenFramebuffers",
+	"glGenProgramPipelines",
+	"glGenQueries",
+	"glGenRenderbuffers",
+	"glGenSamplers",
+	"glGenTextures",
+	"glGenTransformFeedbacks",
+	"glGenVertexArrays",
+	"glGenerateMipmap",
+	"glGenerateTextureMipmap",
+	"glGetActiveAtomicCounterBufferiv",
+	"glGetActiveAttrib",
+	"glGetActiveSubroutineName",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveUniform",
+	"glGetActiveUniformBlockName",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformName",
+	"glGetActiveUniformsiv",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetBooleani_v",
+	"glGetBooleanv",
+	"glGetBufferParameteri64v",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glGetBufferSubData",
+	"glGetCompressedTexImage",
+	"glGetCompressedTextureImage",
+	"glGetCompressedTextureSubImage",
+	"glGetDebugMessageLog",
+	"glGetDoublei_v",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloati_v",
+	"glGetFloatv",
+	"glGetFragDataIndex",
+	"glGetFragDataLocation",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGetFramebufferParameteriv",
+	"glGetGraphicsResetStatus",
+	"glGetInteger64i_v",
+	"glGetInteger64v",
+	"glGetIntegeri_v",
+	"glGetIntegerv",
+	"glGetInternalformati64v",
+	"glGetInternalformativ",
+	"glGetMultisamplefv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedRenderbufferParameteriv",
+	"glGetObjectLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glGetProgramBinary",
+	"glGetProgramInfoLog",
+	"glGetProgramInterfaceiv",
+	"glGetProgramPipelineInfoLog",
+	"glGetProgramPipelineiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramStageiv",
+	"glGetProgramiv",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glGetQueryIndexediv",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectui64v",
+	"glGetQueryObjectuiv",
+	"glGetQueryiv",
+	"glGetRenderbufferParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterIuiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameteriv",
+	"glGetShaderInfoLog",
+	"glGetShaderPrecisionFormat",
+	"glGetShaderSource",
+	"glGetShaderiv",
+	"glGetString",
+	"glGetStringi",
+	"glGetSubroutineIndex",
+	"glGetSubroutineUniformLocation",
+	"glGetSynciv",
+	"glGetTexImage",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameteriv",
+	"glGetTextureSubImage",
+	"glGetTransformFeedbackVarying",
+	"glGetTransformFeedbacki64_v",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbackiv",
+	"glGetUniformBlockIndex",
+	"glGetUniformIndices",
+	"glGetUniformLocation",
+	"glGetUniformSubroutineuiv",
+	"glGetUniformdv",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetUniformuiv",
+	"glGetVertexArrayIndexed64iv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayiv",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glGetVertexAttribLdv",
+	"glGetVertexAttribPointerv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetnColorTable",
+	"glGetnCompressedTexImage",
+	"glGetnConvolutionFilter",
+	"glGetnHistogram",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnMinmax",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnSeparableFilter",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glHint",
+	"glInvalidateBufferData",
+	"glInvalidateBufferSubData",
+	"glInvalidateFramebuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glInvalidateSubFramebuffer",
+	"glInvalidateTexImage",
+	"glInvalidateTexSubImage",
+	"glIsBuffer",
+	"glIsEnabled",
+	"glIsEnabledi",
+	"glIsFramebuffer",
+	"glIsProgram",
+	"glIsProgramPipeline",
+	"glIsQuery",
+	"glIsRenderbuffer",
+	"glIsSampler",
+	"glIsShader",
+	"glIsSync",
+	"glIsTexture",
+	"glIsTransformFeedback",
+	"glIsVertexArray",
+	"glLineWidth",
+	"glLinkProgram",
+	"glLogicOp",
+	"glMapBuffer",
+	"glMapBufferRange",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glMemoryBarrier",
+	"glMemoryBarrierByRegion",
+	"glMinSampleShading",
+	"glMultiDrawArrays",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawArraysIndirectCount",
+	"glMultiDrawElements",
+	"glMultiDrawElementsBaseVertex",
+	"glMultiDrawElementsIndirect",
+	"glMultiDrawElementsIndirectCount",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNamedBufferData",
+	"glNamedBufferStorage",
+	"glNamedBufferSubData",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferReadBuffer",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glObjectLabel",
+	"glObjectPtrLabel",
+	"glPatchParameterfv",
+	"glPatchParameteri",
+	"glPauseTransformFeedback",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glPointSize",
+	"glPolygonMode",
+	"glPolygonOffset",
+	"glPolygonOffsetClamp",
+	"glPopDebugGroup",
+	"glPrimitiveRestartIndex",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix4x3dv",
+	"glProgramUniformMatrix4x3fv",
+	"glProvokingVertex",
+	"glPushDebugGroup",
+	"glQueryCounter",
+	"glReadBuffer",
+	"glReadPixels",
+	"glReadnPixels",
+	"glReleaseShaderCompiler",
+	"glRenderbufferStorage",
+	"glRenderbufferStorageMultisample",
+	"glResumeTransformFeedback",
+	"glSampleCoverage",
+	"glSampleMaski",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glScissor",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glShaderBinary",
+	"glShaderSource",
+	"glShaderStorageBlockBinding",
+	"glSpecializeShader",
+	"glStencilFunc",
+	"glStencilFuncSeparate",
+	"glStencilMask",
+	"glStencilMaskSeparate",
+	"glStencilOp",
+	"glStencilOpSeparate",
+	"glTexBuffer",
+	"glTexBufferRange",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glTexImage2DMultisample",
+	"glTexImage3D",
+	"glTexImage3DMultisample",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage2DMultisample",
+	"glTexStorage3D",
+	"glTexStorage3DMultisample",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glTexSubImage3D",
+	"glTextureBarrier",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameteriv",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3D",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glTextureView",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glTransformFeedbackVaryings",
+	"glUniform1d",
+	"glUniform1dv",
+	"glUniform1f",
+	"glUniform1fv",
+	"glUniform1i",
+	"glUniform1iv",
+	"glUniform1ui",
+	"glUniform1uiv",
+	"glUniform2d",
+	"glUniform2dv",
+	"glUniform2f",
+	"glUniform2fv",
+	"glUniform2i",
+	"glUniform2iv",
+	"glUniform2ui",
+	"glUniform2uiv",
+	"glUniform3d",
+	"glUniform3dv",
+	"glUniform3f",
+	"glUniform3fv",
+	"glUniform3i",
+	"glUniform3iv",
+	"glUniform3ui",
+	"glUniform3uiv",
+	"glUniform4d",
+	"glUniform4dv",
+	"glUniform4f",
+	"glUniform4fv",
+	"glUniform4i",
+	"glUniform4iv",
+	"glUniform4ui",
+	"glUniform4uiv",
+	"glUniformBlockBinding",
+	"glUniformMatrix2dv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix4fv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix4x3dv",
+	"glUniformMatrix4x3fv",
+	"glUniformSubroutinesuiv",
+	"glUnmapBuffer",
+	"glUnmapNamedBuffer",
+	"glUseProgram",
+	"glUseProgramStages",
+	"glValidateProgram",
+	"glValidateProgramPipeline",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribBinding",
+	"glVertexAttribDivisor",
+	"glVertexAttribFormat",
+	"glVertexAttribI1i",
+	"glVertexAttribI1iv",
+	"glVertexAttribI1ui",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2i",
+	"glVertexAttribI2iv",
+	"glVertexAttribI2ui",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3i",
+	"glVertexAttribI3iv",
+	"glVertexAttribI3ui",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4i",
+	"glVertexAttribI4iv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4ui",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4usv",
+	"glVertexAttribIFormat",
+	"glVertexAttribIPointer",
+	"glVertexAttribL1d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL2d",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3d",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4d",
+	"glVertexAttribL4dv",
+	"glVertexAttribLFormat",
+	"glVertexAttribLPointer",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexAttribPointer",
+	"glVertexBindingDivisor",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glViewport",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glWaitSync",
+};
+static PFNGLACTIVESHADERPROGRAMPROC glad_trace_next_glActiveShaderProgram = NULL;
+static void APIENTRY glad_trace_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glActiveShaderProgram(pipeline, program);
+	glad_trace_end(0, glad_trace_start);
+}
+static PFNGLACTIVETEXTUREPROC glad_trace_next_glActiveTexture = NULL;
+static void APIENTRY glad_trace_glActiveTexture(GLenum texture) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glActiveTexture(texture);
+	glad_trace_end(1, glad_trace_start);
+}
+static PFNGLATTACHSHADERPROC glad_trace_next_glAttachShader = NULL;
+static void APIENTRY glad_trace_glAttachShader(GLuint program, GLuint shader) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glAttachShader(program, shader);
+	glad_trace_end(2, glad_trace_start);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_trace_next_glBeginConditionalRender = NULL;
+static void APIENTRY glad_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBeginConditionalRender(id, mode);
+	glad_trace_end(3, glad_trace_start);
+}
+static PFNGLBEGINQUERYPROC glad_trace_next_glBeginQuery = NULL;
+static void APIENTRY glad_trace_glBeginQuery(GLenum target, GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBeginQuery(target, id);
+	glad_trace_end(4, glad_trace_start);
+}
+static PFNGLBEGINQUERYINDEXEDPROC glad_trace_next_glBeginQueryIndexed = NULL;
+static void APIENTRY glad_trace_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBeginQueryIndexed(target, index, id);
+	glad_trace_end(5, glad_trace_start);
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_trace_next_glBeginTransformFeedback = NULL;
+static void APIENTRY glad_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBeginTransformFeedback(primitiveMode);
+	glad_trace_end(6, glad_trace_start);
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_trace_next_glBindAttribLocation = NULL;
+static void APIENTRY glad_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindAttribLocation(program, index, name);
+	glad_trace_end(7, glad_trace_start);
+}
+static PFNGLBINDBUFFERPROC glad_trace_next_glBindBuffer = NULL;
+static void APIENTRY glad_trace_glBindBuffer(GLenum target, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindBuffer(target, buffer);
+	glad_trace_end(8, glad_trace_start);
+}
+static PFNGLBINDBUFFERBASEPROC glad_trace_next_glBindBufferBase = NULL;
+static void APIENTRY glad_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindBufferBase(target, index, buffer);
+	glad_trace_end(9, glad_trace_start);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_trace_next_glBindBufferRange = NULL;
+static void APIENTRY glad_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindBufferRange(target, index, buffer, offset, size);
+	glad_trace_end(10, glad_trace_start);
+}
+static PFNGLBINDBUFFERSBASEPROC glad_trace_next_glBindBuffersBase = NULL;
+static void APIENTRY glad_trace_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindBuffersBase(target, first, count, buffers);
+	glad_trace_end(11, glad_trace_start);
+}
+static PFNGLBINDBUFFERSRANGEPROC glad_trace_next_glBindBuffersRange = NULL;
+static void APIENTRY glad_trace_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+	glad_trace_end(12, glad_trace_start);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_trace_next_glBindFragDataLocation = NULL;
+static void APIENTRY glad_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindFragDataLocation(program, color, name);
+	glad_trace_end(13, glad_trace_start);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_trace_next_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY glad_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	glad_trace_end(14, glad_trace_start);
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_trace_next_glBindFramebuffer = NULL;
+static void APIENTRY glad_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindFramebuffer(target, framebuffer);
+	glad_trace_end(15, glad_trace_start);
+}
+static PFNGLBINDIMAGETEXTUREPROC glad_trace_next_glBindImageTexture = NULL;
+static void APIENTRY glad_trace_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	glad_trace_end(16, glad_trace_start);
+}
+static PFNGLBINDIMAGETEXTURESPROC glad_trace_next_glBindImageTextures = NULL;
+static void APIENTRY glad_trace_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindImageTextures(first, count, textures);
+	glad_trace_end(17, glad_trace_start);
+}
+static PFNGLBINDPROGRAMPIPELINEPROC glad_trace_next_glBindProgramPipeline = NULL;
+static void APIENTRY glad_trace_glBindProgramPipeline(GLuint pipeline) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindProgramPipeline(pipeline);
+	glad_trace_end(18, glad_trace_start);
+}
+static PFNGLBINDRENDERBUFFERPROC glad_trace_next_glBindRenderbuffer = NULL;
+static void APIENTRY glad_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindRenderbuffer(target, renderbuffer);
+	glad_trace_end(19, glad_trace_start);
+}
+static PFNGLBINDSAMPLERPROC glad_trace_next_glBindSampler = NULL;
+static void APIENTRY glad_trace_glBindSampler(GLuint unit, GLuint sampler) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindSampler(unit, sampler);
+	glad_trace_end(20, glad_trace_start);
+}
+static PFNGLBINDSAMPLERSPROC glad_trace_next_glBindSamplers = NULL;
+static void APIENTRY glad_trace_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindSamplers(first, count, samplers);
+	glad_trace_end(21, glad_trace_start);
+}
+static PFNGLBINDTEXTUREPROC glad_trace_next_glBindTexture = NULL;
+static void APIENTRY glad_trace_glBindTexture(GLenum target, GLuint texture) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindTexture(target, texture);
+	glad_trace_end(22, glad_trace_start);
+}
+static PFNGLBINDTEXTUREUNITPROC glad_trace_next_glBindTextureUnit = NULL;
+static void APIENTRY glad_trace_glBindTextureUnit(GLuint unit, GLuint texture) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindTextureUnit(unit, texture);
+	glad_trace_end(23, glad_trace_start);
+}
+static PFNGLBINDTEXTURESPROC glad_trace_next_glBindTextures = NULL;
+static void APIENTRY glad_trace_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindTextures(first, count, textures);
+	glad_trace_end(24, glad_trace_start);
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_trace_next_glBindTransformFeedback = NULL;
+static void APIENTRY glad_trace_glBindTransformFeedback(GLenum target, GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindTransformFeedback(target, id);
+	glad_trace_end(25, glad_trace_start);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_trace_next_glBindVertexArray = NULL;
+static void APIENTRY glad_trace_glBindVertexArray(GLuint array) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindVertexArray(array);
+	glad_trace_end(26, glad_trace_start);
+}
+static PFNGLBINDVERTEXBUFFERPROC glad_trace_next_glBindVertexBuffer = NULL;
+static void APIENTRY glad_trace_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+	glad_trace_end(27, glad_trace_start);
+}
+static PFNGLBINDVERTEXBUFFERSPROC glad_trace_next_glBindVertexBuffers = NULL;
+static void APIENTRY glad_trace_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBindVertexBuffers(first, count, buffers, offsets, strides);
+	glad_trace_end(28, glad_trace_start);
+}
+static PFNGLBLENDCOLORPROC glad_trace_next_glBlendColor = NULL;
+static void APIENTRY glad_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendColor(red, green, blue, alpha);
+	glad_trace_end(29, glad_trace_start);
+}
+static PFNGLBLENDEQUATIONPROC glad_trace_next_glBlendEquation = NULL;
+static void APIENTRY glad_trace_glBlendEquation(GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendEquation(mode);
+	glad_trace_end(30, glad_trace_start);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_trace_next_glBlendEquationSeparate = NULL;
+static void APIENTRY glad_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendEquationSeparate(modeRGB, modeAlpha);
+	glad_trace_end(31, glad_trace_start);
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_trace_next_glBlendEquationSeparatei = NULL;
+static void APIENTRY glad_trace_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	glad_trace_end(32, glad_trace_start);
+}
+static PFNGLBLENDEQUATIONIPROC glad_trace_next_glBlendEquationi = NULL;
+static void APIENTRY glad_trace_glBlendEquationi(GLuint buf, GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendEquationi(buf, mode);
+	glad_trace_end(33, glad_trace_start);
+}
+static PFNGLBLENDFUNCPROC glad_trace_next_glBlendFunc = NULL;
+static void APIENTRY glad_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendFunc(sfactor, dfactor);
+	glad_trace_end(34, glad_trace_start);
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_trace_next_glBlendFuncSeparate = NULL;
+static void APIENTRY glad_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	glad_trace_end(35, glad_trace_start);
+}
+static PFNGLBLENDFUNCSEPARATEIPROC glad_trace_next_glBlendFuncSeparatei = NULL;
+static void APIENTRY glad_trace_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	glad_trace_end(36, glad_trace_start);
+}
+static PFNGLBLENDFUNCIPROC glad_trace_next_glBlendFunci = NULL;
+static void APIENTRY glad_trace_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlendFunci(buf, src, dst);
+	glad_trace_end(37, glad_trace_start);
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_trace_next_glBlitFramebuffer = NULL;
+static void APIENTRY glad_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	glad_trace_end(38, glad_trace_start);
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_trace_next_glBlitNamedFramebuffer = NULL;
+static void APIENTRY glad_trace_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	glad_trace_end(39, glad_trace_start);
+}
+static PFNGLBUFFERDATAPROC glad_trace_next_glBufferData = NULL;
+static void APIENTRY glad_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBufferData(target, size, data, usage);
+	glad_trace_end(40, glad_trace_start);
+}
+static PFNGLBUFFERSTORAGEPROC glad_trace_next_glBufferStorage = NULL;
+static void APIENTRY glad_trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBufferStorage(target, size, data, flags);
+	glad_trace_end(41, glad_trace_start);
+}
+static PFNGLBUFFERSUBDATAPROC glad_trace_next_glBufferSubData = NULL;
+static void APIENTRY glad_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glBufferSubData(target, offset, size, data);
+	glad_trace_end(42, glad_trace_start);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_trace_next_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY glad_trace_glCheckFramebufferStatus(GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLenum glad_trace_ret = glad_trace_next_glCheckFramebufferStatus(target);
+	glad_trace_end(43, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_trace_next_glCheckNamedFramebufferStatus = NULL;
+static GLenum APIENTRY glad_trace_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLenum glad_trace_ret = glad_trace_next_glCheckNamedFramebufferStatus(framebuffer, target);
+	glad_trace_end(44, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCLAMPCOLORPROC glad_trace_next_glClampColor = NULL;
+static void APIENTRY glad_trace_glClampColor(GLenum target, GLenum clamp) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClampColor(target, clamp);
+	glad_trace_end(45, glad_trace_start);
+}
+static PFNGLCLEARPROC glad_trace_next_glClear = NULL;
+static void APIENTRY glad_trace_glClear(GLbitfield mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClear(mask);
+	glad_trace_end(46, glad_trace_start);
+}
+static PFNGLCLEARBUFFERDATAPROC glad_trace_next_glClearBufferData = NULL;
+static void APIENTRY glad_trace_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferData(target, internalformat, format, type, data);
+	glad_trace_end(47, glad_trace_start);
+}
+static PFNGLCLEARBUFFERSUBDATAPROC glad_trace_next_glClearBufferSubData = NULL;
+static void APIENTRY glad_trace_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	glad_trace_end(48, glad_trace_start);
+}
+static PFNGLCLEARBUFFERFIPROC glad_trace_next_glClearBufferfi = NULL;
+static void APIENTRY glad_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	glad_trace_end(49, glad_trace_start);
+}
+static PFNGLCLEARBUFFERFVPROC glad_trace_next_glClearBufferfv = NULL;
+static void APIENTRY glad_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferfv(buffer, drawbuffer, value);
+	glad_trace_end(50, glad_trace_start);
+}
+static PFNGLCLEARBUFFERIVPROC glad_trace_next_glClearBufferiv = NULL;
+static void APIENTRY glad_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferiv(buffer, drawbuffer, value);
+	glad_trace_end(51, glad_trace_start);
+}
+static PFNGLCLEARBUFFERUIVPROC glad_trace_next_glClearBufferuiv = NULL;
+static void APIENTRY glad_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearBufferuiv(buffer, drawbuffer, value);
+	glad_trace_end(52, glad_trace_start);
+}
+static PFNGLCLEARCOLORPROC glad_trace_next_glClearColor = NULL;
+static void APIENTRY glad_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearColor(red, green, blue, alpha);
+	glad_trace_end(53, glad_trace_start);
+}
+static PFNGLCLEARDEPTHPROC glad_trace_next_glClearDepth = NULL;
+static void APIENTRY glad_trace_glClearDepth(GLdouble depth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearDepth(depth);
+	glad_trace_end(54, glad_trace_start);
+}
+static PFNGLCLEARDEPTHFPROC glad_trace_next_glClearDepthf = NULL;
+static void APIENTRY glad_trace_glClearDepthf(GLfloat d) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearDepthf(d);
+	glad_trace_end(55, glad_trace_start);
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_trace_next_glClearNamedBufferData = NULL;
+static void APIENTRY glad_trace_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedBufferData(buffer, internalformat, format, type, data);
+	glad_trace_end(56, glad_trace_start);
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_trace_next_glClearNamedBufferSubData = NULL;
+static void APIENTRY glad_trace_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	glad_trace_end(57, glad_trace_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_trace_next_glClearNamedFramebufferfi = NULL;
+static void APIENTRY glad_trace_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	glad_trace_end(58, glad_trace_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_trace_next_glClearNamedFramebufferfv = NULL;
+static void APIENTRY glad_trace_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	glad_trace_end(59, glad_trace_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_trace_next_glClearNamedFramebufferiv = NULL;
+static void APIENTRY glad_trace_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	glad_trace_end(60, glad_trace_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_trace_next_glClearNamedFramebufferuiv = NULL;
+static void APIENTRY glad_trace_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	glad_trace_end(61, glad_trace_start);
+}
+static PFNGLCLEARSTENCILPROC glad_trace_next_glClearStencil = NULL;
+static void APIENTRY glad_trace_glClearStencil(GLint s) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearStencil(s);
+	glad_trace_end(62, glad_trace_start);
+}
+static PFNGLCLEARTEXIMAGEPROC glad_trace_next_glClearTexImage = NULL;
+static void APIENTRY glad_trace_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearTexImage(texture, level, format, type, data);
+	glad_trace_end(63, glad_trace_start);
+}
+static PFNGLCLEARTEXSUBIMAGEPROC glad_trace_next_glClearTexSubImage = NULL;
+static void APIENTRY glad_trace_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	glad_trace_end(64, glad_trace_start);
+}
+static PFNGLCLIENTWAITSYNCPROC glad_trace_next_glClientWaitSync = NULL;
+static GLenum APIENTRY glad_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLenum glad_trace_ret = glad_trace_next_glClientWaitSync(sync, flags, timeout);
+	glad_trace_end(65, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCLIPCONTROLPROC glad_trace_next_glClipControl = NULL;
+static void APIENTRY glad_trace_glClipControl(GLenum origin, GLenum depth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glClipControl(origin, depth);
+	glad_trace_end(66, glad_trace_start);
+}
+static PFNGLCOLORMASKPROC glad_trace_next_glColorMask = NULL;
+static void APIENTRY glad_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorMask(red, green, blue, alpha);
+	glad_trace_end(67, glad_trace_start);
+}
+static PFNGLCOLORMASKIPROC glad_trace_next_glColorMaski = NULL;
+static void APIENTRY glad_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorMaski(index, r, g, b, a);
+	glad_trace_end(68, glad_trace_start);
+}
+static PFNGLCOLORP3UIPROC glad_trace_next_glColorP3ui = NULL;
+static void APIENTRY glad_trace_glColorP3ui(GLenum type, GLuint color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorP3ui(type, color);
+	glad_trace_end(69, glad_trace_start);
+}
+static PFNGLCOLORP3UIVPROC glad_trace_next_glColorP3uiv = NULL;
+static void APIENTRY glad_trace_glColorP3uiv(GLenum type, const GLuint *color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorP3uiv(type, color);
+	glad_trace_end(70, glad_trace_start);
+}
+static PFNGLCOLORP4UIPROC glad_trace_next_glColorP4ui = NULL;
+static void APIENTRY glad_trace_glColorP4ui(GLenum type, GLuint color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorP4ui(type, color);
+	glad_trace_end(71, glad_trace_start);
+}
+static PFNGLCOLORP4UIVPROC glad_trace_next_glColorP4uiv = NULL;
+static void APIENTRY glad_trace_glColorP4uiv(GLenum type, const GLuint *color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glColorP4uiv(type, color);
+	glad_trace_end(72, glad_trace_start);
+}
+static PFNGLCOMPILESHADERPROC glad_trace_next_glCompileShader = NULL;
+static void APIENTRY glad_trace_glCompileShader(GLuint shader) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompileShader(shader);
+	glad_trace_end(73, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_trace_next_glCompressedTexImage1D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	glad_trace_end(74, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_trace_next_glCompressedTexImage2D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	glad_trace_end(75, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_trace_next_glCompressedTexImage3D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	glad_trace_end(76, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_trace_next_glCompressedTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	glad_trace_end(77, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_trace_next_glCompressedTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	glad_trace_end(78, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_trace_next_glCompressedTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	glad_trace_end(79, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_trace_next_glCompressedTextureSubImage1D = NULL;
+static void APIENTRY glad_trace_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	glad_trace_end(80, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_trace_next_glCompressedTextureSubImage2D = NULL;
+static void APIENTRY glad_trace_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	glad_trace_end(81, glad_trace_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_trace_next_glCompressedTextureSubImage3D = NULL;
+static void APIENTRY glad_trace_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	glad_trace_end(82, glad_trace_start);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_trace_next_glCopyBufferSubData = NULL;
+static void APIENTRY glad_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	glad_trace_end(83, glad_trace_start);
+}
+static PFNGLCOPYIMAGESUBDATAPROC glad_trace_next_glCopyImageSubData = NULL;
+static void APIENTRY glad_trace_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	glad_trace_end(84, glad_trace_start);
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_trace_next_glCopyNamedBufferSubData = NULL;
+static void APIENTRY glad_trace_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	glad_trace_end(85, glad_trace_start);
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_trace_next_glCopyTexImage1D = NULL;
+static void APIENTRY glad_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	glad_trace_end(86, glad_trace_start);
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_trace_next_glCopyTexImage2D = NULL;
+static void APIENTRY glad_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	glad_trace_end(87, glad_trace_start);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_trace_next_glCopyTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	glad_trace_end(88, glad_trace_start);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_trace_next_glCopyTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	glad_trace_end(89, glad_trace_start);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_trace_next_glCopyTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	glad_trace_end(90, glad_trace_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_trace_next_glCopyTextureSubImage1D = NULL;
+static void APIENTRY glad_trace_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	glad_trace_end(91, glad_trace_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_trace_next_glCopyTextureSubImage2D = NULL;
+static void APIENTRY glad_trace_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	glad_trace_end(92, glad_trace_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_trace_next_glCopyTextureSubImage3D = NULL;
+static void APIENTRY glad_trace_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	glad_trace_end(93, glad_trace_start);
+}
+static PFNGLCREATEBUFFERSPROC glad_trace_next_glCreateBuffers = NULL;
+static void APIENTRY glad_trace_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateBuffers(n, buffers);
+	glad_trace_end(94, glad_trace_start);
+}
+static PFNGLCREATEFRAMEBUFFERSPROC glad_trace_next_glCreateFramebuffers = NULL;
+static void APIENTRY glad_trace_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateFramebuffers(n, framebuffers);
+	glad_trace_end(95, glad_trace_start);
+}
+static PFNGLCREATEPROGRAMPROC glad_trace_next_glCreateProgram = NULL;
+static GLuint APIENTRY glad_trace_glCreateProgram(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glCreateProgram();
+	glad_trace_end(96, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_trace_next_glCreateProgramPipelines = NULL;
+static void APIENTRY glad_trace_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateProgramPipelines(n, pipelines);
+	glad_trace_end(97, glad_trace_start);
+}
+static PFNGLCREATEQUERIESPROC glad_trace_next_glCreateQueries = NULL;
+static void APIENTRY glad_trace_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateQueries(target, n, ids);
+	glad_trace_end(98, glad_trace_start);
+}
+static PFNGLCREATERENDERBUFFERSPROC glad_trace_next_glCreateRenderbuffers = NULL;
+static void APIENTRY glad_trace_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateRenderbuffers(n, renderbuffers);
+	glad_trace_end(99, glad_trace_start);
+}
+static PFNGLCREATESAMPLERSPROC glad_trace_next_glCreateSamplers = NULL;
+static void APIENTRY glad_trace_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateSamplers(n, samplers);
+	glad_trace_end(100, glad_trace_start);
+}
+static PFNGLCREATESHADERPROC glad_trace_next_glCreateShader = NULL;
+static GLuint APIENTRY glad_trace_glCreateShader(GLenum type) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glCreateShader(type);
+	glad_trace_end(101, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCREATESHADERPROGRAMVPROC glad_trace_next_glCreateShaderProgramv = NULL;
+static GLuint APIENTRY glad_trace_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glCreateShaderProgramv(type, count, strings);
+	glad_trace_end(102, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLCREATETEXTURESPROC glad_trace_next_glCreateTextures = NULL;
+static void APIENTRY glad_trace_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateTextures(target, n, textures);
+	glad_trace_end(103, glad_trace_start);
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_trace_next_glCreateTransformFeedbacks = NULL;
+static void APIENTRY glad_trace_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateTransformFeedbacks(n, ids);
+	glad_trace_end(104, glad_trace_start);
+}
+static PFNGLCREATEVERTEXARRAYSPROC glad_trace_next_glCreateVertexArrays = NULL;
+static void APIENTRY glad_trace_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCreateVertexArrays(n, arrays);
+	glad_trace_end(105, glad_trace_start);
+}
+static PFNGLCULLFACEPROC glad_trace_next_glCullFace = NULL;
+static void APIENTRY glad_trace_glCullFace(GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glCullFace(mode);
+	glad_trace_end(106, glad_trace_start);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_trace_next_glDebugMessageCallback = NULL;
+static void APIENTRY glad_trace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDebugMessageCallback(callback, userParam);
+	glad_trace_end(107, glad_trace_start);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_trace_next_glDebugMessageControl = NULL;
+static void APIENTRY glad_trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	glad_trace_end(108, glad_trace_start);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_trace_next_glDebugMessageInsert = NULL;
+static void APIENTRY glad_trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDebugMessageInsert(source, type, id, severity, length, buf);
+	glad_trace_end(109, glad_trace_start);
+}
+static PFNGLDELETEBUFFERSPROC glad_trace_next_glDeleteBuffers = NULL;
+static void APIENTRY glad_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteBuffers(n, buffers);
+	glad_trace_end(110, glad_trace_start);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_trace_next_glDeleteFramebuffers = NULL;
+static void APIENTRY glad_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteFramebuffers(n, framebuffers);
+	glad_trace_end(111, glad_trace_start);
+}
+static PFNGLDELETEPROGRAMPROC glad_trace_next_glDeleteProgram = NULL;
+static void APIENTRY glad_trace_glDeleteProgram(GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteProgram(program);
+	glad_trace_end(112, glad_trace_start);
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_trace_next_glDeleteProgramPipelines = NULL;
+static void APIENTRY glad_trace_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteProgramPipelines(n, pipelines);
+	glad_trace_end(113, glad_trace_start);
+}
+static PFNGLDELETEQUERIESPROC glad_trace_next_glDeleteQueries = NULL;
+static void APIENTRY glad_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteQueries(n, ids);
+	glad_trace_end(114, glad_trace_start);
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_trace_next_glDeleteRenderbuffers = NULL;
+static void APIENTRY glad_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteRenderbuffers(n, renderbuffers);
+	glad_trace_end(115, glad_trace_start);
+}
+static PFNGLDELETESAMPLERSPROC glad_trace_next_glDeleteSamplers = NULL;
+static void APIENTRY glad_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteSamplers(count, samplers);
+	glad_trace_end(116, glad_trace_start);
+}
+static PFNGLDELETESHADERPROC glad_trace_next_glDeleteShader = NULL;
+static void APIENTRY glad_trace_glDeleteShader(GLuint shader) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteShader(shader);
+	glad_trace_end(117, glad_trace_start);
+}
+static PFNGLDELETESYNCPROC glad_trace_next_glDeleteSync = NULL;
+static void APIENTRY glad_trace_glDeleteSync(GLsync sync) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteSync(sync);
+	glad_trace_end(118, glad_trace_start);
+}
+static PFNGLDELETETEXTURESPROC glad_trace_next_glDeleteTextures = NULL;
+static void APIENTRY glad_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteTextures(n, textures);
+	glad_trace_end(119, glad_trace_start);
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_trace_next_glDeleteTransformFeedbacks = NULL;
+static void APIENTRY glad_trace_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteTransformFeedbacks(n, ids);
+	glad_trace_end(120, glad_trace_start);
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_trace_next_glDeleteVertexArrays = NULL;
+static void APIENTRY glad_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDeleteVertexArrays(n, arrays);
+	glad_trace_end(121, glad_trace_start);
+}
+static PFNGLDEPTHFUNCPROC glad_trace_next_glDepthFunc = NULL;
+static void APIENTRY glad_trace_glDepthFunc(GLenum func) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthFunc(func);
+	glad_trace_end(122, glad_trace_start);
+}
+static PFNGLDEPTHMASKPROC glad_trace_next_glDepthMask = NULL;
+static void APIENTRY glad_trace_glDepthMask(GLboolean flag) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthMask(flag);
+	glad_trace_end(123, glad_trace_start);
+}
+static PFNGLDEPTHRANGEPROC glad_trace_next_glDepthRange = NULL;
+static void APIENTRY glad_trace_glDepthRange(GLdouble n, GLdouble f) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthRange(n, f);
+	glad_trace_end(124, glad_trace_start);
+}
+static PFNGLDEPTHRANGEARRAYVPROC glad_trace_next_glDepthRangeArrayv = NULL;
+static void APIENTRY glad_trace_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthRangeArrayv(first, count, v);
+	glad_trace_end(125, glad_trace_start);
+}
+static PFNGLDEPTHRANGEINDEXEDPROC glad_trace_next_glDepthRangeIndexed = NULL;
+static void APIENTRY glad_trace_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthRangeIndexed(index, n, f);
+	glad_trace_end(126, glad_trace_start);
+}
+static PFNGLDEPTHRANGEFPROC glad_trace_next_glDepthRangef = NULL;
+static void APIENTRY glad_trace_glDepthRangef(GLfloat n, GLfloat f) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDepthRangef(n, f);
+	glad_trace_end(127, glad_trace_start);
+}
+static PFNGLDETACHSHADERPROC glad_trace_next_glDetachShader = NULL;
+static void APIENTRY glad_trace_glDetachShader(GLuint program, GLuint shader) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDetachShader(program, shader);
+	glad_trace_end(128, glad_trace_start);
+}
+static PFNGLDISABLEPROC glad_trace_next_glDisable = NULL;
+static void APIENTRY glad_trace_glDisable(GLenum cap) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDisable(cap);
+	glad_trace_end(129, glad_trace_start);
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_trace_next_glDisableVertexArrayAttrib = NULL;
+static void APIENTRY glad_trace_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDisableVertexArrayAttrib(vaobj, index);
+	glad_trace_end(130, glad_trace_start);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_trace_next_glDisableVertexAttribArray = NULL;
+static void APIENTRY glad_trace_glDisableVertexAttribArray(GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDisableVertexAttribArray(index);
+	glad_trace_end(131, glad_trace_start);
+}
+static PFNGLDISABLEIPROC glad_trace_next_glDisablei = NULL;
+static void APIENTRY glad_trace_glDisablei(GLenum target, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDisablei(target, index);
+	glad_trace_end(132, glad_trace_start);
+}
+static PFNGLDISPATCHCOMPUTEPROC glad_trace_next_glDispatchCompute = NULL;
+static void APIENTRY glad_trace_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	glad_trace_end(133, glad_trace_start);
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_trace_next_glDispatchComputeIndirect = NULL;
+static void APIENTRY glad_trace_glDispatchComputeIndirect(GLintptr indirect) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDispatchComputeIndirect(indirect);
+	glad_trace_end(134, glad_trace_start);
+}
+static PFNGLDRAWARRAYSPROC glad_trace_next_glDrawArrays = NULL;
+static void APIENTRY glad_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawArrays(mode, first, count);
+	glad_trace_end(135, glad_trace_start);
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_trace_next_glDrawArraysIndirect = NULL;
+static void APIENTRY glad_trace_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawArraysIndirect(mode, indirect);
+	glad_trace_end(136, glad_trace_start);
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_trace_next_glDrawArraysInstanced = NULL;
+static void APIENTRY glad_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawArraysInstanced(mode, first, count, instancecount);
+	glad_trace_end(137, glad_trace_start);
+}
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_trace_next_glDrawArraysInstancedBaseInstance = NULL;
+static void APIENTRY glad_trace_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	glad_trace_end(138, glad_trace_start);
+}
+static PFNGLDRAWBUFFERPROC glad_trace_next_glDrawBuffer = NULL;
+static void APIENTRY glad_trace_glDrawBuffer(GLenum buf) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawBuffer(buf);
+	glad_trace_end(139, glad_trace_start);
+}
+static PFNGLDRAWBUFFERSPROC glad_trace_next_glDrawBuffers = NULL;
+static void APIENTRY glad_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawBuffers(n, bufs);
+	glad_trace_end(140, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSPROC glad_trace_next_glDrawElements = NULL;
+static void APIENTRY glad_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElements(mode, count, type, indices);
+	glad_trace_end(141, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	glad_trace_end(142, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_trace_next_glDrawElementsIndirect = NULL;
+static void APIENTRY glad_trace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsIndirect(mode, type, indirect);
+	glad_trace_end(143, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_trace_next_glDrawElementsInstanced = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	glad_trace_end(144, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_trace_next_glDrawElementsInstancedBaseInstance = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	glad_trace_end(145, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_trace_next_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	glad_trace_end(146, glad_trace_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	glad_trace_end(147, glad_trace_start);
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_trace_next_glDrawRangeElements = NULL;
+static void APIENTRY glad_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawRangeElements(mode, start, end, count, type, indices);
+	glad_trace_end(148, glad_trace_start);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_trace_next_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	glad_trace_end(149, glad_trace_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_trace_next_glDrawTransformFeedback = NULL;
+static void APIENTRY glad_trace_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawTransformFeedback(mode, id);
+	glad_trace_end(150, glad_trace_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_trace_next_glDrawTransformFeedbackInstanced = NULL;
+static void APIENTRY glad_trace_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+	glad_trace_end(151, glad_trace_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_trace_next_glDrawTransformFeedbackStream = NULL;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawTransformFeedbackStream(mode, id, stream);
+	glad_trace_end(152, glad_trace_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_trace_next_glDrawTransformFeedbackStreamInstanced = NULL;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	glad_trace_end(153, glad_trace_start);
+}
+static PFNGLENABLEPROC glad_trace_next_glEnable = NULL;
+static void APIENTRY glad_trace_glEnable(GLenum cap) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEnable(cap);
+	glad_trace_end(154, glad_trace_start);
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_trace_next_glEnableVertexArrayAttrib = NULL;
+static void APIENTRY glad_trace_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEnableVertexArrayAttrib(vaobj, index);
+	glad_trace_end(155, glad_trace_start);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_trace_next_glEnableVertexAttribArray = NULL;
+static void APIENTRY glad_trace_glEnableVertexAttribArray(GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEnableVertexAttribArray(index);
+	glad_trace_end(156, glad_trace_start);
+}
+static PFNGLENABLEIPROC glad_trace_next_glEnablei = NULL;
+static void APIENTRY glad_trace_glEnablei(GLenum target, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEnablei(target, index);
+	glad_trace_end(157, glad_trace_start);
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_trace_next_glEndConditionalRender = NULL;
+static void APIENTRY glad_trace_glEndConditionalRender(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEndConditionalRender();
+	glad_trace_end(158, glad_trace_start);
+}
+static PFNGLENDQUERYPROC glad_trace_next_glEndQuery = NULL;
+static void APIENTRY glad_trace_glEndQuery(GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEndQuery(target);
+	glad_trace_end(159, glad_trace_start);
+}
+static PFNGLENDQUERYINDEXEDPROC glad_trace_next_glEndQueryIndexed = NULL;
+static void APIENTRY glad_trace_glEndQueryIndexed(GLenum target, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEndQueryIndexed(target, index);
+	glad_trace_end(160, glad_trace_start);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_trace_next_glEndTransformFeedback = NULL;
+static void APIENTRY glad_trace_glEndTransformFeedback(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glEndTransformFeedback();
+	glad_trace_end(161, glad_trace_start);
+}
+static PFNGLFENCESYNCPROC glad_trace_next_glFenceSync = NULL;
+static GLsync APIENTRY glad_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLsync glad_trace_ret = glad_trace_next_glFenceSync(condition, flags);
+	glad_trace_end(162, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLFINISHPROC glad_trace_next_glFinish = NULL;
+static void APIENTRY glad_trace_glFinish(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFinish();
+	glad_trace_end(163, glad_trace_start);
+}
+static PFNGLFLUSHPROC glad_trace_next_glFlush = NULL;
+static void APIENTRY glad_trace_glFlush(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFlush();
+	glad_trace_end(164, glad_trace_start);
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_trace_next_glFlushMappedBufferRange = NULL;
+static void APIENTRY glad_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFlushMappedBufferRange(target, offset, length);
+	glad_trace_end(165, glad_trace_start);
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_trace_next_glFlushMappedNamedBufferRange = NULL;
+static void APIENTRY glad_trace_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFlushMappedNamedBufferRange(buffer, offset, length);
+	glad_trace_end(166, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_trace_next_glFramebufferParameteri = NULL;
+static void APIENTRY glad_trace_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferParameteri(target, pname, param);
+	glad_trace_end(167, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_trace_next_glFramebufferRenderbuffer = NULL;
+static void APIENTRY glad_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	glad_trace_end(168, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_trace_next_glFramebufferTexture = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferTexture(target, attachment, texture, level);
+	glad_trace_end(169, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_trace_next_glFramebufferTexture1D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	glad_trace_end(170, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_trace_next_glFramebufferTexture2D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	glad_trace_end(171, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_trace_next_glFramebufferTexture3D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	glad_trace_end(172, glad_trace_start);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_trace_next_glFramebufferTextureLayer = NULL;
+static void APIENTRY glad_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	glad_trace_end(173, glad_trace_start);
+}
+static PFNGLFRONTFACEPROC glad_trace_next_glFrontFace = NULL;
+static void APIENTRY glad_trace_glFrontFace(GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glFrontFace(mode);
+	glad_trace_end(174, glad_trace_start);
+}
+static PFNGLGENBUFFERSPROC glad_trace_next_glGenBuffers = NULL;
+static void APIENTRY glad_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenBuffers(n, buffers);
+	glad_trace_end(175, glad_trace_start);
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_trace_next_glGenFramebuffers = NULL;
+static void APIENTRY glad_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenFramebuffers(n, framebuffers);
+	glad_trace_end(176, glad_trace_start);
+}
+static PFNGLGENPROGRAMPIPELINESPROC glad_trace_next_glGenProgramPipelines = NULL;
+static void APIENTRY glad_trace_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenProgramPipelines(n, pipelines);
+	glad_trace_end(177, glad_trace_start);
+}
+static PFNGLGENQUERIESPROC glad_trace_next_glGenQueries = NULL;
+static void APIENTRY glad_trace_glGenQueries(GLsizei n, GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenQueries(n, ids);
+	glad_trace_end(178, glad_trace_start);
+}
+static PFNGLGENRENDERBUFFERSPROC glad_trace_next_glGenRenderbuffers = NULL;
+static void APIENTRY glad_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenRenderbuffers(n, renderbuffers);
+	glad_trace_end(179, glad_trace_start);
+}
+static PFNGLGENSAMPLERSPROC glad_trace_next_glGenSamplers = NULL;
+static void APIENTRY glad_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenSamplers(count, samplers);
+	glad_trace_end(180, glad_trace_start);
+}
+static PFNGLGENTEXTURESPROC glad_trace_next_glGenTextures = NULL;
+static void APIENTRY glad_trace_glGenTextures(GLsizei n, GLuint *textures) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenTextures(n, textures);
+	glad_trace_end(181, glad_trace_start);
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_trace_next_glGenTransformFeedbacks = NULL;
+static void APIENTRY glad_trace_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenTransformFeedbacks(n, ids);
+	glad_trace_end(182, glad_trace_start);
+}
+static PFNGLGENVERTEXARRAYSPROC glad_trace_next_glGenVertexArrays = NULL;
+static void APIENTRY glad_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenVertexArrays(n, arrays);
+	glad_trace_end(183, glad_trace_start);
+}
+static PFNGLGENERATEMIPMAPPROC glad_trace_next_glGenerateMipmap = NULL;
+static void APIENTRY glad_trace_glGenerateMipmap(GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenerateMipmap(target);
+	glad_trace_end(184, glad_trace_start);
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_trace_next_glGenerateTextureMipmap = NULL;
+static void APIENTRY glad_trace_glGenerateTextureMipmap(GLuint texture) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGenerateTextureMipmap(texture);
+	glad_trace_end(185, glad_trace_start);
+}
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_trace_next_glGetActiveAtomicCounterBufferiv = NULL;
+static void APIENTRY glad_trace_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	glad_trace_end(186, glad_trace_start);
+}
+static PFNGLGETACTIVEATTRIBPROC glad_trace_next_glGetActiveAttrib = NULL;
+static void APIENTRY glad_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	glad_trace_end(187, glad_trace_start);
+}
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_trace_next_glGetActiveSubroutineName = NULL;
+static void APIENTRY glad_trace_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+	glad_trace_end(188, glad_trace_start);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_trace_next_glGetActiveSubroutineUniformName = NULL;
+static void APIENTRY glad_trace_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+	glad_trace_end(189, glad_trace_start);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_trace_next_glGetActiveSubroutineUniformiv = NULL;
+static void APIENTRY glad_trace_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	glad_trace_end(190, glad_trace_start);
+}
+static PFNGLGETACTIVEUNIFORMPROC glad_trace_next_glGetActiveUniform = NULL;
+static void APIENTRY glad_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	glad_trace_end(191, glad_trace_start);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_trace_next_glGetActiveUniformBlockName = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	glad_trace_end(192, glad_trace_start);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_trace_next_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	glad_trace_end(193, glad_trace_start);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_trace_next_glGetActiveUniformName = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	glad_trace_end(194, glad_trace_start);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_trace_next_glGetActiveUniformsiv = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	glad_trace_end(195, glad_trace_start);
+}
+static PFNGLGETATTACHEDSHADERSPROC glad_trace_next_glGetAttachedShaders = NULL;
+static void APIENTRY glad_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetAttachedShaders(program, maxCount, count, shaders);
+	glad_trace_end(196, glad_trace_start);
+}
+static PFNGLGETATTRIBLOCATIONPROC glad_trace_next_glGetAttribLocation = NULL;
+static GLint APIENTRY glad_trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetAttribLocation(program, name);
+	glad_trace_end(197, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETBOOLEANI_VPROC glad_trace_next_glGetBooleani_v = NULL;
+static void APIENTRY glad_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBooleani_v(target, index, data);
+	glad_trace_end(198, glad_trace_start);
+}
+static PFNGLGETBOOLEANVPROC glad_trace_next_glGetBooleanv = NULL;
+static void APIENTRY glad_trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBooleanv(pname, data);
+	glad_trace_end(199, glad_trace_start);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_trace_next_glGetBufferParameteri64v = NULL;
+static void APIENTRY glad_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBufferParameteri64v(target, pname, params);
+	glad_trace_end(200, glad_trace_start);
+}
+static PFNGLGETBUFFERPARAMETERIVPROC glad_trace_next_glGetBufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBufferParameteriv(target, pname, params);
+	glad_trace_end(201, glad_trace_start);
+}
+static PFNGLGETBUFFERPOINTERVPROC glad_trace_next_glGetBufferPointerv = NULL;
+static void APIENTRY glad_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBufferPointerv(target, pname, params);
+	glad_trace_end(202, glad_trace_start);
+}
+static PFNGLGETBUFFERSUBDATAPROC glad_trace_next_glGetBufferSubData = NULL;
+static void APIENTRY glad_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetBufferSubData(target, offset, size, data);
+	glad_trace_end(203, glad_trace_start);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_trace_next_glGetCompressedTexImage = NULL;
+static void APIENTRY glad_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetCompressedTexImage(target, level, img);
+	glad_trace_end(204, glad_trace_start);
+}
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_trace_next_glGetCompressedTextureImage = NULL;
+static void APIENTRY glad_trace_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+	glad_trace_end(205, glad_trace_start);
+}
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_trace_next_glGetCompressedTextureSubImage = NULL;
+static void APIENTRY glad_trace_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	glad_trace_end(206, glad_trace_start);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC glad_trace_next_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY glad_trace_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	glad_trace_end(207, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETDOUBLEI_VPROC glad_trace_next_glGetDoublei_v = NULL;
+static void APIENTRY glad_trace_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetDoublei_v(target, index, data);
+	glad_trace_end(208, glad_trace_start);
+}
+static PFNGLGETDOUBLEVPROC glad_trace_next_glGetDoublev = NULL;
+static void APIENTRY glad_trace_glGetDoublev(GLenum pname, GLdouble *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetDoublev(pname, data);
+	glad_trace_end(209, glad_trace_start);
+}
+static PFNGLGETERRORPROC glad_trace_next_glGetError = NULL;
+static GLenum APIENTRY glad_trace_glGetError(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLenum glad_trace_ret = glad_trace_next_glGetError();
+	glad_trace_end(210, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETFLOATI_VPROC glad_trace_next_glGetFloati_v = NULL;
+static void APIENTRY glad_trace_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetFloati_v(target, index, data);
+	glad_trace_end(211, glad_trace_start);
+}
+static PFNGLGETFLOATVPROC glad_trace_next_glGetFloatv = NULL;
+static void APIENTRY glad_trace_glGetFloatv(GLenum pname, GLfloat *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetFloatv(pname, data);
+	glad_trace_end(212, glad_trace_start);
+}
+static PFNGLGETFRAGDATAINDEXPROC glad_trace_next_glGetFragDataIndex = NULL;
+static GLint APIENTRY glad_trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetFragDataIndex(program, name);
+	glad_trace_end(213, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETFRAGDATALOCATIONPROC glad_trace_next_glGetFragDataLocation = NULL;
+static GLint APIENTRY glad_trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetFragDataLocation(program, name);
+	glad_trace_end(214, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_trace_next_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY glad_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	glad_trace_end(215, glad_trace_start);
+}
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_trace_next_glGetFramebufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetFramebufferParameteriv(target, pname, params);
+	glad_trace_end(216, glad_trace_start);
+}
+static PFNGLGETGRAPHICSRESETSTATUSPROC glad_trace_next_glGetGraphicsResetStatus = NULL;
+static GLenum APIENTRY glad_trace_glGetGraphicsResetStatus(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLenum glad_trace_ret = glad_trace_next_glGetGraphicsResetStatus();
+	glad_trace_end(217, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETINTEGER64I_VPROC glad_trace_next_glGetInteger64i_v = NULL;
+static void APIENTRY glad_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetInteger64i_v(target, index, data);
+	glad_trace_end(218, glad_trace_start);
+}
+static PFNGLGETINTEGER64VPROC glad_trace_next_glGetInteger64v = NULL;
+static void APIENTRY glad_trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetInteger64v(pname, data);
+	glad_trace_end(219, glad_trace_start);
+}
+static PFNGLGETINTEGERI_VPROC glad_trace_next_glGetIntegeri_v = NULL;
+static void APIENTRY glad_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetIntegeri_v(target, index, data);
+	glad_trace_end(220, glad_trace_start);
+}
+static PFNGLGETINTEGERVPROC glad_trace_next_glGetIntegerv = NULL;
+static void APIENTRY glad_trace_glGetIntegerv(GLenum pname, GLint *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetIntegerv(pname, data);
+	glad_trace_end(221, glad_trace_start);
+}
+static PFNGLGETINTERNALFORMATI64VPROC glad_trace_next_glGetInternalformati64v = NULL;
+static void APIENTRY glad_trace_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetInternalformati64v(target, internalformat, pname, count, params);
+	glad_trace_end(222, glad_trace_start);
+}
+static PFNGLGETINTERNALFORMATIVPROC glad_trace_next_glGetInternalformativ = NULL;
+static void APIENTRY glad_trace_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetInternalformativ(target, internalformat, pname, count, params);
+	glad_trace_end(223, glad_trace_start);
+}
+static PFNGLGETMULTISAMPLEFVPROC glad_trace_next_glGetMultisamplefv = NULL;
+static void APIENTRY glad_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetMultisamplefv(pname, index, val);
+	glad_trace_end(224, glad_trace_start);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_trace_next_glGetNamedBufferParameteri64v = NULL;
+static void APIENTRY glad_trace_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedBufferParameteri64v(buffer, pname, params);
+	glad_trace_end(225, glad_trace_start);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_trace_next_glGetNamedBufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedBufferParameteriv(buffer, pname, params);
+	glad_trace_end(226, glad_trace_start);
+}
+static PFNGLGETNAMEDBUFFERPOINTERVPROC glad_trace_next_glGetNamedBufferPointerv = NULL;
+static void APIENTRY glad_trace_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedBufferPointerv(buffer, pname, params);
+	glad_trace_end(227, glad_trace_start);
+}
+static PFNGLGETNAMEDBUFFERSUBDATAPROC glad_trace_next_glGetNamedBufferSubData = NULL;
+static void APIENTRY glad_trace_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedBufferSubData(buffer, offset, size, data);
+	glad_trace_end(228, glad_trace_start);
+}
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_trace_next_glGetNamedFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY glad_trace_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	glad_trace_end(229, glad_trace_start);
+}
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_trace_next_glGetNamedFramebufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+	glad_trace_end(230, glad_trace_start);
+}
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_trace_next_glGetNamedRenderbufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	glad_trace_end(231, glad_trace_start);
+}
+static PFNGLGETOBJECTLABELPROC glad_trace_next_glGetObjectLabel = NULL;
+static void APIENTRY glad_trace_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetObjectLabel(identifier, name, bufSize, length, label);
+	glad_trace_end(232, glad_trace_start);
+}
+static PFNGLGETOBJECTPTRLABELPROC glad_trace_next_glGetObjectPtrLabel = NULL;
+static void APIENTRY glad_trace_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	glad_trace_end(233, glad_trace_start);
+}
+static PFNGLGETPOINTERVPROC glad_trace_next_glGetPointerv = NULL;
+static void APIENTRY glad_trace_glGetPointerv(GLenum pname, void **params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetPointerv(pname, params);
+	glad_trace_end(234, glad_trace_start);
+}
+static PFNGLGETPROGRAMBINARYPROC glad_trace_next_glGetProgramBinary = NULL;
+static void APIENTRY glad_trace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	glad_trace_end(235, glad_trace_start);
+}
+static PFNGLGETPROGRAMINFOLOGPROC glad_trace_next_glGetProgramInfoLog = NULL;
+static void APIENTRY glad_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	glad_trace_end(236, glad_trace_start);
+}
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_trace_next_glGetProgramInterfaceiv = NULL;
+static void APIENTRY glad_trace_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramInterfaceiv(program, programInterface, pname, params);
+	glad_trace_end(237, glad_trace_start);
+}
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_trace_next_glGetProgramPipelineInfoLog = NULL;
+static void APIENTRY glad_trace_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	glad_trace_end(238, glad_trace_start);
+}
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_trace_next_glGetProgramPipelineiv = NULL;
+static void APIENTRY glad_trace_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramPipelineiv(pipeline, pname, params);
+	glad_trace_end(239, glad_trace_start);
+}
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_trace_next_glGetProgramResourceIndex = NULL;
+static GLuint APIENTRY glad_trace_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glGetProgramResourceIndex(program, programInterface, name);
+	glad_trace_end(240, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_trace_next_glGetProgramResourceLocation = NULL;
+static GLint APIENTRY glad_trace_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetProgramResourceLocation(program, programInterface, name);
+	glad_trace_end(241, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_trace_next_glGetProgramResourceLocationIndex = NULL;
+static GLint APIENTRY glad_trace_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetProgramResourceLocationIndex(program, programInterface, name);
+	glad_trace_end(242, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_trace_next_glGetProgramResourceName = NULL;
+static void APIENTRY glad_trace_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	glad_trace_end(243, glad_trace_start);
+}
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_trace_next_glGetProgramResourceiv = NULL;
+static void APIENTRY glad_trace_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+	glad_trace_end(244, glad_trace_start);
+}
+static PFNGLGETPROGRAMSTAGEIVPROC glad_trace_next_glGetProgramStageiv = NULL;
+static void APIENTRY glad_trace_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramStageiv(program, shadertype, pname, values);
+	glad_trace_end(245, glad_trace_start);
+}
+static PFNGLGETPROGRAMIVPROC glad_trace_next_glGetProgramiv = NULL;
+static void APIENTRY glad_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetProgramiv(program, pname, params);
+	glad_trace_end(246, glad_trace_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_trace_next_glGetQueryBufferObjecti64v = NULL;
+static void APIENTRY glad_trace_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+	glad_trace_end(247, glad_trace_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTIVPROC glad_trace_next_glGetQueryBufferObjectiv = NULL;
+static void APIENTRY glad_trace_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+	glad_trace_end(248, glad_trace_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_trace_next_glGetQueryBufferObjectui64v = NULL;
+static void APIENTRY glad_trace_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+	glad_trace_end(249, glad_trace_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_trace_next_glGetQueryBufferObjectuiv = NULL;
+static void APIENTRY glad_trace_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+	glad_trace_end(250, glad_trace_start);
+}
+static PFNGLGETQUERYINDEXEDIVPROC glad_trace_next_glGetQueryIndexediv = NULL;
+static void APIENTRY glad_trace_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryIndexediv(target, index, pname, params);
+	glad_trace_end(251, glad_trace_start);
+}
+static PFNGLGETQUERYOBJECTI64VPROC glad_trace_next_glGetQueryObjecti64v = NULL;
+static void APIENTRY glad_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryObjecti64v(id, pname, params);
+	glad_trace_end(252, glad_trace_start);
+}
+static PFNGLGETQUERYOBJECTIVPROC glad_trace_next_glGetQueryObjectiv = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryObjectiv(id, pname, params);
+	glad_trace_end(253, glad_trace_start);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC glad_trace_next_glGetQueryObjectui64v = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryObjectui64v(id, pname, params);
+	glad_trace_end(254, glad_trace_start);
+}
+static PFNGLGETQUERYOBJECTUIVPROC glad_trace_next_glGetQueryObjectuiv = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryObjectuiv(id, pname, params);
+	glad_trace_end(255, glad_trace_start);
+}
+static PFNGLGETQUERYIVPROC glad_trace_next_glGetQueryiv = NULL;
+static void APIENTRY glad_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetQueryiv(target, pname, params);
+	glad_trace_end(256, glad_trace_start);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_trace_next_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetRenderbufferParameteriv(target, pname, params);
+	glad_trace_end(257, glad_trace_start);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_trace_next_glGetSamplerParameterIiv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetSamplerParameterIiv(sampler, pname, params);
+	glad_trace_end(258, glad_trace_start);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_trace_next_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetSamplerParameterIuiv(sampler, pname, params);
+	glad_trace_end(259, glad_trace_start);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_trace_next_glGetSamplerParameterfv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetSamplerParameterfv(sampler, pname, params);
+	glad_trace_end(260, glad_trace_start);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_trace_next_glGetSamplerParameteriv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetSamplerParameteriv(sampler, pname, params);
+	glad_trace_end(261, glad_trace_start);
+}
+static PFNGLGETSHADERINFOLOGPROC glad_trace_next_glGetShaderInfoLog = NULL;
+static void APIENTRY glad_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	glad_trace_end(262, glad_trace_start);
+}
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_trace_next_glGetShaderPrecisionFormat = NULL;
+static void APIENTRY glad_trace_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	glad_trace_end(263, glad_trace_start);
+}
+static PFNGLGETSHADERSOURCEPROC glad_trace_next_glGetShaderSource = NULL;
+static void APIENTRY glad_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetShaderSource(shader, bufSize, length, source);
+	glad_trace_end(264, glad_trace_start);
+}
+static PFNGLGETSHADERIVPROC glad_trace_next_glGetShaderiv = NULL;
+static void APIENTRY glad_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetShaderiv(shader, pname, params);
+	glad_trace_end(265, glad_trace_start);
+}
+static PFNGLGETSTRINGPROC glad_trace_next_glGetString = NULL;
+static const GLubyte *APIENTRY glad_trace_glGetString(GLenum name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	const GLubyte *glad_trace_ret = glad_trace_next_glGetString(name);
+	glad_trace_end(266, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETSTRINGIPROC glad_trace_next_glGetStringi = NULL;
+static const GLubyte *APIENTRY glad_trace_glGetStringi(GLenum name, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	const GLubyte *glad_trace_ret = glad_trace_next_glGetStringi(name, index);
+	glad_trace_end(267, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETSUBROUTINEINDEXPROC glad_trace_next_glGetSubroutineIndex = NULL;
+static GLuint APIENTRY glad_trace_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glGetSubroutineIndex(program, shadertype, name);
+	glad_trace_end(268, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_trace_next_glGetSubroutineUniformLocation = NULL;
+static GLint APIENTRY glad_trace_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetSubroutineUniformLocation(program, shadertype, name);
+	glad_trace_end(269, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETSYNCIVPROC glad_trace_next_glGetSynciv = NULL;
+static void APIENTRY glad_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetSynciv(sync, pname, count, length, values);
+	glad_trace_end(270, glad_trace_start);
+}
+static PFNGLGETTEXIMAGEPROC glad_trace_next_glGetTexImage = NULL;
+static void APIENTRY glad_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexImage(target, level, format, type, pixels);
+	glad_trace_end(271, glad_trace_start);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_trace_next_glGetTexLevelParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexLevelParameterfv(target, level, pname, params);
+	glad_trace_end(272, glad_trace_start);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_trace_next_glGetTexLevelParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexLevelParameteriv(target, level, pname, params);
+	glad_trace_end(273, glad_trace_start);
+}
+static PFNGLGETTEXPARAMETERIIVPROC glad_trace_next_glGetTexParameterIiv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexParameterIiv(target, pname, params);
+	glad_trace_end(274, glad_trace_start);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC glad_trace_next_glGetTexParameterIuiv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexParameterIuiv(target, pname, params);
+	glad_trace_end(275, glad_trace_start);
+}
+static PFNGLGETTEXPARAMETERFVPROC glad_trace_next_glGetTexParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexParameterfv(target, pname, params);
+	glad_trace_end(276, glad_trace_start);
+}
+static PFNGLGETTEXPARAMETERIVPROC glad_trace_next_glGetTexParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTexParameteriv(target, pname, params);
+	glad_trace_end(277, glad_trace_start);
+}
+static PFNGLGETTEXTUREIMAGEPROC glad_trace_next_glGetTextureImage = NULL;
+static void APIENTRY glad_trace_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+	glad_trace_end(278, glad_trace_start);
+}
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_trace_next_glGetTextureLevelParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureLevelParameterfv(texture, level, pname, params);
+	glad_trace_end(279, glad_trace_start);
+}
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_trace_next_glGetTextureLevelParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureLevelParameteriv(texture, level, pname, params);
+	glad_trace_end(280, glad_trace_start);
+}
+static PFNGLGETTEXTUREPARAMETERIIVPROC glad_trace_next_glGetTextureParameterIiv = NULL;
+static void APIENTRY glad_trace_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureParameterIiv(texture, pname, params);
+	glad_trace_end(281, glad_trace_start);
+}
+static PFNGLGETTEXTUREPARAMETERIUIVPROC glad_trace_next_glGetTextureParameterIuiv = NULL;
+static void APIENTRY glad_trace_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureParameterIuiv(texture, pname, params);
+	glad_trace_end(282, glad_trace_start);
+}
+static PFNGLGETTEXTUREPARAMETERFVPROC glad_trace_next_glGetTextureParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureParameterfv(texture, pname, params);
+	glad_trace_end(283, glad_trace_start);
+}
+static PFNGLGETTEXTUREPARAMETERIVPROC glad_trace_next_glGetTextureParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureParameteriv(texture, pname, params);
+	glad_trace_end(284, glad_trace_start);
+}
+static PFNGLGETTEXTURESUBIMAGEPROC glad_trace_next_glGetTextureSubImage = NULL;
+static void APIENTRY glad_trace_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	glad_trace_end(285, glad_trace_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_trace_next_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY glad_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	glad_trace_end(286, glad_trace_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_trace_next_glGetTransformFeedbacki64_v = NULL;
+static void APIENTRY glad_trace_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+	glad_trace_end(287, glad_trace_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_trace_next_glGetTransformFeedbacki_v = NULL;
+static void APIENTRY glad_trace_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTransformFeedbacki_v(xfb, pname, index, param);
+	glad_trace_end(288, glad_trace_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKIVPROC glad_trace_next_glGetTransformFeedbackiv = NULL;
+static void APIENTRY glad_trace_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetTransformFeedbackiv(xfb, pname, param);
+	glad_trace_end(289, glad_trace_start);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_trace_next_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY glad_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLuint glad_trace_ret = glad_trace_next_glGetUniformBlockIndex(program, uniformBlockName);
+	glad_trace_end(290, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETUNIFORMINDICESPROC glad_trace_next_glGetUniformIndices = NULL;
+static void APIENTRY glad_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	glad_trace_end(291, glad_trace_start);
+}
+static PFNGLGETUNIFORMLOCATIONPROC glad_trace_next_glGetUniformLocation = NULL;
+static GLint APIENTRY glad_trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLint glad_trace_ret = glad_trace_next_glGetUniformLocation(program, name);
+	glad_trace_end(292, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_trace_next_glGetUniformSubroutineuiv = NULL;
+static void APIENTRY glad_trace_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformSubroutineuiv(shadertype, location, params);
+	glad_trace_end(293, glad_trace_start);
+}
+static PFNGLGETUNIFORMDVPROC glad_trace_next_glGetUniformdv = NULL;
+static void APIENTRY glad_trace_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformdv(program, location, params);
+	glad_trace_end(294, glad_trace_start);
+}
+static PFNGLGETUNIFORMFVPROC glad_trace_next_glGetUniformfv = NULL;
+static void APIENTRY glad_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformfv(program, location, params);
+	glad_trace_end(295, glad_trace_start);
+}
+static PFNGLGETUNIFORMIVPROC glad_trace_next_glGetUniformiv = NULL;
+static void APIENTRY glad_trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformiv(program, location, params);
+	glad_trace_end(296, glad_trace_start);
+}
+static PFNGLGETUNIFORMUIVPROC glad_trace_next_glGetUniformuiv = NULL;
+static void APIENTRY glad_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetUniformuiv(program, location, params);
+	glad_trace_end(297, glad_trace_start);
+}
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_trace_next_glGetVertexArrayIndexed64iv = NULL;
+static void APIENTRY glad_trace_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	glad_trace_end(298, glad_trace_start);
+}
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_trace_next_glGetVertexArrayIndexediv = NULL;
+static void APIENTRY glad_trace_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+	glad_trace_end(299, glad_trace_start);
+}
+static PFNGLGETVERTEXARRAYIVPROC glad_trace_next_glGetVertexArrayiv = NULL;
+static void APIENTRY glad_trace_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexArrayiv(vaobj, pname, param);
+	glad_trace_end(300, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC glad_trace_next_glGetVertexAttribIiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribIiv(index, pname, params);
+	glad_trace_end(301, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_trace_next_glGetVertexAttribIuiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribIuiv(index, pname, params);
+	glad_trace_end(302, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBLDVPROC glad_trace_next_glGetVertexAttribLdv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribLdv(index, pname, params);
+	glad_trace_end(303, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_trace_next_glGetVertexAttribPointerv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribPointerv(index, pname, pointer);
+	glad_trace_end(304, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBDVPROC glad_trace_next_glGetVertexAttribdv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribdv(index, pname, params);
+	glad_trace_end(305, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBFVPROC glad_trace_next_glGetVertexAttribfv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribfv(index, pname, params);
+	glad_trace_end(306, glad_trace_start);
+}
+static PFNGLGETVERTEXATTRIBIVPROC glad_trace_next_glGetVertexAttribiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetVertexAttribiv(index, pname, params);
+	glad_trace_end(307, glad_trace_start);
+}
+static PFNGLGETNCOLORTABLEPROC glad_trace_next_glGetnColorTable = NULL;
+static void APIENTRY glad_trace_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnColorTable(target, format, type, bufSize, table);
+	glad_trace_end(308, glad_trace_start);
+}
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_trace_next_glGetnCompressedTexImage = NULL;
+static void APIENTRY glad_trace_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+	glad_trace_end(309, glad_trace_start);
+}
+static PFNGLGETNCONVOLUTIONFILTERPROC glad_trace_next_glGetnConvolutionFilter = NULL;
+static void APIENTRY glad_trace_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnConvolutionFilter(target, format, type, bufSize, image);
+	glad_trace_end(310, glad_trace_start);
+}
+static PFNGLGETNHISTOGRAMPROC glad_trace_next_glGetnHistogram = NULL;
+static void APIENTRY glad_trace_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnHistogram(target, reset, format, type, bufSize, values);
+	glad_trace_end(311, glad_trace_start);
+}
+static PFNGLGETNMAPDVPROC glad_trace_next_glGetnMapdv = NULL;
+static void APIENTRY glad_trace_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnMapdv(target, query, bufSize, v);
+	glad_trace_end(312, glad_trace_start);
+}
+static PFNGLGETNMAPFVPROC glad_trace_next_glGetnMapfv = NULL;
+static void APIENTRY glad_trace_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnMapfv(target, query, bufSize, v);
+	glad_trace_end(313, glad_trace_start);
+}
+static PFNGLGETNMAPIVPROC glad_trace_next_glGetnMapiv = NULL;
+static void APIENTRY glad_trace_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnMapiv(target, query, bufSize, v);
+	glad_trace_end(314, glad_trace_start);
+}
+static PFNGLGETNMINMAXPROC glad_trace_next_glGetnMinmax = NULL;
+static void APIENTRY glad_trace_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnMinmax(target, reset, format, type, bufSize, values);
+	glad_trace_end(315, glad_trace_start);
+}
+static PFNGLGETNPIXELMAPFVPROC glad_trace_next_glGetnPixelMapfv = NULL;
+static void APIENTRY glad_trace_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnPixelMapfv(map, bufSize, values);
+	glad_trace_end(316, glad_trace_start);
+}
+static PFNGLGETNPIXELMAPUIVPROC glad_trace_next_glGetnPixelMapuiv = NULL;
+static void APIENTRY glad_trace_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnPixelMapuiv(map, bufSize, values);
+	glad_trace_end(317, glad_trace_start);
+}
+static PFNGLGETNPIXELMAPUSVPROC glad_trace_next_glGetnPixelMapusv = NULL;
+static void APIENTRY glad_trace_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnPixelMapusv(map, bufSize, values);
+	glad_trace_end(318, glad_trace_start);
+}
+static PFNGLGETNPOLYGONSTIPPLEPROC glad_trace_next_glGetnPolygonStipple = NULL;
+static void APIENTRY glad_trace_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnPolygonStipple(bufSize, pattern);
+	glad_trace_end(319, glad_trace_start);
+}
+static PFNGLGETNSEPARABLEFILTERPROC glad_trace_next_glGetnSeparableFilter = NULL;
+static void APIENTRY glad_trace_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+	glad_trace_end(320, glad_trace_start);
+}
+static PFNGLGETNTEXIMAGEPROC glad_trace_next_glGetnTexImage = NULL;
+static void APIENTRY glad_trace_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnTexImage(target, level, format, type, bufSize, pixels);
+	glad_trace_end(321, glad_trace_start);
+}
+static PFNGLGETNUNIFORMDVPROC glad_trace_next_glGetnUniformdv = NULL;
+static void APIENTRY glad_trace_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnUniformdv(program, location, bufSize, params);
+	glad_trace_end(322, glad_trace_start);
+}
+static PFNGLGETNUNIFORMFVPROC glad_trace_next_glGetnUniformfv = NULL;
+static void APIENTRY glad_trace_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnUniformfv(program, location, bufSize, params);
+	glad_trace_end(323, glad_trace_start);
+}
+static PFNGLGETNUNIFORMIVPROC glad_trace_next_glGetnUniformiv = NULL;
+static void APIENTRY glad_trace_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnUniformiv(program, location, bufSize, params);
+	glad_trace_end(324, glad_trace_start);
+}
+static PFNGLGETNUNIFORMUIVPROC glad_trace_next_glGetnUniformuiv = NULL;
+static void APIENTRY glad_trace_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glGetnUniformuiv(program, location, bufSize, params);
+	glad_trace_end(325, glad_trace_start);
+}
+static PFNGLHINTPROC glad_trace_next_glHint = NULL;
+static void APIENTRY glad_trace_glHint(GLenum target, GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glHint(target, mode);
+	glad_trace_end(326, glad_trace_start);
+}
+static PFNGLINVALIDATEBUFFERDATAPROC glad_trace_next_glInvalidateBufferData = NULL;
+static void APIENTRY glad_trace_glInvalidateBufferData(GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateBufferData(buffer);
+	glad_trace_end(327, glad_trace_start);
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_trace_next_glInvalidateBufferSubData = NULL;
+static void APIENTRY glad_trace_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateBufferSubData(buffer, offset, length);
+	glad_trace_end(328, glad_trace_start);
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_trace_next_glInvalidateFramebuffer = NULL;
+static void APIENTRY glad_trace_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateFramebuffer(target, numAttachments, attachments);
+	glad_trace_end(329, glad_trace_start);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_trace_next_glInvalidateNamedFramebufferData = NULL;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	glad_trace_end(330, glad_trace_start);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_trace_next_glInvalidateNamedFramebufferSubData = NULL;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	glad_trace_end(331, glad_trace_start);
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_trace_next_glInvalidateSubFramebuffer = NULL;
+static void APIENTRY glad_trace_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	glad_trace_end(332, glad_trace_start);
+}
+static PFNGLINVALIDATETEXIMAGEPROC glad_trace_next_glInvalidateTexImage = NULL;
+static void APIENTRY glad_trace_glInvalidateTexImage(GLuint texture, GLint level) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateTexImage(texture, level);
+	glad_trace_end(333, glad_trace_start);
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_trace_next_glInvalidateTexSubImage = NULL;
+static void APIENTRY glad_trace_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	glad_trace_end(334, glad_trace_start);
+}
+static PFNGLISBUFFERPROC glad_trace_next_glIsBuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsBuffer(GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsBuffer(buffer);
+	glad_trace_end(335, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISENABLEDPROC glad_trace_next_glIsEnabled = NULL;
+static GLboolean APIENTRY glad_trace_glIsEnabled(GLenum cap) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsEnabled(cap);
+	glad_trace_end(336, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISENABLEDIPROC glad_trace_next_glIsEnabledi = NULL;
+static GLboolean APIENTRY glad_trace_glIsEnabledi(GLenum target, GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsEnabledi(target, index);
+	glad_trace_end(337, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISFRAMEBUFFERPROC glad_trace_next_glIsFramebuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsFramebuffer(GLuint framebuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsFramebuffer(framebuffer);
+	glad_trace_end(338, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISPROGRAMPROC glad_trace_next_glIsProgram = NULL;
+static GLboolean APIENTRY glad_trace_glIsProgram(GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsProgram(program);
+	glad_trace_end(339, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISPROGRAMPIPELINEPROC glad_trace_next_glIsProgramPipeline = NULL;
+static GLboolean APIENTRY glad_trace_glIsProgramPipeline(GLuint pipeline) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsProgramPipeline(pipeline);
+	glad_trace_end(340, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISQUERYPROC glad_trace_next_glIsQuery = NULL;
+static GLboolean APIENTRY glad_trace_glIsQuery(GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsQuery(id);
+	glad_trace_end(341, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISRENDERBUFFERPROC glad_trace_next_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsRenderbuffer(GLuint renderbuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsRenderbuffer(renderbuffer);
+	glad_trace_end(342, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISSAMPLERPROC glad_trace_next_glIsSampler = NULL;
+static GLboolean APIENTRY glad_trace_glIsSampler(GLuint sampler) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsSampler(sampler);
+	glad_trace_end(343, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISSHADERPROC glad_trace_next_glIsShader = NULL;
+static GLboolean APIENTRY glad_trace_glIsShader(GLuint shader) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsShader(shader);
+	glad_trace_end(344, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISSYNCPROC glad_trace_next_glIsSync = NULL;
+static GLboolean APIENTRY glad_trace_glIsSync(GLsync sync) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsSync(sync);
+	glad_trace_end(345, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISTEXTUREPROC glad_trace_next_glIsTexture = NULL;
+static GLboolean APIENTRY glad_trace_glIsTexture(GLuint texture) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsTexture(texture);
+	glad_trace_end(346, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISTRANSFORMFEEDBACKPROC glad_trace_next_glIsTransformFeedback = NULL;
+static GLboolean APIENTRY glad_trace_glIsTransformFeedback(GLuint id) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsTransformFeedback(id);
+	glad_trace_end(347, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLISVERTEXARRAYPROC glad_trace_next_glIsVertexArray = NULL;
+static GLboolean APIENTRY glad_trace_glIsVertexArray(GLuint array) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glIsVertexArray(array);
+	glad_trace_end(348, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLLINEWIDTHPROC glad_trace_next_glLineWidth = NULL;
+static void APIENTRY glad_trace_glLineWidth(GLfloat width) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glLineWidth(width);
+	glad_trace_end(349, glad_trace_start);
+}
+static PFNGLLINKPROGRAMPROC glad_trace_next_glLinkProgram = NULL;
+static void APIENTRY glad_trace_glLinkProgram(GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glLinkProgram(program);
+	glad_trace_end(350, glad_trace_start);
+}
+static PFNGLLOGICOPPROC glad_trace_next_glLogicOp = NULL;
+static void APIENTRY glad_trace_glLogicOp(GLenum opcode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glLogicOp(opcode);
+	glad_trace_end(351, glad_trace_start);
+}
+static PFNGLMAPBUFFERPROC glad_trace_next_glMapBuffer = NULL;
+static void *APIENTRY glad_trace_glMapBuffer(GLenum target, GLenum access) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	void *glad_trace_ret = glad_trace_next_glMapBuffer(target, access);
+	glad_trace_end(352, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLMAPBUFFERRANGEPROC glad_trace_next_glMapBufferRange = NULL;
+static void *APIENTRY glad_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	void *glad_trace_ret = glad_trace_next_glMapBufferRange(target, offset, length, access);
+	glad_trace_end(353, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLMAPNAMEDBUFFERPROC glad_trace_next_glMapNamedBuffer = NULL;
+static void *APIENTRY glad_trace_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	void *glad_trace_ret = glad_trace_next_glMapNamedBuffer(buffer, access);
+	glad_trace_end(354, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_trace_next_glMapNamedBufferRange = NULL;
+static void *APIENTRY glad_trace_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	void *glad_trace_ret = glad_trace_next_glMapNamedBufferRange(buffer, offset, length, access);
+	glad_trace_end(355, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLMEMORYBARRIERPROC glad_trace_next_glMemoryBarrier = NULL;
+static void APIENTRY glad_trace_glMemoryBarrier(GLbitfield barriers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMemoryBarrier(barriers);
+	glad_trace_end(356, glad_trace_start);
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_trace_next_glMemoryBarrierByRegion = NULL;
+static void APIENTRY glad_trace_glMemoryBarrierByRegion(GLbitfield barriers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMemoryBarrierByRegion(barriers);
+	glad_trace_end(357, glad_trace_start);
+}
+static PFNGLMINSAMPLESHADINGPROC glad_trace_next_glMinSampleShading = NULL;
+static void APIENTRY glad_trace_glMinSampleShading(GLfloat value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMinSampleShading(value);
+	glad_trace_end(358, glad_trace_start);
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_trace_next_glMultiDrawArrays = NULL;
+static void APIENTRY glad_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawArrays(mode, first, count, drawcount);
+	glad_trace_end(359, glad_trace_start);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_trace_next_glMultiDrawArraysIndirect = NULL;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	glad_trace_end(360, glad_trace_start);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_trace_next_glMultiDrawArraysIndirectCount = NULL;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+	glad_trace_end(361, glad_trace_start);
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_trace_next_glMultiDrawElements = NULL;
+static void APIENTRY glad_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawElements(mode, count, type, indices, drawcount);
+	glad_trace_end(362, glad_trace_start);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	glad_trace_end(363, glad_trace_start);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_trace_next_glMultiDrawElementsIndirect = NULL;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	glad_trace_end(364, glad_trace_start);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_trace_next_glMultiDrawElementsIndirectCount = NULL;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+	glad_trace_end(365, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_trace_next_glMultiTexCoordP1ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP1ui(texture, type, coords);
+	glad_trace_end(366, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_trace_next_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP1uiv(texture, type, coords);
+	glad_trace_end(367, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_trace_next_glMultiTexCoordP2ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP2ui(texture, type, coords);
+	glad_trace_end(368, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_trace_next_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP2uiv(texture, type, coords);
+	glad_trace_end(369, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_trace_next_glMultiTexCoordP3ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP3ui(texture, type, coords);
+	glad_trace_end(370, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_trace_next_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP3uiv(texture, type, coords);
+	glad_trace_end(371, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_trace_next_glMultiTexCoordP4ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP4ui(texture, type, coords);
+	glad_trace_end(372, glad_trace_start);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_trace_next_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glMultiTexCoordP4uiv(texture, type, coords);
+	glad_trace_end(373, glad_trace_start);
+}
+static PFNGLNAMEDBUFFERDATAPROC glad_trace_next_glNamedBufferData = NULL;
+static void APIENTRY glad_trace_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedBufferData(buffer, size, data, usage);
+	glad_trace_end(374, glad_trace_start);
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_trace_next_glNamedBufferStorage = NULL;
+static void APIENTRY glad_trace_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedBufferStorage(buffer, size, data, flags);
+	glad_trace_end(375, glad_trace_start);
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_trace_next_glNamedBufferSubData = NULL;
+static void APIENTRY glad_trace_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedBufferSubData(buffer, offset, size, data);
+	glad_trace_end(376, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_trace_next_glNamedFramebufferDrawBuffer = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferDrawBuffer(framebuffer, buf);
+	glad_trace_end(377, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_trace_next_glNamedFramebufferDrawBuffers = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	glad_trace_end(378, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_trace_next_glNamedFramebufferParameteri = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferParameteri(framebuffer, pname, param);
+	glad_trace_end(379, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_trace_next_glNamedFramebufferReadBuffer = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferReadBuffer(framebuffer, src);
+	glad_trace_end(380, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_trace_next_glNamedFramebufferRenderbuffer = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	glad_trace_end(381, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_trace_next_glNamedFramebufferTexture = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+	glad_trace_end(382, glad_trace_start);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_trace_next_glNamedFramebufferTextureLayer = NULL;
+static void APIENTRY glad_trace_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	glad_trace_end(383, glad_trace_start);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_trace_next_glNamedRenderbufferStorage = NULL;
+static void APIENTRY glad_trace_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	glad_trace_end(384, glad_trace_start);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_next_glNamedRenderbufferStorageMultisample = NULL;
+static void APIENTRY glad_trace_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	glad_trace_end(385, glad_trace_start);
+}
+static PFNGLNORMALP3UIPROC glad_trace_next_glNormalP3ui = NULL;
+static void APIENTRY glad_trace_glNormalP3ui(GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNormalP3ui(type, coords);
+	glad_trace_end(386, glad_trace_start);
+}
+static PFNGLNORMALP3UIVPROC glad_trace_next_glNormalP3uiv = NULL;
+static void APIENTRY glad_trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glNormalP3uiv(type, coords);
+	glad_trace_end(387, glad_trace_start);
+}
+static PFNGLOBJECTLABELPROC glad_trace_next_glObjectLabel = NULL;
+static void APIENTRY glad_trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glObjectLabel(identifier, name, length, label);
+	glad_trace_end(388, glad_trace_start);
+}
+static PFNGLOBJECTPTRLABELPROC glad_trace_next_glObjectPtrLabel = NULL;
+static void APIENTRY glad_trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glObjectPtrLabel(ptr, length, label);
+	glad_trace_end(389, glad_trace_start);
+}
+static PFNGLPATCHPARAMETERFVPROC glad_trace_next_glPatchParameterfv = NULL;
+static void APIENTRY glad_trace_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPatchParameterfv(pname, values);
+	glad_trace_end(390, glad_trace_start);
+}
+static PFNGLPATCHPARAMETERIPROC glad_trace_next_glPatchParameteri = NULL;
+static void APIENTRY glad_trace_glPatchParameteri(GLenum pname, GLint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPatchParameteri(pname, value);
+	glad_trace_end(391, glad_trace_start);
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_trace_next_glPauseTransformFeedback = NULL;
+static void APIENTRY glad_trace_glPauseTransformFeedback(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPauseTransformFeedback();
+	glad_trace_end(392, glad_trace_start);
+}
+static PFNGLPIXELSTOREFPROC glad_trace_next_glPixelStoref = NULL;
+static void APIENTRY glad_trace_glPixelStoref(GLenum pname, GLfloat param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPixelStoref(pname, param);
+	glad_trace_end(393, glad_trace_start);
+}
+static PFNGLPIXELSTOREIPROC glad_trace_next_glPixelStorei = NULL;
+static void APIENTRY glad_trace_glPixelStorei(GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPixelStorei(pname, param);
+	glad_trace_end(394, glad_trace_start);
+}
+static PFNGLPOINTPARAMETERFPROC glad_trace_next_glPointParameterf = NULL;
+static void APIENTRY glad_trace_glPointParameterf(GLenum pname, GLfloat param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPointParameterf(pname, param);
+	glad_trace_end(395, glad_trace_start);
+}
+static PFNGLPOINTPARAMETERFVPROC glad_trace_next_glPointParameterfv = NULL;
+static void APIENTRY glad_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPointParameterfv(pname, params);
+	glad_trace_end(396, glad_trace_start);
+}
+static PFNGLPOINTPARAMETERIPROC glad_trace_next_glPointParameteri = NULL;
+static void APIENTRY glad_trace_glPointParameteri(GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPointParameteri(pname, param);
+	glad_trace_end(397, glad_trace_start);
+}
+static PFNGLPOINTPARAMETERIVPROC glad_trace_next_glPointParameteriv = NULL;
+static void APIENTRY glad_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPointParameteriv(pname, params);
+	glad_trace_end(398, glad_trace_start);
+}
+static PFNGLPOINTSIZEPROC glad_trace_next_glPointSize = NULL;
+static void APIENTRY glad_trace_glPointSize(GLfloat size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPointSize(size);
+	glad_trace_end(399, glad_trace_start);
+}
+static PFNGLPOLYGONMODEPROC glad_trace_next_glPolygonMode = NULL;
+static void APIENTRY glad_trace_glPolygonMode(GLenum face, GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPolygonMode(face, mode);
+	glad_trace_end(400, glad_trace_start);
+}
+static PFNGLPOLYGONOFFSETPROC glad_trace_next_glPolygonOffset = NULL;
+static void APIENTRY glad_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPolygonOffset(factor, units);
+	glad_trace_end(401, glad_trace_start);
+}
+static PFNGLPOLYGONOFFSETCLAMPPROC glad_trace_next_glPolygonOffsetClamp = NULL;
+static void APIENTRY glad_trace_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPolygonOffsetClamp(factor, units, clamp);
+	glad_trace_end(402, glad_trace_start);
+}
+static PFNGLPOPDEBUGGROUPPROC glad_trace_next_glPopDebugGroup = NULL;
+static void APIENTRY glad_trace_glPopDebugGroup(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPopDebugGroup();
+	glad_trace_end(403, glad_trace_start);
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_trace_next_glPrimitiveRestartIndex = NULL;
+static void APIENTRY glad_trace_glPrimitiveRestartIndex(GLuint index) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPrimitiveRestartIndex(index);
+	glad_trace_end(404, glad_trace_start);
+}
+static PFNGLPROGRAMBINARYPROC glad_trace_next_glProgramBinary = NULL;
+static void APIENTRY glad_trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramBinary(program, binaryFormat, binary, length);
+	glad_trace_end(405, glad_trace_start);
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_trace_next_glProgramParameteri = NULL;
+static void APIENTRY glad_trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramParameteri(program, pname, value);
+	glad_trace_end(406, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1DPROC glad_trace_next_glProgramUniform1d = NULL;
+static void APIENTRY glad_trace_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1d(program, location, v0);
+	glad_trace_end(407, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1DVPROC glad_trace_next_glProgramUniform1dv = NULL;
+static void APIENTRY glad_trace_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1dv(program, location, count, value);
+	glad_trace_end(408, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1FPROC glad_trace_next_glProgramUniform1f = NULL;
+static void APIENTRY glad_trace_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1f(program, location, v0);
+	glad_trace_end(409, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1FVPROC glad_trace_next_glProgramUniform1fv = NULL;
+static void APIENTRY glad_trace_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1fv(program, location, count, value);
+	glad_trace_end(410, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1IPROC glad_trace_next_glProgramUniform1i = NULL;
+static void APIENTRY glad_trace_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1i(program, location, v0);
+	glad_trace_end(411, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1IVPROC glad_trace_next_glProgramUniform1iv = NULL;
+static void APIENTRY glad_trace_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1iv(program, location, count, value);
+	glad_trace_end(412, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1UIPROC glad_trace_next_glProgramUniform1ui = NULL;
+static void APIENTRY glad_trace_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1ui(program, location, v0);
+	glad_trace_end(413, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_trace_next_glProgramUniform1uiv = NULL;
+static void APIENTRY glad_trace_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform1uiv(program, location, count, value);
+	glad_trace_end(414, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2DPROC glad_trace_next_glProgramUniform2d = NULL;
+static void APIENTRY glad_trace_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2d(program, location, v0, v1);
+	glad_trace_end(415, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2DVPROC glad_trace_next_glProgramUniform2dv = NULL;
+static void APIENTRY glad_trace_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2dv(program, location, count, value);
+	glad_trace_end(416, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2FPROC glad_trace_next_glProgramUniform2f = NULL;
+static void APIENTRY glad_trace_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2f(program, location, v0, v1);
+	glad_trace_end(417, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2FVPROC glad_trace_next_glProgramUniform2fv = NULL;
+static void APIENTRY glad_trace_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2fv(program, location, count, value);
+	glad_trace_end(418, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2IPROC glad_trace_next_glProgramUniform2i = NULL;
+static void APIENTRY glad_trace_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2i(program, location, v0, v1);
+	glad_trace_end(419, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2IVPROC glad_trace_next_glProgramUniform2iv = NULL;
+static void APIENTRY glad_trace_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2iv(program, location, count, value);
+	glad_trace_end(420, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2UIPROC glad_trace_next_glProgramUniform2ui = NULL;
+static void APIENTRY glad_trace_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2ui(program, location, v0, v1);
+	glad_trace_end(421, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_trace_next_glProgramUniform2uiv = NULL;
+static void APIENTRY glad_trace_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform2uiv(program, location, count, value);
+	glad_trace_end(422, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3DPROC glad_trace_next_glProgramUniform3d = NULL;
+static void APIENTRY glad_trace_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3d(program, location, v0, v1, v2);
+	glad_trace_end(423, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3DVPROC glad_trace_next_glProgramUniform3dv = NULL;
+static void APIENTRY glad_trace_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3dv(program, location, count, value);
+	glad_trace_end(424, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3FPROC glad_trace_next_glProgramUniform3f = NULL;
+static void APIENTRY glad_trace_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3f(program, location, v0, v1, v2);
+	glad_trace_end(425, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3FVPROC glad_trace_next_glProgramUniform3fv = NULL;
+static void APIENTRY glad_trace_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3fv(program, location, count, value);
+	glad_trace_end(426, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3IPROC glad_trace_next_glProgramUniform3i = NULL;
+static void APIENTRY glad_trace_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3i(program, location, v0, v1, v2);
+	glad_trace_end(427, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3IVPROC glad_trace_next_glProgramUniform3iv = NULL;
+static void APIENTRY glad_trace_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3iv(program, location, count, value);
+	glad_trace_end(428, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3UIPROC glad_trace_next_glProgramUniform3ui = NULL;
+static void APIENTRY glad_trace_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3ui(program, location, v0, v1, v2);
+	glad_trace_end(429, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_trace_next_glProgramUniform3uiv = NULL;
+static void APIENTRY glad_trace_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform3uiv(program, location, count, value);
+	glad_trace_end(430, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4DPROC glad_trace_next_glProgramUniform4d = NULL;
+static void APIENTRY glad_trace_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4d(program, location, v0, v1, v2, v3);
+	glad_trace_end(431, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4DVPROC glad_trace_next_glProgramUniform4dv = NULL;
+static void APIENTRY glad_trace_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4dv(program, location, count, value);
+	glad_trace_end(432, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4FPROC glad_trace_next_glProgramUniform4f = NULL;
+static void APIENTRY glad_trace_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4f(program, location, v0, v1, v2, v3);
+	glad_trace_end(433, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4FVPROC glad_trace_next_glProgramUniform4fv = NULL;
+static void APIENTRY glad_trace_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4fv(program, location, count, value);
+	glad_trace_end(434, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4IPROC glad_trace_next_glProgramUniform4i = NULL;
+static void APIENTRY glad_trace_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4i(program, location, v0, v1, v2, v3);
+	glad_trace_end(435, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4IVPROC glad_trace_next_glProgramUniform4iv = NULL;
+static void APIENTRY glad_trace_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4iv(program, location, count, value);
+	glad_trace_end(436, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4UIPROC glad_trace_next_glProgramUniform4ui = NULL;
+static void APIENTRY glad_trace_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+	glad_trace_end(437, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_trace_next_glProgramUniform4uiv = NULL;
+static void APIENTRY glad_trace_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniform4uiv(program, location, count, value);
+	glad_trace_end(438, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_trace_next_glProgramUniformMatrix2dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+	glad_trace_end(439, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_trace_next_glProgramUniformMatrix2fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+	glad_trace_end(440, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_trace_next_glProgramUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	glad_trace_end(441, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_trace_next_glProgramUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	glad_trace_end(442, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_trace_next_glProgramUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	glad_trace_end(443, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_trace_next_glProgramUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	glad_trace_end(444, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_trace_next_glProgramUniformMatrix3dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+	glad_trace_end(445, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_trace_next_glProgramUniformMatrix3fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+	glad_trace_end(446, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_trace_next_glProgramUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	glad_trace_end(447, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_trace_next_glProgramUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	glad_trace_end(448, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_trace_next_glProgramUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	glad_trace_end(449, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_trace_next_glProgramUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	glad_trace_end(450, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_trace_next_glProgramUniformMatrix4dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+	glad_trace_end(451, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_trace_next_glProgramUniformMatrix4fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+	glad_trace_end(452, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_trace_next_glProgramUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	glad_trace_end(453, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_trace_next_glProgramUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	glad_trace_end(454, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_trace_next_glProgramUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	glad_trace_end(455, glad_trace_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_trace_next_glProgramUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	glad_trace_end(456, glad_trace_start);
+}
+static PFNGLPROVOKINGVERTEXPROC glad_trace_next_glProvokingVertex = NULL;
+static void APIENTRY glad_trace_glProvokingVertex(GLenum mode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glProvokingVertex(mode);
+	glad_trace_end(457, glad_trace_start);
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_trace_next_glPushDebugGroup = NULL;
+static void APIENTRY glad_trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glPushDebugGroup(source, id, length, message);
+	glad_trace_end(458, glad_trace_start);
+}
+static PFNGLQUERYCOUNTERPROC glad_trace_next_glQueryCounter = NULL;
+static void APIENTRY glad_trace_glQueryCounter(GLuint id, GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glQueryCounter(id, target);
+	glad_trace_end(459, glad_trace_start);
+}
+static PFNGLREADBUFFERPROC glad_trace_next_glReadBuffer = NULL;
+static void APIENTRY glad_trace_glReadBuffer(GLenum src) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glReadBuffer(src);
+	glad_trace_end(460, glad_trace_start);
+}
+static PFNGLREADPIXELSPROC glad_trace_next_glReadPixels = NULL;
+static void APIENTRY glad_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glReadPixels(x, y, width, height, format, type, pixels);
+	glad_trace_end(461, glad_trace_start);
+}
+static PFNGLREADNPIXELSPROC glad_trace_next_glReadnPixels = NULL;
+static void APIENTRY glad_trace_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+	glad_trace_end(462, glad_trace_start);
+}
+static PFNGLRELEASESHADERCOMPILERPROC glad_trace_next_glReleaseShaderCompiler = NULL;
+static void APIENTRY glad_trace_glReleaseShaderCompiler(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glReleaseShaderCompiler();
+	glad_trace_end(463, glad_trace_start);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_trace_next_glRenderbufferStorage = NULL;
+static void APIENTRY glad_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glRenderbufferStorage(target, internalformat, width, height);
+	glad_trace_end(464, glad_trace_start);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_next_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY glad_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	glad_trace_end(465, glad_trace_start);
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_trace_next_glResumeTransformFeedback = NULL;
+static void APIENTRY glad_trace_glResumeTransformFeedback(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glResumeTransformFeedback();
+	glad_trace_end(466, glad_trace_start);
+}
+static PFNGLSAMPLECOVERAGEPROC glad_trace_next_glSampleCoverage = NULL;
+static void APIENTRY glad_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSampleCoverage(value, invert);
+	glad_trace_end(467, glad_trace_start);
+}
+static PFNGLSAMPLEMASKIPROC glad_trace_next_glSampleMaski = NULL;
+static void APIENTRY glad_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSampleMaski(maskNumber, mask);
+	glad_trace_end(468, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_trace_next_glSamplerParameterIiv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameterIiv(sampler, pname, param);
+	glad_trace_end(469, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_trace_next_glSamplerParameterIuiv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameterIuiv(sampler, pname, param);
+	glad_trace_end(470, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_trace_next_glSamplerParameterf = NULL;
+static void APIENTRY glad_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameterf(sampler, pname, param);
+	glad_trace_end(471, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_trace_next_glSamplerParameterfv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameterfv(sampler, pname, param);
+	glad_trace_end(472, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_trace_next_glSamplerParameteri = NULL;
+static void APIENTRY glad_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameteri(sampler, pname, param);
+	glad_trace_end(473, glad_trace_start);
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_trace_next_glSamplerParameteriv = NULL;
+static void APIENTRY glad_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSamplerParameteriv(sampler, pname, param);
+	glad_trace_end(474, glad_trace_start);
+}
+static PFNGLSCISSORPROC glad_trace_next_glScissor = NULL;
+static void APIENTRY glad_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glScissor(x, y, width, height);
+	glad_trace_end(475, glad_trace_start);
+}
+static PFNGLSCISSORARRAYVPROC glad_trace_next_glScissorArrayv = NULL;
+static void APIENTRY glad_trace_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glScissorArrayv(first, count, v);
+	glad_trace_end(476, glad_trace_start);
+}
+static PFNGLSCISSORINDEXEDPROC glad_trace_next_glScissorIndexed = NULL;
+static void APIENTRY glad_trace_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glScissorIndexed(index, left, bottom, width, height);
+	glad_trace_end(477, glad_trace_start);
+}
+static PFNGLSCISSORINDEXEDVPROC glad_trace_next_glScissorIndexedv = NULL;
+static void APIENTRY glad_trace_glScissorIndexedv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glScissorIndexedv(index, v);
+	glad_trace_end(478, glad_trace_start);
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_trace_next_glSecondaryColorP3ui = NULL;
+static void APIENTRY glad_trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSecondaryColorP3ui(type, color);
+	glad_trace_end(479, glad_trace_start);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_trace_next_glSecondaryColorP3uiv = NULL;
+static void APIENTRY glad_trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSecondaryColorP3uiv(type, color);
+	glad_trace_end(480, glad_trace_start);
+}
+static PFNGLSHADERBINARYPROC glad_trace_next_glShaderBinary = NULL;
+static void APIENTRY glad_trace_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glShaderBinary(count, shaders, binaryFormat, binary, length);
+	glad_trace_end(481, glad_trace_start);
+}
+static PFNGLSHADERSOURCEPROC glad_trace_next_glShaderSource = NULL;
+static void APIENTRY glad_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glShaderSource(shader, count, string, length);
+	glad_trace_end(482, glad_trace_start);
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_trace_next_glShaderStorageBlockBinding = NULL;
+static void APIENTRY glad_trace_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	glad_trace_end(483, glad_trace_start);
+}
+static PFNGLSPECIALIZESHADERPROC glad_trace_next_glSpecializeShader = NULL;
+static void APIENTRY glad_trace_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+	glad_trace_end(484, glad_trace_start);
+}
+static PFNGLSTENCILFUNCPROC glad_trace_next_glStencilFunc = NULL;
+static void APIENTRY glad_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilFunc(func, ref, mask);
+	glad_trace_end(485, glad_trace_start);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_trace_next_glStencilFuncSeparate = NULL;
+static void APIENTRY glad_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilFuncSeparate(face, func, ref, mask);
+	glad_trace_end(486, glad_trace_start);
+}
+static PFNGLSTENCILMASKPROC glad_trace_next_glStencilMask = NULL;
+static void APIENTRY glad_trace_glStencilMask(GLuint mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilMask(mask);
+	glad_trace_end(487, glad_trace_start);
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_trace_next_glStencilMaskSeparate = NULL;
+static void APIENTRY glad_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilMaskSeparate(face, mask);
+	glad_trace_end(488, glad_trace_start);
+}
+static PFNGLSTENCILOPPROC glad_trace_next_glStencilOp = NULL;
+static void APIENTRY glad_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilOp(fail, zfail, zpass);
+	glad_trace_end(489, glad_trace_start);
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_trace_next_glStencilOpSeparate = NULL;
+static void APIENTRY glad_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	glad_trace_end(490, glad_trace_start);
+}
+static PFNGLTEXBUFFERPROC glad_trace_next_glTexBuffer = NULL;
+static void APIENTRY glad_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexBuffer(target, internalformat, buffer);
+	glad_trace_end(491, glad_trace_start);
+}
+static PFNGLTEXBUFFERRANGEPROC glad_trace_next_glTexBufferRange = NULL;
+static void APIENTRY glad_trace_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexBufferRange(target, internalformat, buffer, offset, size);
+	glad_trace_end(492, glad_trace_start);
+}
+static PFNGLTEXCOORDP1UIPROC glad_trace_next_glTexCoordP1ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP1ui(type, coords);
+	glad_trace_end(493, glad_trace_start);
+}
+static PFNGLTEXCOORDP1UIVPROC glad_trace_next_glTexCoordP1uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP1uiv(type, coords);
+	glad_trace_end(494, glad_trace_start);
+}
+static PFNGLTEXCOORDP2UIPROC glad_trace_next_glTexCoordP2ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP2ui(type, coords);
+	glad_trace_end(495, glad_trace_start);
+}
+static PFNGLTEXCOORDP2UIVPROC glad_trace_next_glTexCoordP2uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP2uiv(type, coords);
+	glad_trace_end(496, glad_trace_start);
+}
+static PFNGLTEXCOORDP3UIPROC glad_trace_next_glTexCoordP3ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP3ui(type, coords);
+	glad_trace_end(497, glad_trace_start);
+}
+static PFNGLTEXCOORDP3UIVPROC glad_trace_next_glTexCoordP3uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP3uiv(type, coords);
+	glad_trace_end(498, glad_trace_start);
+}
+static PFNGLTEXCOORDP4UIPROC glad_trace_next_glTexCoordP4ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP4ui(type, coords);
+	glad_trace_end(499, glad_trace_start);
+}
+static PFNGLTEXCOORDP4UIVPROC glad_trace_next_glTexCoordP4uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexCoordP4uiv(type, coords);
+	glad_trace_end(500, glad_trace_start);
+}
+static PFNGLTEXIMAGE1DPROC glad_trace_next_glTexImage1D = NULL;
+static void APIENTRY glad_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	glad_trace_end(501, glad_trace_start);
+}
+static PFNGLTEXIMAGE2DPROC glad_trace_next_glTexImage2D = NULL;
+static void APIENTRY glad_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	glad_trace_end(502, glad_trace_start);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_trace_next_glTexImage2DMultisample = NULL;
+static void APIENTRY glad_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	glad_trace_end(503, glad_trace_start);
+}
+static PFNGLTEXIMAGE3DPROC glad_trace_next_glTexImage3D = NULL;
+static void APIENTRY glad_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	glad_trace_end(504, glad_trace_start);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_trace_next_glTexImage3DMultisample = NULL;
+static void APIENTRY glad_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	glad_trace_end(505, glad_trace_start);
+}
+static PFNGLTEXPARAMETERIIVPROC glad_trace_next_glTexParameterIiv = NULL;
+static void APIENTRY glad_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameterIiv(target, pname, params);
+	glad_trace_end(506, glad_trace_start);
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_trace_next_glTexParameterIuiv = NULL;
+static void APIENTRY glad_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameterIuiv(target, pname, params);
+	glad_trace_end(507, glad_trace_start);
+}
+static PFNGLTEXPARAMETERFPROC glad_trace_next_glTexParameterf = NULL;
+static void APIENTRY glad_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameterf(target, pname, param);
+	glad_trace_end(508, glad_trace_start);
+}
+static PFNGLTEXPARAMETERFVPROC glad_trace_next_glTexParameterfv = NULL;
+static void APIENTRY glad_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameterfv(target, pname, params);
+	glad_trace_end(509, glad_trace_start);
+}
+static PFNGLTEXPARAMETERIPROC glad_trace_next_glTexParameteri = NULL;
+static void APIENTRY glad_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameteri(target, pname, param);
+	glad_trace_end(510, glad_trace_start);
+}
+static PFNGLTEXPARAMETERIVPROC glad_trace_next_glTexParameteriv = NULL;
+static void APIENTRY glad_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexParameteriv(target, pname, params);
+	glad_trace_end(511, glad_trace_start);
+}
+static PFNGLTEXSTORAGE1DPROC glad_trace_next_glTexStorage1D = NULL;
+static void APIENTRY glad_trace_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexStorage1D(target, levels, internalformat, width);
+	glad_trace_end(512, glad_trace_start);
+}
+static PFNGLTEXSTORAGE2DPROC glad_trace_next_glTexStorage2D = NULL;
+static void APIENTRY glad_trace_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexStorage2D(target, levels, internalformat, width, height);
+	glad_trace_end(513, glad_trace_start);
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_trace_next_glTexStorage2DMultisample = NULL;
+static void APIENTRY glad_trace_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	glad_trace_end(514, glad_trace_start);
+}
+static PFNGLTEXSTORAGE3DPROC glad_trace_next_glTexStorage3D = NULL;
+static void APIENTRY glad_trace_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexStorage3D(target, levels, internalformat, width, height, depth);
+	glad_trace_end(515, glad_trace_start);
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_trace_next_glTexStorage3DMultisample = NULL;
+static void APIENTRY glad_trace_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	glad_trace_end(516, glad_trace_start);
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_trace_next_glTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	glad_trace_end(517, glad_trace_start);
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_trace_next_glTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	glad_trace_end(518, glad_trace_start);
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_trace_next_glTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	glad_trace_end(519, glad_trace_start);
+}
+static PFNGLTEXTUREBARRIERPROC glad_trace_next_glTextureBarrier = NULL;
+static void APIENTRY glad_trace_glTextureBarrier(void) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureBarrier();
+	glad_trace_end(520, glad_trace_start);
+}
+static PFNGLTEXTUREBUFFERPROC glad_trace_next_glTextureBuffer = NULL;
+static void APIENTRY glad_trace_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureBuffer(texture, internalformat, buffer);
+	glad_trace_end(521, glad_trace_start);
+}
+static PFNGLTEXTUREBUFFERRANGEPROC glad_trace_next_glTextureBufferRange = NULL;
+static void APIENTRY glad_trace_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+	glad_trace_end(522, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERIIVPROC glad_trace_next_glTextureParameterIiv = NULL;
+static void APIENTRY glad_trace_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameterIiv(texture, pname, params);
+	glad_trace_end(523, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_trace_next_glTextureParameterIuiv = NULL;
+static void APIENTRY glad_trace_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameterIuiv(texture, pname, params);
+	glad_trace_end(524, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERFPROC glad_trace_next_glTextureParameterf = NULL;
+static void APIENTRY glad_trace_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameterf(texture, pname, param);
+	glad_trace_end(525, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERFVPROC glad_trace_next_glTextureParameterfv = NULL;
+static void APIENTRY glad_trace_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameterfv(texture, pname, param);
+	glad_trace_end(526, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERIPROC glad_trace_next_glTextureParameteri = NULL;
+static void APIENTRY glad_trace_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameteri(texture, pname, param);
+	glad_trace_end(527, glad_trace_start);
+}
+static PFNGLTEXTUREPARAMETERIVPROC glad_trace_next_glTextureParameteriv = NULL;
+static void APIENTRY glad_trace_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureParameteriv(texture, pname, param);
+	glad_trace_end(528, glad_trace_start);
+}
+static PFNGLTEXTURESTORAGE1DPROC glad_trace_next_glTextureStorage1D = NULL;
+static void APIENTRY glad_trace_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureStorage1D(texture, levels, internalformat, width);
+	glad_trace_end(529, glad_trace_start);
+}
+static PFNGLTEXTURESTORAGE2DPROC glad_trace_next_glTextureStorage2D = NULL;
+static void APIENTRY glad_trace_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureStorage2D(texture, levels, internalformat, width, height);
+	glad_trace_end(530, glad_trace_start);
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_trace_next_glTextureStorage2DMultisample = NULL;
+static void APIENTRY glad_trace_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	glad_trace_end(531, glad_trace_start);
+}
+static PFNGLTEXTURESTORAGE3DPROC glad_trace_next_glTextureStorage3D = NULL;
+static void APIENTRY glad_trace_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+	glad_trace_end(532, glad_trace_start);
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_trace_next_glTextureStorage3DMultisample = NULL;
+static void APIENTRY glad_trace_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	glad_trace_end(533, glad_trace_start);
+}
+static PFNGLTEXTURESUBIMAGE1DPROC glad_trace_next_glTextureSubImage1D = NULL;
+static void APIENTRY glad_trace_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	glad_trace_end(534, glad_trace_start);
+}
+static PFNGLTEXTURESUBIMAGE2DPROC glad_trace_next_glTextureSubImage2D = NULL;
+static void APIENTRY glad_trace_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	glad_trace_end(535, glad_trace_start);
+}
+static PFNGLTEXTURESUBIMAGE3DPROC glad_trace_next_glTextureSubImage3D = NULL;
+static void APIENTRY glad_trace_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	glad_trace_end(536, glad_trace_start);
+}
+static PFNGLTEXTUREVIEWPROC glad_trace_next_glTextureView = NULL;
+static void APIENTRY glad_trace_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	glad_trace_end(537, glad_trace_start);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_trace_next_glTransformFeedbackBufferBase = NULL;
+static void APIENTRY glad_trace_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTransformFeedbackBufferBase(xfb, index, buffer);
+	glad_trace_end(538, glad_trace_start);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_trace_next_glTransformFeedbackBufferRange = NULL;
+static void APIENTRY glad_trace_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	glad_trace_end(539, glad_trace_start);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_trace_next_glTransformFeedbackVaryings = NULL;
+static void APIENTRY glad_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	glad_trace_end(540, glad_trace_start);
+}
+static PFNGLUNIFORM1DPROC glad_trace_next_glUniform1d = NULL;
+static void APIENTRY glad_trace_glUniform1d(GLint location, GLdouble x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1d(location, x);
+	glad_trace_end(541, glad_trace_start);
+}
+static PFNGLUNIFORM1DVPROC glad_trace_next_glUniform1dv = NULL;
+static void APIENTRY glad_trace_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1dv(location, count, value);
+	glad_trace_end(542, glad_trace_start);
+}
+static PFNGLUNIFORM1FPROC glad_trace_next_glUniform1f = NULL;
+static void APIENTRY glad_trace_glUniform1f(GLint location, GLfloat v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1f(location, v0);
+	glad_trace_end(543, glad_trace_start);
+}
+static PFNGLUNIFORM1FVPROC glad_trace_next_glUniform1fv = NULL;
+static void APIENTRY glad_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1fv(location, count, value);
+	glad_trace_end(544, glad_trace_start);
+}
+static PFNGLUNIFORM1IPROC glad_trace_next_glUniform1i = NULL;
+static void APIENTRY glad_trace_glUniform1i(GLint location, GLint v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1i(location, v0);
+	glad_trace_end(545, glad_trace_start);
+}
+static PFNGLUNIFORM1IVPROC glad_trace_next_glUniform1iv = NULL;
+static void APIENTRY glad_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1iv(location, count, value);
+	glad_trace_end(546, glad_trace_start);
+}
+static PFNGLUNIFORM1UIPROC glad_trace_next_glUniform1ui = NULL;
+static void APIENTRY glad_trace_glUniform1ui(GLint location, GLuint v0) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1ui(location, v0);
+	glad_trace_end(547, glad_trace_start);
+}
+static PFNGLUNIFORM1UIVPROC glad_trace_next_glUniform1uiv = NULL;
+static void APIENTRY glad_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform1uiv(location, count, value);
+	glad_trace_end(548, glad_trace_start);
+}
+static PFNGLUNIFORM2DPROC glad_trace_next_glUniform2d = NULL;
+static void APIENTRY glad_trace_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2d(location, x, y);
+	glad_trace_end(549, glad_trace_start);
+}
+static PFNGLUNIFORM2DVPROC glad_trace_next_glUniform2dv = NULL;
+static void APIENTRY glad_trace_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2dv(location, count, value);
+	glad_trace_end(550, glad_trace_start);
+}
+static PFNGLUNIFORM2FPROC glad_trace_next_glUniform2f = NULL;
+static void APIENTRY glad_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2f(location, v0, v1);
+	glad_trace_end(551, glad_trace_start);
+}
+static PFNGLUNIFORM2FVPROC glad_trace_next_glUniform2fv = NULL;
+static void APIENTRY glad_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2fv(location, count, value);
+	glad_trace_end(552, glad_trace_start);
+}
+static PFNGLUNIFORM2IPROC glad_trace_next_glUniform2i = NULL;
+static void APIENTRY glad_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2i(location, v0, v1);
+	glad_trace_end(553, glad_trace_start);
+}
+static PFNGLUNIFORM2IVPROC glad_trace_next_glUniform2iv = NULL;
+static void APIENTRY glad_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2iv(location, count, value);
+	glad_trace_end(554, glad_trace_start);
+}
+static PFNGLUNIFORM2UIPROC glad_trace_next_glUniform2ui = NULL;
+static void APIENTRY glad_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2ui(location, v0, v1);
+	glad_trace_end(555, glad_trace_start);
+}
+static PFNGLUNIFORM2UIVPROC glad_trace_next_glUniform2uiv = NULL;
+static void APIENTRY glad_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform2uiv(location, count, value);
+	glad_trace_end(556, glad_trace_start);
+}
+static PFNGLUNIFORM3DPROC glad_trace_next_glUniform3d = NULL;
+static void APIENTRY glad_trace_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3d(location, x, y, z);
+	glad_trace_end(557, glad_trace_start);
+}
+static PFNGLUNIFORM3DVPROC glad_trace_next_glUniform3dv = NULL;
+static void APIENTRY glad_trace_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3dv(location, count, value);
+	glad_trace_end(558, glad_trace_start);
+}
+static PFNGLUNIFORM3FPROC glad_trace_next_glUniform3f = NULL;
+static void APIENTRY glad_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3f(location, v0, v1, v2);
+	glad_trace_end(559, glad_trace_start);
+}
+static PFNGLUNIFORM3FVPROC glad_trace_next_glUniform3fv = NULL;
+static void APIENTRY glad_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3fv(location, count, value);
+	glad_trace_end(560, glad_trace_start);
+}
+static PFNGLUNIFORM3IPROC glad_trace_next_glUniform3i = NULL;
+static void APIENTRY glad_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3i(location, v0, v1, v2);
+	glad_trace_end(561, glad_trace_start);
+}
+static PFNGLUNIFORM3IVPROC glad_trace_next_glUniform3iv = NULL;
+static void APIENTRY glad_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3iv(location, count, value);
+	glad_trace_end(562, glad_trace_start);
+}
+static PFNGLUNIFORM3UIPROC glad_trace_next_glUniform3ui = NULL;
+static void APIENTRY glad_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3ui(location, v0, v1, v2);
+	glad_trace_end(563, glad_trace_start);
+}
+static PFNGLUNIFORM3UIVPROC glad_trace_next_glUniform3uiv = NULL;
+static void APIENTRY glad_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform3uiv(location, count, value);
+	glad_trace_end(564, glad_trace_start);
+}
+static PFNGLUNIFORM4DPROC glad_trace_next_glUniform4d = NULL;
+static void APIENTRY glad_trace_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4d(location, x, y, z, w);
+	glad_trace_end(565, glad_trace_start);
+}
+static PFNGLUNIFORM4DVPROC glad_trace_next_glUniform4dv = NULL;
+static void APIENTRY glad_trace_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4dv(location, count, value);
+	glad_trace_end(566, glad_trace_start);
+}
+static PFNGLUNIFORM4FPROC glad_trace_next_glUniform4f = NULL;
+static void APIENTRY glad_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4f(location, v0, v1, v2, v3);
+	glad_trace_end(567, glad_trace_start);
+}
+static PFNGLUNIFORM4FVPROC glad_trace_next_glUniform4fv = NULL;
+static void APIENTRY glad_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4fv(location, count, value);
+	glad_trace_end(568, glad_trace_start);
+}
+static PFNGLUNIFORM4IPROC glad_trace_next_glUniform4i = NULL;
+static void APIENTRY glad_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4i(location, v0, v1, v2, v3);
+	glad_trace_end(569, glad_trace_start);
+}
+static PFNGLUNIFORM4IVPROC glad_trace_next_glUniform4iv = NULL;
+static void APIENTRY glad_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4iv(location, count, value);
+	glad_trace_end(570, glad_trace_start);
+}
+static PFNGLUNIFORM4UIPROC glad_trace_next_glUniform4ui = NULL;
+static void APIENTRY glad_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4ui(location, v0, v1, v2, v3);
+	glad_trace_end(571, glad_trace_start);
+}
+static PFNGLUNIFORM4UIVPROC glad_trace_next_glUniform4uiv = NULL;
+static void APIENTRY glad_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniform4uiv(location, count, value);
+	glad_trace_end(572, glad_trace_start);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_trace_next_glUniformBlockBinding = NULL;
+static void APIENTRY glad_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	glad_trace_end(573, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2DVPROC glad_trace_next_glUniformMatrix2dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2dv(location, count, transpose, value);
+	glad_trace_end(574, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_trace_next_glUniformMatrix2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2fv(location, count, transpose, value);
+	glad_trace_end(575, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_trace_next_glUniformMatrix2x3dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2x3dv(location, count, transpose, value);
+	glad_trace_end(576, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_trace_next_glUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2x3fv(location, count, transpose, value);
+	glad_trace_end(577, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_trace_next_glUniformMatrix2x4dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2x4dv(location, count, transpose, value);
+	glad_trace_end(578, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_trace_next_glUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix2x4fv(location, count, transpose, value);
+	glad_trace_end(579, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3DVPROC glad_trace_next_glUniformMatrix3dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3dv(location, count, transpose, value);
+	glad_trace_end(580, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_trace_next_glUniformMatrix3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3fv(location, count, transpose, value);
+	glad_trace_end(581, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_trace_next_glUniformMatrix3x2dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3x2dv(location, count, transpose, value);
+	glad_trace_end(582, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_trace_next_glUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3x2fv(location, count, transpose, value);
+	glad_trace_end(583, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_trace_next_glUniformMatrix3x4dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3x4dv(location, count, transpose, value);
+	glad_trace_end(584, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_trace_next_glUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix3x4fv(location, count, transpose, value);
+	glad_trace_end(585, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4DVPROC glad_trace_next_glUniformMatrix4dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4dv(location, count, transpose, value);
+	glad_trace_end(586, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_trace_next_glUniformMatrix4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4fv(location, count, transpose, value);
+	glad_trace_end(587, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_trace_next_glUniformMatrix4x2dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4x2dv(location, count, transpose, value);
+	glad_trace_end(588, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_trace_next_glUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4x2fv(location, count, transpose, value);
+	glad_trace_end(589, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_trace_next_glUniformMatrix4x3dv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4x3dv(location, count, transpose, value);
+	glad_trace_end(590, glad_trace_start);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_trace_next_glUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformMatrix4x3fv(location, count, transpose, value);
+	glad_trace_end(591, glad_trace_start);
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_trace_next_glUniformSubroutinesuiv = NULL;
+static void APIENTRY glad_trace_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUniformSubroutinesuiv(shadertype, count, indices);
+	glad_trace_end(592, glad_trace_start);
+}
+static PFNGLUNMAPBUFFERPROC glad_trace_next_glUnmapBuffer = NULL;
+static GLboolean APIENTRY glad_trace_glUnmapBuffer(GLenum target) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glUnmapBuffer(target);
+	glad_trace_end(593, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLUNMAPNAMEDBUFFERPROC glad_trace_next_glUnmapNamedBuffer = NULL;
+static GLboolean APIENTRY glad_trace_glUnmapNamedBuffer(GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	GLboolean glad_trace_ret = glad_trace_next_glUnmapNamedBuffer(buffer);
+	glad_trace_end(594, glad_trace_start);
+	return glad_trace_ret;
+}
+static PFNGLUSEPROGRAMPROC glad_trace_next_glUseProgram = NULL;
+static void APIENTRY glad_trace_glUseProgram(GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUseProgram(program);
+	glad_trace_end(595, glad_trace_start);
+}
+static PFNGLUSEPROGRAMSTAGESPROC glad_trace_next_glUseProgramStages = NULL;
+static void APIENTRY glad_trace_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glUseProgramStages(pipeline, stages, program);
+	glad_trace_end(596, glad_trace_start);
+}
+static PFNGLVALIDATEPROGRAMPROC glad_trace_next_glValidateProgram = NULL;
+static void APIENTRY glad_trace_glValidateProgram(GLuint program) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glValidateProgram(program);
+	glad_trace_end(597, glad_trace_start);
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_trace_next_glValidateProgramPipeline = NULL;
+static void APIENTRY glad_trace_glValidateProgramPipeline(GLuint pipeline) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glValidateProgramPipeline(pipeline);
+	glad_trace_end(598, glad_trace_start);
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_trace_next_glVertexArrayAttribBinding = NULL;
+static void APIENTRY glad_trace_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	glad_trace_end(599, glad_trace_start);
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_trace_next_glVertexArrayAttribFormat = NULL;
+static void APIENTRY glad_trace_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	glad_trace_end(600, glad_trace_start);
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_trace_next_glVertexArrayAttribIFormat = NULL;
+static void APIENTRY glad_trace_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	glad_trace_end(601, glad_trace_start);
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_trace_next_glVertexArrayAttribLFormat = NULL;
+static void APIENTRY glad_trace_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	glad_trace_end(602, glad_trace_start);
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_trace_next_glVertexArrayBindingDivisor = NULL;
+static void APIENTRY glad_trace_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	glad_trace_end(603, glad_trace_start);
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_trace_next_glVertexArrayElementBuffer = NULL;
+static void APIENTRY glad_trace_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayElementBuffer(vaobj, buffer);
+	glad_trace_end(604, glad_trace_start);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_trace_next_glVertexArrayVertexBuffer = NULL;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	glad_trace_end(605, glad_trace_start);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_trace_next_glVertexArrayVertexBuffers = NULL;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	glad_trace_end(606, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1DPROC glad_trace_next_glVertexAttrib1d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1d(index, x);
+	glad_trace_end(607, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_trace_next_glVertexAttrib1dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1dv(index, v);
+	glad_trace_end(608, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1FPROC glad_trace_next_glVertexAttrib1f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1f(index, x);
+	glad_trace_end(609, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_trace_next_glVertexAttrib1fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1fv(index, v);
+	glad_trace_end(610, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1SPROC glad_trace_next_glVertexAttrib1s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1s(index, x);
+	glad_trace_end(611, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_trace_next_glVertexAttrib1sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib1sv(index, v);
+	glad_trace_end(612, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2DPROC glad_trace_next_glVertexAttrib2d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2d(index, x, y);
+	glad_trace_end(613, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_trace_next_glVertexAttrib2dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2dv(index, v);
+	glad_trace_end(614, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2FPROC glad_trace_next_glVertexAttrib2f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2f(index, x, y);
+	glad_trace_end(615, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_trace_next_glVertexAttrib2fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2fv(index, v);
+	glad_trace_end(616, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2SPROC glad_trace_next_glVertexAttrib2s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2s(index, x, y);
+	glad_trace_end(617, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_trace_next_glVertexAttrib2sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib2sv(index, v);
+	glad_trace_end(618, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3DPROC glad_trace_next_glVertexAttrib3d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3d(index, x, y, z);
+	glad_trace_end(619, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_trace_next_glVertexAttrib3dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3dv(index, v);
+	glad_trace_end(620, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3FPROC glad_trace_next_glVertexAttrib3f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3f(index, x, y, z);
+	glad_trace_end(621, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_trace_next_glVertexAttrib3fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3fv(index, v);
+	glad_trace_end(622, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3SPROC glad_trace_next_glVertexAttrib3s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3s(index, x, y, z);
+	glad_trace_end(623, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_trace_next_glVertexAttrib3sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib3sv(index, v);
+	glad_trace_end(624, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_trace_next_glVertexAttrib4Nbv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nbv(index, v);
+	glad_trace_end(625, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_trace_next_glVertexAttrib4Niv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Niv(index, v);
+	glad_trace_end(626, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_trace_next_glVertexAttrib4Nsv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nsv(index, v);
+	glad_trace_end(627, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_trace_next_glVertexAttrib4Nub = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nub(index, x, y, z, w);
+	glad_trace_end(628, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_trace_next_glVertexAttrib4Nubv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nubv(index, v);
+	glad_trace_end(629, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_trace_next_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nuiv(index, v);
+	glad_trace_end(630, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_trace_next_glVertexAttrib4Nusv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4Nusv(index, v);
+	glad_trace_end(631, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_trace_next_glVertexAttrib4bv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4bv(index, v);
+	glad_trace_end(632, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4DPROC glad_trace_next_glVertexAttrib4d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4d(index, x, y, z, w);
+	glad_trace_end(633, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_trace_next_glVertexAttrib4dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4dv(index, v);
+	glad_trace_end(634, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4FPROC glad_trace_next_glVertexAttrib4f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4f(index, x, y, z, w);
+	glad_trace_end(635, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_trace_next_glVertexAttrib4fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4fv(index, v);
+	glad_trace_end(636, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_trace_next_glVertexAttrib4iv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4iv(index, v);
+	glad_trace_end(637, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4SPROC glad_trace_next_glVertexAttrib4s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4s(index, x, y, z, w);
+	glad_trace_end(638, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_trace_next_glVertexAttrib4sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4sv(index, v);
+	glad_trace_end(639, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_trace_next_glVertexAttrib4ubv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4ubv(index, v);
+	glad_trace_end(640, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_trace_next_glVertexAttrib4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4uiv(index, v);
+	glad_trace_end(641, glad_trace_start);
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_trace_next_glVertexAttrib4usv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttrib4usv(index, v);
+	glad_trace_end(642, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBBINDINGPROC glad_trace_next_glVertexAttribBinding = NULL;
+static void APIENTRY glad_trace_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribBinding(attribindex, bindingindex);
+	glad_trace_end(643, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_trace_next_glVertexAttribDivisor = NULL;
+static void APIENTRY glad_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribDivisor(index, divisor);
+	glad_trace_end(644, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBFORMATPROC glad_trace_next_glVertexAttribFormat = NULL;
+static void APIENTRY glad_trace_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	glad_trace_end(645, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_trace_next_glVertexAttribI1i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1i(GLuint index, GLint x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI1i(index, x);
+	glad_trace_end(646, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_trace_next_glVertexAttribI1iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI1iv(index, v);
+	glad_trace_end(647, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_trace_next_glVertexAttribI1ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI1ui(index, x);
+	glad_trace_end(648, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_trace_next_glVertexAttribI1uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI1uiv(index, v);
+	glad_trace_end(649, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_trace_next_glVertexAttribI2i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI2i(index, x, y);
+	glad_trace_end(650, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_trace_next_glVertexAttribI2iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI2iv(index, v);
+	glad_trace_end(651, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_trace_next_glVertexAttribI2ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI2ui(index, x, y);
+	glad_trace_end(652, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_trace_next_glVertexAttribI2uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI2uiv(index, v);
+	glad_trace_end(653, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_trace_next_glVertexAttribI3i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI3i(index, x, y, z);
+	glad_trace_end(654, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_trace_next_glVertexAttribI3iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI3iv(index, v);
+	glad_trace_end(655, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_trace_next_glVertexAttribI3ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI3ui(index, x, y, z);
+	glad_trace_end(656, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_trace_next_glVertexAttribI3uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI3uiv(index, v);
+	glad_trace_end(657, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_trace_next_glVertexAttribI4bv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4bv(index, v);
+	glad_trace_end(658, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_trace_next_glVertexAttribI4i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4i(index, x, y, z, w);
+	glad_trace_end(659, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_trace_next_glVertexAttribI4iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4iv(index, v);
+	glad_trace_end(660, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_trace_next_glVertexAttribI4sv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4sv(index, v);
+	glad_trace_end(661, glad_trace_start);
 }
-static void load_GL_VERSION_4_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_3) return;
-	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
-	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
-	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
-	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
-	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
-	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
-	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
-	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
-	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
-	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
-	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
-	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
-	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
-	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
-	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
-	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
-	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
-	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
-	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
-	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
-	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
-	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
-	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
-	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
-	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
-	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
-	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
-	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
-	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
-	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
-	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
-	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
-	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
-	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
-	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
-	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
-	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
-	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
-	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
-	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
-	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
-	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
-	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
-	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+static PFNGLVERTEXATTRIBI4UBVPROC glad_trace_next_glVertexAttribI4ubv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4ubv(index, v);
+	glad_trace_end(662, glad_trace_start);
 }
-static void load_GL_VERSION_4_4(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_4) return;
-	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
-	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
-	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
-	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
-	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
-	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
-	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
-	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
-	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+static PFNGLVERTEXATTRIBI4UIPROC glad_trace_next_glVertexAttribI4ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4ui(index, x, y, z, w);
+	glad_trace_end(663, glad_trace_start);
 }
-static void load_GL_VERSION_4_5(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_5) return;
-	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
-	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
-	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
-	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
-	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
-	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
-	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
-	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
-	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
-	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
-	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
-	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
-	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
-	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
-	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
-	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
-	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
-	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
-	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
-	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
-	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
-	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
-	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
-	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
-	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
-	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
-	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
-	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
-	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
-	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
-	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
-	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
-	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
-	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
-	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
-	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
-	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
-	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
-	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
-	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
-	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
-	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
-	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
-	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
-	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
-	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
-	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
-	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
-	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
-	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
-	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
-	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
-	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
-	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
-	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
-	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
-	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
-	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
-	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
-	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
-	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
-	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
-	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
-	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
-	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
-	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
-	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
-	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
-	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
-	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
-	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
-	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
-	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
-	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
-	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
-	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
-	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
-	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
-	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
-	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
-	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
-	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
-	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
-	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
-	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
-	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
-	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
-	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
-	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
-	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
-	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
-	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
-	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
-	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
-	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
-	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
-	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
-	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
-	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
-	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
-	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
-	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
-	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
-	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
-	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
-	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
-	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
-	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
-	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
-	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)load("glGetnMapdv");
-	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)load("glGetnMapfv");
-	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)load("glGetnMapiv");
-	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)load("glGetnPixelMapfv");
-	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)load("glGetnPixelMapuiv");
-	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)load("glGetnPixelMapusv");
-	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)load("glGetnPolygonStipple");
-	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)load("glGetnColorTable");
-	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)load("glGetnConvolutionFilter");
-	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)load("glGetnSeparableFilter");
-	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)load("glGetnHistogram");
-	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)load("glGetnMinmax");
-	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+static PFNGLVERTEXATTRIBI4UIVPROC glad_trace_next_glVertexAttribI4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4uiv(index, v);
+	glad_trace_end(664, glad_trace_start);
 }
-static void load_GL_VERSION_4_6(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_6) return;
-	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)load("glSpecializeShader");
-	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)load("glMultiDrawArraysIndirectCount");
-	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
-	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
+static PFNGLVERTEXATTRIBI4USVPROC glad_trace_next_glVertexAttribI4usv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribI4usv(index, v);
+	glad_trace_end(665, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBIFORMATPROC glad_trace_next_glVertexAttribIFormat = NULL;
+static void APIENTRY glad_trace_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+	glad_trace_end(666, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_trace_next_glVertexAttribIPointer = NULL;
+static void APIENTRY glad_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribIPointer(index, size, type, stride, pointer);
+	glad_trace_end(667, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL1DPROC glad_trace_next_glVertexAttribL1d = NULL;
+static void APIENTRY glad_trace_glVertexAttribL1d(GLuint index, GLdouble x) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL1d(index, x);
+	glad_trace_end(668, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL1DVPROC glad_trace_next_glVertexAttribL1dv = NULL;
+static void APIENTRY glad_trace_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL1dv(index, v);
+	glad_trace_end(669, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL2DPROC glad_trace_next_glVertexAttribL2d = NULL;
+static void APIENTRY glad_trace_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL2d(index, x, y);
+	glad_trace_end(670, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL2DVPROC glad_trace_next_glVertexAttribL2dv = NULL;
+static void APIENTRY glad_trace_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL2dv(index, v);
+	glad_trace_end(671, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL3DPROC glad_trace_next_glVertexAttribL3d = NULL;
+static void APIENTRY glad_trace_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL3d(index, x, y, z);
+	glad_trace_end(672, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL3DVPROC glad_trace_next_glVertexAttribL3dv = NULL;
+static void APIENTRY glad_trace_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL3dv(index, v);
+	glad_trace_end(673, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL4DPROC glad_trace_next_glVertexAttribL4d = NULL;
+static void APIENTRY glad_trace_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL4d(index, x, y, z, w);
+	glad_trace_end(674, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBL4DVPROC glad_trace_next_glVertexAttribL4dv = NULL;
+static void APIENTRY glad_trace_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribL4dv(index, v);
+	glad_trace_end(675, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBLFORMATPROC glad_trace_next_glVertexAttribLFormat = NULL;
+static void APIENTRY glad_trace_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+	glad_trace_end(676, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_trace_next_glVertexAttribLPointer = NULL;
+static void APIENTRY glad_trace_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribLPointer(index, size, type, stride, pointer);
+	glad_trace_end(677, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_trace_next_glVertexAttribP1ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP1ui(index, type, normalized, value);
+	glad_trace_end(678, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_trace_next_glVertexAttribP1uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP1uiv(index, type, normalized, value);
+	glad_trace_end(679, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_trace_next_glVertexAttribP2ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP2ui(index, type, normalized, value);
+	glad_trace_end(680, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_trace_next_glVertexAttribP2uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP2uiv(index, type, normalized, value);
+	glad_trace_end(681, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_trace_next_glVertexAttribP3ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP3ui(index, type, normalized, value);
+	glad_trace_end(682, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_trace_next_glVertexAttribP3uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP3uiv(index, type, normalized, value);
+	glad_trace_end(683, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_trace_next_glVertexAttribP4ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP4ui(index, type, normalized, value);
+	glad_trace_end(684, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_trace_next_glVertexAttribP4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribP4uiv(index, type, normalized, value);
+	glad_trace_end(685, glad_trace_start);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_trace_next_glVertexAttribPointer = NULL;
+static void APIENTRY glad_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	glad_trace_end(686, glad_trace_start);
+}
+static PFNGLVERTEXBINDINGDIVISORPROC glad_trace_next_glVertexBindingDivisor = NULL;
+static void APIENTRY glad_trace_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexBindingDivisor(bindingindex, divisor);
+	glad_trace_end(687, glad_trace_start);
+}
+static PFNGLVERTEXP2UIPROC glad_trace_next_glVertexP2ui = NULL;
+static void APIENTRY glad_trace_glVertexP2ui(GLenum type, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP2ui(type, value);
+	glad_trace_end(688, glad_trace_start);
 }
+static PFNGLVERTEXP2UIVPROC glad_trace_next_glVertexP2uiv = NULL;
+static void APIENTRY glad_trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP2uiv(type, value);
+	glad_trace_end(689, glad_trace_start);
+}
+static PFNGLVERTEXP3UIPROC glad_trace_next_glVertexP3ui = NULL;
+static void APIENTRY glad_trace_glVertexP3ui(GLenum type, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP3ui(type, value);
+	glad_trace_end(690, glad_trace_start);
+}
+static PFNGLVERTEXP3UIVPROC glad_trace_next_glVertexP3uiv = NULL;
+static void APIENTRY glad_trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP3uiv(type, value);
+	glad_trace_end(691, glad_trace_start);
+}
+static PFNGLVERTEXP4UIPROC glad_trace_next_glVertexP4ui = NULL;
+static void APIENTRY glad_trace_glVertexP4ui(GLenum type, GLuint value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP4ui(type, value);
+	glad_trace_end(692, glad_trace_start);
+}
+static PFNGLVERTEXP4UIVPROC glad_trace_next_glVertexP4uiv = NULL;
+static void APIENTRY glad_trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glVertexP4uiv(type, value);
+	glad_trace_end(693, glad_trace_start);
+}
+static PFNGLVIEWPORTPROC glad_trace_next_glViewport = NULL;
+static void APIENTRY glad_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glViewport(x, y, width, height);
+	glad_trace_end(694, glad_trace_start);
+}
+static PFNGLVIEWPORTARRAYVPROC glad_trace_next_glViewportArrayv = NULL;
+static void APIENTRY glad_trace_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glViewportArrayv(first, count, v);
+	glad_trace_end(695, glad_trace_start);
+}
+static PFNGLVIEWPORTINDEXEDFPROC glad_trace_next_glViewportIndexedf = NULL;
+static void APIENTRY glad_trace_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glViewportIndexedf(index, x, y, w, h);
+	glad_trace_end(696, glad_trace_start);
+}
+static PFNGLVIEWPORTINDEXEDFVPROC glad_trace_next_glViewportIndexedfv = NULL;
+static void APIENTRY glad_trace_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glViewportIndexedfv(index, v);
+	glad_trace_end(697, glad_trace_start);
+}
+static PFNGLWAITSYNCPROC glad_trace_next_glWaitSync = NULL;
+static void APIENTRY glad_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	khronos_uint64_t glad_trace_start = glad_trace_now();
+	glad_trace_next_glWaitSync(sync, flags, timeout);
+	glad_trace_end(698, glad_trace_start);
+}
+#define GLAD_TRACE_WRAP(name) \
+	if(glad_##name != NULL && glad_##name != glad_trace_##name) { \
+		glad_trace_next_##name = glad_##name; \
+		glad_##name = glad_trace_##name; \
+	}
+static void trace_install(void) {
+	GLAD_TRACE_WRAP(glActiveShaderProgram);
+	GLAD_TRACE_WRAP(glActiveTexture);
+	GLAD_TRACE_WRAP(glAttachShader);
+	GLAD_TRACE_WRAP(glBeginConditionalRender);
+	GLAD_TRACE_WRAP(glBeginQuery);
+	GLAD_TRACE_WRAP(glBeginQueryIndexed);
+	GLAD_TRACE_WRAP(glBeginTransformFeedback);
+	GLAD_TRACE_WRAP(glBindAttribLocation);
+	GLAD_TRACE_WRAP(glBindBuffer);
+	GLAD_TRACE_WRAP(glBindBufferBase);
+	GLAD_TRACE_WRAP(glBindBufferRange);
+	GLAD_TRACE_WRAP(glBindBuffersBase);
+	GLAD_TRACE_WRAP(glBindBuffersRange);
+	GLAD_TRACE_WRAP(glBindFragDataLocation);
+	GLAD_TRACE_WRAP(glBindFragDataLocationIndexed);
+	GLAD_TRACE_WRAP(glBindFramebuffer);
+	GLAD_TRACE_WRAP(glBindImageTexture);
+	GLAD_TRACE_WRAP(glBindImageTextures);
+	GLAD_TRACE_WRAP(glBindProgramPipeline);
+	GLAD_TRACE_WRAP(glBindRenderbuffer);
+	GLAD_TRACE_WRAP(glBindSampler);
+	GLAD_TRACE_WRAP(glBindSamplers);
+	GLAD_TRACE_WRAP(glBindTexture);
+	GLAD_TRACE_WRAP(glBindTextureUnit);
+	GLAD_TRACE_WRAP(glBindTextures);
+	GLAD_TRACE_WRAP(glBindTransformFeedback);
+	GLAD_TRACE_WRAP(glBindVertexArray);
+	GLAD_TRACE_WRAP(glBindVertexBuffer);
+	GLAD_TRACE_WRAP(glBindVertexBuffers);
+	GLAD_TRACE_WRAP(glBlendColor);
+	GLAD_TRACE_WRAP(glBlendEquation);
+	GLAD_TRACE_WRAP(glBlendEquationSeparate);
+	GLAD_TRACE_WRAP(glBlendEquationSeparatei);
+	GLAD_TRACE_WRAP(glBlendEquationi);
+	GLAD_TRACE_WRAP(glBlendFunc);
+	GLAD_TRACE_WRAP(glBlendFuncSeparate);
+	GLAD_TRACE_WRAP(glBlendFuncSeparatei);
+	GLAD_TRACE_WRAP(glBlendFunci);
+	GLAD_TRACE_WRAP(glBlitFramebuffer);
+	GLAD_TRACE_WRAP(glBlitNamedFramebuffer);
+	GLAD_TRACE_WRAP(glBufferData);
+	GLAD_TRACE_WRAP(glBufferStorage);
+	GLAD_TRACE_WRAP(glBufferSubData);
+	GLAD_TRACE_WRAP(glCheckFramebufferStatus);
+	GLAD_TRACE_WRAP(glCheckNamedFramebufferStatus);
+	GLAD_TRACE_WRAP(glClampColor);
+	GLAD_TRACE_WRAP(glClear);
+	GLAD_TRACE_WRAP(glClearBufferData);
+	GLAD_TRACE_WRAP(glClearBufferSubData);
+	GLAD_TRACE_WRAP(glClearBufferfi);
+	GLAD_TRACE_WRAP(glClearBufferfv);
+	GLAD_TRACE_WRAP(glClearBufferiv);
+	GLAD_TRACE_WRAP(glClearBufferuiv);
+	GLAD_TRACE_WRAP(glClearColor);
+	GLAD_TRACE_WRAP(glClearDepth);
+	GLAD_TRACE_WRAP(glClearDepthf);
+	GLAD_TRACE_WRAP(glClearNamedBufferData);
+	GLAD_TRACE_WRAP(glClearNamedBufferSubData);
+	GLAD_TRACE_WRAP(glClearNamedFramebufferfi);
+	GLAD_TRACE_WRAP(glClearNamedFramebufferfv);
+	GLAD_TRACE_WRAP(glClearNamedFramebufferiv);
+	GLAD_TRACE_WRAP(glClearNamedFramebufferuiv);
+	GLAD_TRACE_WRAP(glClearStencil);
+	GLAD_TRACE_WRAP(glClearTexImage);
+	GLAD_TRACE_WRAP(glClearTexSubImage);
+	GLAD_TRACE_WRAP(glClientWaitSync);
+	GLAD_TRACE_WRAP(glClipControl);
+	GLAD_TRACE_WRAP(glColorMask);
+	GLAD_TRACE_WRAP(glColorMaski);
+	GLAD_TRACE_WRAP(glColorP3ui);
+	GLAD_TRACE_WRAP(glColorP3uiv);
+	GLAD_TRACE_WRAP(glColorP4ui);
+	GLAD_TRACE_WRAP(glColorP4uiv);
+	GLAD_TRACE_WRAP(glCompileShader);
+	GLAD_TRACE_WRAP(glCompressedTexImage1D);
+	GLAD_TRACE_WRAP(glCompressedTexImage2D);
+	GLAD_TRACE_WRAP(glCompressedTexImage3D);
+	GLAD_TRACE_WRAP(glCompressedTexSubImage1D);
+	GLAD_TRACE_WRAP(glCompressedTexSubImage2D);
+	GLAD_TRACE_WRAP(glCompressedTexSubImage3D);
+	GLAD_TRACE_WRAP(glCompressedTextureSubImage1D);
+	GLAD_TRACE_WRAP(glCompressedTextureSubImage2D);
+	GLAD_TRACE_WRAP(glCompressedTextureSubImage3D);
+	GLAD_TRACE_WRAP(glCopyBufferSubData);
+	GLAD_TRACE_WRAP(glCopyImageSubData);
+	GLAD_TRACE_WRAP(glCopyNamedBufferSubData);
+	GLAD_TRACE_WRAP(glCopyTexImage1D);
+	GLAD_TRACE_WRAP(glCopyTexImage2D);
+	GLAD_TRACE_WRAP(glCopyTexSubImage1D);
+	GLAD_TRACE_WRAP(glCopyTexSubImage2D);
+	GLAD_TRACE_WRAP(glCopyTexSubImage3D);
+	GLAD_TRACE_WRAP(glCopyTextureSubImage1D);
+	GLAD_TRACE_WRAP(glCopyTextureSubImage2D);
+	GLAD_TRACE_WRAP(glCopyTextureSubImage3D);
+	GLAD_TRACE_WRAP(glCreateBuffers);
+	GLAD_TRACE_WRAP(glCreateFramebuffers);
+	GLAD_TRACE_WRAP(glCreateProgram);
+	GLAD_TRACE_WRAP(glCreateProgramPipelines);
+	GLAD_TRACE_WRAP(glCreateQueries);
+	GLAD_TRACE_WRAP(glCreateRenderbuffers);
+	GLAD_TRACE_WRAP(glCreateSamplers);
+	GLAD_TRACE_WRAP(glCreateShader);
+	GLAD_TRACE_WRAP(glCreateShaderProgramv);
+	GLAD_TRACE_WRAP(glCreateTextures);
+	GLAD_TRACE_WRAP(glCreateTransformFeedbacks);
+	GLAD_TRACE_WRAP(glCreateVertexArrays);
+	GLAD_TRACE_WRAP(glCullFace);
+	GLAD_TRACE_WRAP(glDebugMessageCallback);
+	GLAD_TRACE_WRAP(glDebugMessageControl);
+	GLAD_TRACE_WRAP(glDebugMessageInsert);
+	GLAD_TRACE_WRAP(glDeleteBuffers);
+	GLAD_TRACE_WRAP(glDeleteFramebuffers);
+	GLAD_TRACE_WRAP(glDeleteProgram);
+	GLAD_TRACE_WRAP(glDeleteProgramPipelines);
+	GLAD_TRACE_WRAP(glDeleteQueries);
+	GLAD_TRACE_WRAP(glDeleteRenderbuffers);
+	GLAD_TRACE_WRAP(glDeleteSamplers);
+	GLAD_TRACE_WRAP(glDeleteShader);
+	GLAD_TRACE_WRAP(glDeleteSync);
+	GLAD_TRACE_WRAP(glDeleteTextures);
+	GLAD_TRACE_WRAP(glDeleteTransformFeedbacks);
+	GLAD_TRACE_WRAP(glDeleteVertexArrays);
+	GLAD_TRACE_WRAP(glDepthFunc);
+	GLAD_TRACE_WRAP(glDepthMask);
+	GLAD_TRACE_WRAP(glDepthRange);
+	GLAD_TRACE_WRAP(glDepthRangeArrayv);
+	GLAD_TRACE_WRAP(glDepthRangeIndexed);
+	GLAD_TRACE_WRAP(glDepthRangef);
+	GLAD_TRACE_WRAP(glDetachShader);
+	GLAD_TRACE_WRAP(glDisable);
+	GLAD_TRACE_WRAP(glDisableVertexArrayAttrib);
+	GLAD_TRACE_WRAP(glDisableVertexAttribArray);
+	GLAD_TRACE_WRAP(glDisablei);
+	GLAD_TRACE_WRAP(glDispatchCompute);
+	GLAD_TRACE_WRAP(glDispatchComputeIndirect);
+	GLAD_TRACE_WRAP(glDrawArrays);
+	GLAD_TRACE_WRAP(glDrawArraysIndirect);
+	GLAD_TRACE_WRAP(glDrawArraysInstanced);
+	GLAD_TRACE_WRAP(glDrawArraysInstancedBaseInstance);
+	GLAD_TRACE_WRAP(glDrawBuffer);
+	GLAD_TRACE_WRAP(glDrawBuffers);
+	GLAD_TRACE_WRAP(glDrawElements);
+	GLAD_TRACE_WRAP(glDrawElementsBaseVertex);
+	GLAD_TRACE_WRAP(glDrawElementsIndirect);
+	GLAD_TRACE_WRAP(glDrawElementsInstanced);
+	GLAD_TRACE_WRAP(glDrawElementsInstancedBaseInstance);
+	GLAD_TRACE_WRAP(glDrawElementsInstancedBaseVertex);
+	GLAD_TRACE_WRAP(glDrawElementsInstancedBaseVertexBaseInstance);
+	GLAD_TRACE_WRAP(glDrawRangeElements);
+	GLAD_TRACE_WRAP(glDrawRangeElementsBaseVertex);
+	GLAD_TRACE_WRAP(glDrawTransformFeedback);
+	GLAD_TRACE_WRAP(glDrawTransformFeedbackInstanced);
+	GLAD_TRACE_WRAP(glDrawTransformFeedbackStream);
+	GLAD_TRACE_WRAP(glDrawTransformFeedbackStreamInstanced);
+	GLAD_TRACE_WRAP(glEnable);
+	GLAD_TRACE_WRAP(glEnableVertexArrayAttrib);
+	GLAD_TRACE_WRAP(glEnableVertexAttribArray);
+	GLAD_TRACE_WRAP(glEnablei);
+	GLAD_TRACE_WRAP(glEndConditionalRender);
+	GLAD_TRACE_WRAP(glEndQuery);
+	GLAD_TRACE_WRAP(glEndQueryIndexed);
+	GLAD_TRACE_WRAP(glEndTransformFeedback);
+	GLAD_TRACE_WRAP(glFenceSync);
+	GLAD_TRACE_WRAP(glFinish);
+	GLAD_TRACE_WRAP(glFlush);
+	GLAD_TRACE_WRAP(glFlushMappedBufferRange);
+	GLAD_TRACE_WRAP(glFlushMappedNamedBufferRange);
+	GLAD_TRACE_WRAP(glFramebufferParameteri);
+	GLAD_TRACE_WRAP(glFramebufferRenderbuffer);
+	GLAD_TRACE_WRAP(glFramebufferTexture);
+	GLAD_TRACE_WRAP(glFramebufferTexture1D);
+	GLAD_TRACE_WRAP(glFramebufferTexture2D);
+	GLAD_TRACE_WRAP(glFramebufferTexture3D);
+	GLAD_TRACE_WRAP(glFramebufferTextureLayer);
+	GLAD_TRACE_WRAP(glFrontFace);
+	GLAD_TRACE_WRAP(glGenBuffers);
+	GLAD_TRACE_WRAP(glGenFramebuffers);
+	GLAD_TRACE_WRAP(glGenProgramPipelines);
+	GLAD_TRACE_WRAP(glGenQueries);
+	GLAD_TRACE_WRAP(glGenRenderbuffers);
+	GLAD_TRACE_WRAP(glGenSamplers);
+	GLAD_TRACE_WRAP(glGenTextures);
+	GLAD_TRACE_WRAP(glGenTransformFeedbacks);
+	GLAD_TRACE_WRAP(glGenVertexArrays);
+	GLAD_TRACE_WRAP(glGenerateMipmap);
+	GLAD_TRACE_WRAP(glGenerateTextureMipmap);
+	GLAD_TRACE_WRAP(glGetActiveAtomicCounterBufferiv);
+	GLAD_TRACE_WRAP(glGetActiveAttrib);
+	GLAD_TRACE_WRAP(glGetActiveSubroutineName);
+	GLAD_TRACE_WRAP(glGetActiveSubroutineUniformName);
+	GLAD_TRACE_WRAP(glGetActiveSubroutineUniformiv);
+	GLAD_TRACE_WRAP(glGetActiveUniform);
+	GLAD_TRACE_WRAP(glGetActiveUniformBlockName);
+	GLAD_TRACE_WRAP(glGetActiveUniformBlockiv);
+	GLAD_TRACE_WRAP(glGetActiveUniformName);
+	GLAD_TRACE_WRAP(glGetActiveUniformsiv);
+	GLAD_TRACE_WRAP(glGetAttachedShaders);
+	GLAD_TRACE_WRAP(glGetAttribLocation);
+	GLAD_TRACE_WRAP(glGetBooleani_v);
+	GLAD_TRACE_WRAP(glGetBooleanv);
+	GLAD_TRACE_WRAP(glGetBufferParameteri64v);
+	GLAD_TRACE_WRAP(glGetBufferParameteriv);
+	GLAD_TRACE_WRAP(glGetBufferPointerv);
+	GLAD_TRACE_WRAP(glGetBufferSubData);
+	GLAD_TRACE_WRAP(glGetCompressedTexImage);
+	GLAD_TRACE_WRAP(glGetCompressedTextureImage);
+	GLAD_TRACE_WRAP(glGetCompressedTextureSubImage);
+	GLAD_TRACE_WRAP(glGetDebugMessageLog);
+	GLAD_TRACE_WRAP(glGetDoublei_v);
+	GLAD_TRACE_WRAP(glGetDoublev);
+	GLAD_TRACE_WRAP(glGetError);
+	GLAD_TRACE_WRAP(glGetFloati_v);
+	GLAD_TRACE_WRAP(glGetFloatv);
+	GLAD_TRACE_WRAP(glGetFragDataIndex);
+	GLAD_TRACE_WRAP(glGetFragDataLocation);
+	GLAD_TRACE_WRAP(glGetFramebufferAttachmentParameteriv);
+	GLAD_TRACE_WRAP(glGetFramebufferParameteriv);
+	GLAD_TRACE_WRAP(glGetGraphicsResetStatus);
+	GLAD_TRACE_WRAP(glGetInteger64i_v);
+	GLAD_TRACE_WRAP(glGetInteger64v);
+	GLAD_TRACE_WRAP(glGetIntegeri_v);
+	GLAD_TRACE_WRAP(glGetIntegerv);
+	GLAD_TRACE_WRAP(glGetInternalformati64v);
+	GLAD_TRACE_WRAP(glGetInternalformativ);
+	GLAD_TRACE_WRAP(glGetMultisamplefv);
+	GLAD_TRACE_WRAP(glGetNamedBufferParameteri64v);
+	GLAD_TRACE_WRAP(glGetNamedBufferParameteriv);
+	GLAD_TRACE_WRAP(glGetNamedBufferPointerv);
+	GLAD_TRACE_WRAP(glGetNamedBufferSubData);
+	GLAD_TRACE_WRAP(glGetNamedFramebufferAttachmentParameteriv);
+	GLAD_TRACE_WRAP(glGetNamedFramebufferParameteriv);
+	GLAD_TRACE_WRAP(glGetNamedRenderbufferParameteriv);
+	GLAD_TRACE_WRAP(glGetObjectLabel);
+	GLAD_TRACE_WRAP(glGetObjectPtrLabel);
+	GLAD_TRACE_WRAP(glGetPointerv);
+	GLAD_TRACE_WRAP(glGetProgramBinary);
+	GLAD_TRACE_WRAP(glGetProgramInfoLog);
+	GLAD_TRACE_WRAP(glGetProgramInterfaceiv);
+	GLAD_TRACE_WRAP(glGetProgramPipelineInfoLog);
+	GLAD_TRACE_WRAP(glGetProgramPipelineiv);
+	GLAD_TRACE_WRAP(glGetProgramResourceIndex);
+	GLAD_TRACE_WRAP(glGetProgramResourceLocation);
+	GLAD_TRACE_WRAP(glGetProgramResourceLocationIndex);
+	GLAD_TRACE_WRAP(glGetProgramResourceName);
+	GLAD_TRACE_WRAP(glGetProgramResourceiv);
+	GLAD_TRACE_WRAP(glGetProgramStageiv);
+	GLAD_TRACE_WRAP(glGetProgramiv);
+	GLAD_TRACE_WRAP(glGetQueryBufferObjecti64v);
+	GLAD_TRACE_WRAP(glGetQueryBufferObjectiv);
+	GLAD_TRACE_WRAP(glGetQueryBufferObjectui64v);
+	GLAD_TRACE_WRAP(glGetQueryBufferObjectuiv);
+	GLAD_TRACE_WRAP(glGetQueryIndexediv);
+	GLAD_TRACE_WRAP(glGetQueryObjecti64v);
+	GLAD_TRACE_WRAP(glGetQueryObjectiv);
+	GLAD_TRACE_WRAP(glGetQueryObjectui64v);
+	GLAD_TRACE_WRAP(glGetQueryObjectuiv);
+	GLAD_TRACE_WRAP(glGetQueryiv);
+	GLAD_TRACE_WRAP(glGetRenderbufferParameteriv);
+	GLAD_TRACE_WRAP(glGetSamplerParameterIiv);
+	GLAD_TRACE_WRAP(glGetSamplerParameterIuiv);
+	GLAD_TRACE_WRAP(glGetSamplerParameterfv);
+	GLAD_TRACE_WRAP(glGetSamplerParameteriv);
+	GLAD_TRACE_WRAP(glGetShaderInfoLog);
+	GLAD_TRACE_WRAP(glGetShaderPrecisionFormat);
+	GLAD_TRACE_WRAP(glGetShaderSource);
+	GLAD_TRACE_WRAP(glGetShaderiv);
+	GLAD_TRACE_WRAP(glGetString);
+	GLAD_TRACE_WRAP(glGetStringi);
+	GLAD_TRACE_WRAP(glGetSubroutineIndex);
+	GLAD_TRACE_WRAP(glGetSubroutineUniformLocation);
+	GLAD_TRACE_WRAP(glGetSynciv);
+	GLAD_TRACE_WRAP(glGetTexImage);
+	GLAD_TRACE_WRAP(glGetTexLevelParameterfv);
+	GLAD_TRACE_WRAP(glGetTexLevelParameteriv);
+	GLAD_TRACE_WRAP(glGetTexParameterIiv);
+	GLAD_TRACE_WRAP(glGetTexParameterIuiv);
+	GLAD_TRACE_WRAP(glGetTexParameterfv);
+	GLAD_TRACE_WRAP(glGetTexParameteriv);
+	GLAD_TRACE_WRAP(glGetTextureImage);
+	GLAD_TRACE_WRAP(glGetTextureLevelParameterfv);
+	GLAD_TRACE_WRAP(glGetTextureLevelParameteriv);
+	GLAD_TRACE_WRAP(glGetTextureParameterIiv);
+	GLAD_TRACE_WRAP(glGetTextureParameterIuiv);
+	GLAD_TRACE_WRAP(glGetTextureParameterfv);
+	GLAD_TRACE_WRAP(glGetTextureParameteriv);
+	GLAD_TRACE_WRAP(glGetTextureSubImage);
+	GLAD_TRACE_WRAP(glGetTransformFeedbackVarying);
+	GLAD_TRACE_WRAP(glGetTransformFeedbacki64_v);
+	GLAD_TRACE_WRAP(glGetTransformFeedbacki_v);
+	GLAD_TRACE_WRAP(glGetTransformFeedbackiv);
+	GLAD_TRACE_WRAP(glGetUniformBlockIndex);
+	GLAD_TRACE_WRAP(glGetUniformIndices);
+	GLAD_TRACE_WRAP(glGetUniformLocation);
+	GLAD_TRACE_WRAP(glGetUniformSubroutineuiv);
+	GLAD_TRACE_WRAP(glGetUniformdv);
+	GLAD_TRACE_WRAP(glGetUniformfv);
+	GLAD_TRACE_WRAP(glGetUniformiv);
+	GLAD_TRACE_WRAP(glGetUniformuiv);
+	GLAD_TRACE_WRAP(glGetVertexArrayIndexed64iv);
+	GLAD_TRACE_WRAP(glGetVertexArrayIndexediv);
+	GLAD_TRACE_WRAP(glGetVertexArrayiv);
+	GLAD_TRACE_WRAP(glGetVertexAttribIiv);
+	GLAD_TRACE_WRAP(glGetVertexAttribIuiv);
+	GLAD_TRACE_WRAP(glGetVertexAttribLdv);
+	GLAD_TRACE_WRAP(glGetVertexAttribPointerv);
+	GLAD_TRACE_WRAP(glGetVertexAttribdv);
+	GLAD_TRACE_WRAP(glGetVertexAttribfv);
+	GLAD_TRACE_WRAP(glGetVertexAttribiv);
+	GLAD_TRACE_WRAP(glGetnColorTable);
+	GLAD_TRACE_WRAP(glGetnCompressedTexImage);
+	GLAD_TRACE_WRAP(glGetnConvolutionFilter);
+	GLAD_TRACE_WRAP(glGetnHistogram);
+	GLAD_TRACE_WRAP(glGetnMapdv);
+	GLAD_TRACE_WRAP(glGetnMapfv);
+	GLAD_TRACE_WRAP(glGetnMapiv);
+	GLAD_TRACE_WRAP(glGetnMinmax);
+	GLAD_TRACE_WRAP(glGetnPixelMapfv);
+	GLAD_TRACE_WRAP(glGetnPixelMapuiv);
+	GLAD_TRACE_WRAP(glGetnPixelMapusv);
+	GLAD_TRACE_WRAP(glGetnPolygonStipple);
+	GLAD_TRACE_WRAP(glGetnSeparableFilter);
+	GLAD_TRACE_WRAP(glGetnTexImage);
+	GLAD_TRACE_WRAP(glGetnUniformdv);
+	GLAD_TRACE_WRAP(glGetnUniformfv);
+	GLAD_TRACE_WRAP(glGetnUniformiv);
+	GLAD_TRACE_WRAP(glGetnUniformuiv);
+	GLAD_TRACE_WRAP(glHint);
+	GLAD_TRACE_WRAP(glInvalidateBufferData);
+	GLAD_TRACE_WRAP(glInvalidateBufferSubData);
+	GLAD_TRACE_WRAP(glInvalidateFramebuffer);
+	GLAD_TRACE_WRAP(glInvalidateNamedFramebufferData);
+	GLAD_TRACE_WRAP(glInvalidateNamedFramebufferSubData);
+	GLAD_TRACE_WRAP(glInvalidateSubFramebuffer);
+	GLAD_TRACE_WRAP(glInvalidateTexImage);
+	GLAD_TRACE_WRAP(glInvalidateTexSubImage);
+	GLAD_TRACE_WRAP(glIsBuffer);
+	GLAD_TRACE_WRAP(glIsEnabled);
+	GLAD_TRACE_WRAP(glIsEnabledi);
+	GLAD_TRACE_WRAP(glIsFramebuffer);
+	GLAD_TRACE_WRAP(glIsProgram);
+	GLAD_TRACE_WRAP(glIsProgramPipeline);
+	GLAD_TRACE_WRAP(glIsQuery);
+	GLAD_TRACE_WRAP(glIsRenderbuffer);
+	GLAD_TRACE_WRAP(glIsSampler);
+	GLAD_TRACE_WRAP(glIsShader);
+	GLAD_TRACE_WRAP(glIsSync);
+	GLAD_TRACE_WRAP(glIsTexture);
+	GLAD_TRACE_WRAP(glIsTransformFeedback);
+	GLAD_TRACE_WRAP(glIsVertexArray);
+	GLAD_TRACE_WRAP(glLineWidth);
+	GLAD_TRACE_WRAP(glLinkProgram);
+	GLAD_TRACE_WRAP(glLogicOp);
+	GLAD_TRACE_WRAP(glMapBuffer);
+	GLAD_TRACE_WRAP(glMapBufferRange);
+	GLAD_TRACE_WRAP(glMapNamedBuffer);
+	GLAD_TRACE_WRAP(glMapNamedBufferRange);
+	GLAD_TRACE_WRAP(glMemoryBarrier);
+	GLAD_TRACE_WRAP(glMemoryBarrierByRegion);
+	GLAD_TRACE_WRAP(glMinSampleShading);
+	GLAD_TRACE_WRAP(glMultiDrawArrays);
+	GLAD_TRACE_WRAP(glMultiDrawArraysIndirect);
+	GLAD_TRACE_WRAP(glMultiDrawArraysIndirectCount);
+	GLAD_TRACE_WRAP(glMultiDrawElements);
+	GLAD_TRACE_WRAP(glMultiDrawElementsBaseVertex);
+	GLAD_TRACE_WRAP(glMultiDrawElementsIndirect);
+	GLAD_TRACE_WRAP(glMultiDrawElementsIndirectCount);
+	GLAD_TRACE_WRAP(glMultiTexCoordP1ui);
+	GLAD_TRACE_WRAP(glMultiTexCoordP1uiv);
+	GLAD_TRACE_WRAP(glMultiTexCoordP2ui);
+	GLAD_TRACE_WRAP(glMultiTexCoordP2uiv);
+	GLAD_TRACE_WRAP(glMultiTexCoordP3ui);
+	GLAD_TRACE_WRAP(glMultiTexCoordP3uiv);
+	GLAD_TRACE_WRAP(glMultiTexCoordP4ui);
+	GLAD_TRACE_WRAP(glMultiTexCoordP4uiv);
+	GLAD_TRACE_WRAP(glNamedBufferData);
+	GLAD_TRACE_WRAP(glNamedBufferStorage);
+	GLAD_TRACE_WRAP(glNamedBufferSubData);
+	GLAD_TRACE_WRAP(glNamedFramebufferDrawBuffer);
+	GLAD_TRACE_WRAP(glNamedFramebufferDrawBuffers);
+	GLAD_TRACE_WRAP(glNamedFramebufferParameteri);
+	GLAD_TRACE_WRAP(glNamedFramebufferReadBuffer);
+	GLAD_TRACE_WRAP(glNamedFramebufferRenderbuffer);
+	GLAD_TRACE_WRAP(glNamedFramebufferTexture);
+	GLAD_TRACE_WRAP(glNamedFramebufferTextureLayer);
+	GLAD_TRACE_WRAP(glNamedRenderbufferStorage);
+	GLAD_TRACE_WRAP(glNamedRenderbufferStorageMultisample);
+	GLAD_TRACE_WRAP(glNormalP3ui);
+	GLAD_TRACE_WRAP(glNormalP3uiv);
+	GLAD_TRACE_WRAP(glObjectLabel);
+	GLAD_TRACE_WRAP(glObjectPtrLabel);
+	GLAD_TRACE_WRAP(glPatchParameterfv);
+	GLAD_TRACE_WRAP(glPatchParameteri);
+	GLAD_TRACE_WRAP(glPauseTransformFeedback);
+	GLAD_TRACE_WRAP(glPixelStoref);
+	GLAD_TRACE_WRAP(glPixelStorei);
+	GLAD_TRACE_WRAP(glPointParameterf);
+	GLAD_TRACE_WRAP(glPointParameterfv);
+	GLAD_TRACE_WRAP(glPointParameteri);
+	GLAD_TRACE_WRAP(glPointParameteriv);
+	GLAD_TRACE_WRAP(glPointSize);
+	GLAD_TRACE_WRAP(glPolygonMode);
+	GLAD_TRACE_WRAP(glPolygonOffset);
+	GLAD_TRACE_WRAP(glPolygonOffsetClamp);
+	GLAD_TRACE_WRAP(glPopDebugGroup);
+	GLAD_TRACE_WRAP(glPrimitiveRestartIndex);
+	GLAD_TRACE_WRAP(glProgramBinary);
+	GLAD_TRACE_WRAP(glProgramParameteri);
+	GLAD_TRACE_WRAP(glProgramUniform1d);
+	GLAD_TRACE_WRAP(glProgramUniform1dv);
+	GLAD_TRACE_WRAP(glProgramUniform1f);
+	GLAD_TRACE_WRAP(glProgramUniform1fv);
+	GLAD_TRACE_WRAP(glProgramUniform1i);
+	GLAD_TRACE_WRAP(glProgramUniform1iv);
+	GLAD_TRACE_WRAP(glProgramUniform1ui);
+	GLAD_TRACE_WRAP(glProgramUniform1uiv);
+	GLAD_TRACE_WRAP(glProgramUniform2d);
+	GLAD_TRACE_WRAP(glProgramUniform2dv);
+	GLAD_TRACE_WRAP(glProgramUniform2f);
+	GLAD_TRACE_WRAP(glProgramUniform2fv);
+	GLAD_TRACE_WRAP(glProgramUniform2i);
+	GLAD_TRACE_WRAP(glProgramUniform2iv);
+	GLAD_TRACE_WRAP(glProgramUniform2ui);
+	GLAD_TRACE_WRAP(glProgramUniform2uiv);
+	GLAD_TRACE_WRAP(glProgramUniform3d);
+	GLAD_TRACE_WRAP(glProgramUniform3dv);
+	GLAD_TRACE_WRAP(glProgramUniform3f);
+	GLAD_TRACE_WRAP(glProgramUniform3fv);
+	GLAD_TRACE_WRAP(glProgramUniform3i);
+	GLAD_TRACE_WRAP(glProgramUniform3iv);
+	GLAD_TRACE_WRAP(glProgramUniform3ui);
+	GLAD_TRACE_WRAP(glProgramUniform3uiv);
+	GLAD_TRACE_WRAP(glProgramUniform4d);
+	GLAD_TRACE_WRAP(glProgramUniform4dv);
+	GLAD_TRACE_WRAP(glProgramUniform4f);
+	GLAD_TRACE_WRAP(glProgramUniform4fv);
+	GLAD_TRACE_WRAP(glProgramUniform4i);
+	GLAD_TRACE_WRAP(glProgramUniform4iv);
+	GLAD_TRACE_WRAP(glProgramUniform4ui);
+	GLAD_TRACE_WRAP(glProgramUniform4uiv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2x3dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2x3fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2x4dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix2x4fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3x2dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3x2fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3x4dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix3x4fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4x2dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4x2fv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4x3dv);
+	GLAD_TRACE_WRAP(glProgramUniformMatrix4x3fv);
+	GLAD_TRACE_WRAP(glProvokingVertex);
+	GLAD_TRACE_WRAP(glPushDebugGroup);
+	GLAD_TRACE_WRAP(glQueryCounter);
+	GLAD_TRACE_WRAP(glReadBuffer);
+	GLAD_TRACE_WRAP(glReadPixels);
+	GLAD_TRACE_WRAP(glReadnPixels);
+	GLAD_TRACE_WRAP(glReleaseShaderCompiler);
+	GLAD_TRACE_WRAP(glRenderbufferStorage);
+	GLAD_TRACE_WRAP(glRenderbufferStorageMultisample);
+	GLAD_TRACE_WRAP(glResumeTransformFeedback);
+	GLAD_TRACE_WRAP(glSampleCoverage);
+	GLAD_TRACE_WRAP(glSampleMaski);
+	GLAD_TRACE_WRAP(glSamplerParameterIiv);
+	GLAD_TRACE_WRAP(glSamplerParameterIuiv);
+	GLAD_TRACE_WRAP(glSamplerParameterf);
+	GLAD_TRACE_WRAP(glSamplerParameterfv);
+	GLAD_TRACE_WRAP(glSamplerParameteri);
+	GLAD_TRACE_WRAP(glSamplerParameteriv);
+	GLAD_TRACE_WRAP(glScissor);
+	GLAD_TRACE_WRAP(glScissorArrayv);
+	GLAD_TRACE_WRAP(glScissorIndexed);
+	GLAD_TRACE_WRAP(glScissorIndexedv);
+	GLAD_TRACE_WRAP(glSecondaryColorP3ui);
+	GLAD_TRACE_WRAP(glSecondaryColorP3uiv);
+	GLAD_TRACE_WRAP(glShaderBinary);
+	GLAD_TRACE_WRAP(glShaderSource);
+	GLAD_TRACE_WRAP(glShaderStorageBlockBinding);
+	GLAD_TRACE_WRAP(glSpecializeShader);
+	GLAD_TRACE_WRAP(glStencilFunc);
+	GLAD_TRACE_WRAP(glStencilFuncSeparate);
+	GLAD_TRACE_WRAP(glStencilMask);
+	GLAD_TRACE_WRAP(glStencilMaskSeparate);
+	GLAD_TRACE_WRAP(glStencilOp);
+	GLAD_TRACE_WRAP(glStencilOpSeparate);
+	GLAD_TRACE_WRAP(glTexBuffer);
+	GLAD_TRACE_WRAP(glTexBufferRange);
+	GLAD_TRACE_WRAP(glTexCoordP1ui);
+	GLAD_TRACE_WRAP(glTexCoordP1uiv);
+	GLAD_TRACE_WRAP(glTexCoordP2ui);
+	GLAD_TRACE_WRAP(glTexCoordP2uiv);
+	GLAD_TRACE_WRAP(glTexCoordP3ui);
+	GLAD_TRACE_WRAP(glTexCoordP3uiv);
+	GLAD_TRACE_WRAP(glTexCoordP4ui);
+	GLAD_TRACE_WRAP(glTexCoordP4uiv);
+	GLAD_TRACE_WRAP(glTexImage1D);
+	GLAD_TRACE_WRAP(glTexImage2D);
+	GLAD_TRACE_WRAP(glTexImage2DMultisample);
+	GLAD_TRACE_WRAP(glTexImage3D);
+	GLAD_TRACE_WRAP(glTexImage3DMultisample);
+	GLAD_TRACE_WRAP(glTexParameterIiv);
+	GLAD_TRACE_WRAP(glTexParameterIuiv);
+	GLAD_TRACE_WRAP(glTexParameterf);
+	GLAD_TRACE_WRAP(glTexParameterfv);
+	GLAD_TRACE_WRAP(glTexParameteri);
+	GLAD_TRACE_WRAP(glTexParameteriv);
+	GLAD_TRACE_WRAP(glTexStorage1D);
+	GLAD_TRACE_WRAP(glTexStorage2D);
+	GLAD_TRACE_WRAP(glTexStorage2DMultisample);
+	GLAD_TRACE_WRAP(glTexStorage3D);
+	GLAD_TRACE_WRAP(glTexStorage3DMultisample);
+	GLAD_TRACE_WRAP(glTexSubImage1D);
+	GLAD_TRACE_WRAP(glTexSubImage2D);
+	GLAD_TRACE_WRAP(glTexSubImage3D);
+	GLAD_TRACE_WRAP(glTextureBarrier);
+	GLAD_TRACE_WRAP(glTextureBuffer);
+	GLAD_TRACE_WRAP(glTextureBufferRange);
+	GLAD_TRACE_WRAP(glTextureParameterIiv);
+	GLAD_TRACE_WRAP(glTextureParameterIuiv);
+	GLAD_TRACE_WRAP(glTextureParameterf);
+	GLAD_TRACE_WRAP(glTextureParameterfv);
+	GLAD_TRACE_WRAP(glTextureParameteri);
+	GLAD_TRACE_WRAP(glTextureParameteriv);
+	GLAD_TRACE_WRAP(glTextureStorage1D);
+	GLAD_TRACE_WRAP(glTextureStorage2D);
+	GLAD_TRACE_WRAP(glTextureStorage2DMultisample);
+	GLAD_TRACE_WRAP(glTextureStorage3D);
+	GLAD_TRACE_WRAP(glTextureStorage3DMultisample);
+	GLAD_TRACE_WRAP(glTextureSubImage1D);
+	GLAD_TRACE_WRAP(glTextureSubImage2D);
+	GLAD_TRACE_WRAP(glTextureSubImage3D);
+	GLAD_TRACE_WRAP(glTextureView);
+	GLAD_TRACE_WRAP(glTransformFeedbackBufferBase);
+	GLAD_TRACE_WRAP(glTransformFeedbackBufferRange);
+	GLAD_TRACE_WRAP(glTransformFeedbackVaryings);
+	GLAD_TRACE_WRAP(glUniform1d);
+	GLAD_TRACE_WRAP(glUniform1dv);
+	GLAD_TRACE_WRAP(glUniform1f);
+	GLAD_TRACE_WRAP(glUniform1fv);
+	GLAD_TRACE_WRAP(glUniform1i);
+	GLAD_TRACE_WRAP(glUniform1iv);
+	GLAD_TRACE_WRAP(glUniform1ui);
+	GLAD_TRACE_WRAP(glUniform1uiv);
+	GLAD_TRACE_WRAP(glUniform2d);
+	GLAD_TRACE_WRAP(glUniform2dv);
+	GLAD_TRACE_WRAP(glUniform2f);
+	GLAD_TRACE_WRAP(glUniform2fv);
+	GLAD_TRACE_WRAP(glUniform2i);
+	GLAD_TRACE_WRAP(glUniform2iv);
+	GLAD_TRACE_WRAP(glUniform2ui);
+	GLAD_TRACE_WRAP(glUniform2uiv);
+	GLAD_TRACE_WRAP(glUniform3d);
+	GLAD_TRACE_WRAP(glUniform3dv);
+	GLAD_TRACE_WRAP(glUniform3f);
+	GLAD_TRACE_WRAP(glUniform3fv);
+	GLAD_TRACE_WRAP(glUniform3i);
+	GLAD_TRACE_WRAP(glUniform3iv);
+	GLAD_TRACE_WRAP(glUniform3ui);
+	GLAD_TRACE_WRAP(glUniform3uiv);
+	GLAD_TRACE_WRAP(glUniform4d);
+	GLAD_TRACE_WRAP(glUniform4dv);
+	GLAD_TRACE_WRAP(glUniform4f);
+	GLAD_TRACE_WRAP(glUniform4fv);
+	GLAD_TRACE_WRAP(glUniform4i);
+	GLAD_TRACE_WRAP(glUniform4iv);
+	GLAD_TRACE_WRAP(glUniform4ui);
+	GLAD_TRACE_WRAP(glUniform4uiv);
+	GLAD_TRACE_WRAP(glUniformBlockBinding);
+	GLAD_TRACE_WRAP(glUniformMatrix2dv);
+	GLAD_TRACE_WRAP(glUniformMatrix2fv);
+	GLAD_TRACE_WRAP(glUniformMatrix2x3dv);
+	GLAD_TRACE_WRAP(glUniformMatrix2x3fv);
+	GLAD_TRACE_WRAP(glUniformMatrix2x4dv);
+	GLAD_TRACE_WRAP(glUniformMatrix2x4fv);
+	GLAD_TRACE_WRAP(glUniformMatrix3dv);
+	GLAD_TRACE_WRAP(glUniformMatrix3fv);
+	GLAD_TRACE_WRAP(glUniformMatrix3x2dv);
+	GLAD_TRACE_WRAP(glUniformMatrix3x2fv);
+	GLAD_TRACE_WRAP(glUniformMatrix3x4dv);
+	GLAD_TRACE_WRAP(glUniformMatrix3x4fv);
+	GLAD_TRACE_WRAP(glUniformMatrix4dv);
+	GLAD_TRACE_WRAP(glUniformMatrix4fv);
+	GLAD_TRACE_WRAP(glUniformMatrix4x2dv);
+	GLAD_TRACE_WRAP(glUniformMatrix4x2fv);
+	GLAD_TRACE_WRAP(glUniformMatrix4x3dv);
+	GLAD_TRACE_WRAP(glUniformMatrix4x3fv);
+	GLAD_TRACE_WRAP(glUniformSubroutinesuiv);
+	GLAD_TRACE_WRAP(glUnmapBuffer);
+	GLAD_TRACE_WRAP(glUnmapNamedBuffer);
+	GLAD_TRACE_WRAP(glUseProgram);
+	GLAD_TRACE_WRAP(glUseProgramStages);
+	GLAD_TRACE_WRAP(glValidateProgram);
+	GLAD_TRACE_WRAP(glValidateProgramPipeline);
+	GLAD_TRACE_WRAP(glVertexArrayAttribBinding);
+	GLAD_TRACE_WRAP(glVertexArrayAttribFormat);
+	GLAD_TRACE_WRAP(glVertexArrayAttribIFormat);
+	GLAD_TRACE_WRAP(glVertexArrayAttribLFormat);
+	GLAD_TRACE_WRAP(glVertexArrayBindingDivisor);
+	GLAD_TRACE_WRAP(glVertexArrayElementBuffer);
+	GLAD_TRACE_WRAP(glVertexArrayVertexBuffer);
+	GLAD_TRACE_WRAP(glVertexArrayVertexBuffers);
+	GLAD_TRACE_WRAP(glVertexAttrib1d);
+	GLAD_TRACE_WRAP(glVertexAttrib1dv);
+	GLAD_TRACE_WRAP(glVertexAttrib1f);
+	GLAD_TRACE_WRAP(glVertexAttrib1fv);
+	GLAD_TRACE_WRAP(glVertexAttrib1s);
+	GLAD_TRACE_WRAP(glVertexAttrib1sv);
+	GLAD_TRACE_WRAP(glVertexAttrib2d);
+	GLAD_TRACE_WRAP(glVertexAttrib2dv);
+	GLAD_TRACE_WRAP(glVertexAttrib2f);
+	GLAD_TRACE_WRAP(glVertexAttrib2fv);
+	GLAD_TRACE_WRAP(glVertexAttrib2s);
+	GLAD_TRACE_WRAP(glVertexAttrib2sv);
+	GLAD_TRACE_WRAP(glVertexAttrib3d);
+	GLAD_TRACE_WRAP(glVertexAttrib3dv);
+	GLAD_TRACE_WRAP(glVertexAttrib3f);
+	GLAD_TRACE_WRAP(glVertexAttrib3fv);
+	GLAD_TRACE_WRAP(glVertexAttrib3s);
+	GLAD_TRACE_WRAP(glVertexAttrib3sv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nbv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Niv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nsv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nub);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nubv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nuiv);
+	GLAD_TRACE_WRAP(glVertexAttrib4Nusv);
+	GLAD_TRACE_WRAP(glVertexAttrib4bv);
+	GLAD_TRACE_WRAP(glVertexAttrib4d);
+	GLAD_TRACE_WRAP(glVertexAttrib4dv);
+	GLAD_TRACE_WRAP(glVertexAttrib4f);
+	GLAD_TRACE_WRAP(glVertexAttrib4fv);
+	GLAD_TRACE_WRAP(glVertexAttrib4iv);
+	GLAD_TRACE_WRAP(glVertexAttrib4s);
+	GLAD_TRACE_WRAP(glVertexAttrib4sv);
+	GLAD_TRACE_WRAP(glVertexAttrib4ubv);
+	GLAD_TRACE_WRAP(glVertexAttrib4uiv);
+	GLAD_TRACE_WRAP(glVertexAttrib4usv);
+	GLAD_TRACE_WRAP(glVertexAttribBinding);
+	GLAD_TRACE_WRAP(glVertexAttribDivisor);
+	GLAD_TRACE_WRAP(glVertexAttribFormat);
+	GLAD_TRACE_WRAP(glVertexAttribI1i);
+	GLAD_TRACE_WRAP(glVertexAttribI1iv);
+	GLAD_TRACE_WRAP(glVertexAttribI1ui);
+	GLAD_TRACE_WRAP(glVertexAttribI1uiv);
+	GLAD_TRACE_WRAP(glVertexAttribI2i);
+	GLAD_TRACE_WRAP(glVertexAttribI2iv);
+	GLAD_TRACE_WRAP(glVertexAttribI2ui);
+	GLAD_TRACE_WRAP(glVertexAttribI2uiv);
+	GLAD_TRACE_WRAP(glVertexAttribI3i);
+	GLAD_TRACE_WRAP(glVertexAttribI3iv);
+	GLAD_TRACE_WRAP(glVertexAttribI3ui);
+	GLAD_TRACE_WRAP(glVertexAttribI3uiv);
+	GLAD_TRACE_WRAP(glVertexAttribI4bv);
+	GLAD_TRACE_WRAP(glVertexAttribI4i);
+	GLAD_TRACE_WRAP(glVertexAttribI4iv);
+	GLAD_TRACE_WRAP(glVertexAttribI4sv);
+	GLAD_TRACE_WRAP(glVertexAttribI4ubv);
+	GLAD_TRACE_WRAP(glVertexAttribI4ui);
+	GLAD_TRACE_WRAP(glVertexAttribI4uiv);
+	GLAD_TRACE_WRAP(glVertexAttribI4usv);
+	GLAD_TRACE_WRAP(glVertexAttribIFormat);
+	GLAD_TRACE_WRAP(glVertexAttribIPointer);
+	GLAD_TRACE_WRAP(glVertexAttribL1d);
+	GLAD_TRACE_WRAP(glVertexAttribL1dv);
+	GLAD_TRACE_WRAP(glVertexAttribL2d);
+	GLAD_TRACE_WRAP(glVertexAttribL2dv);
+	GLAD_TRACE_WRAP(glVertexAttribL3d);
+	GLAD_TRACE_WRAP(glVertexAttribL3dv);
+	GLAD_TRACE_WRAP(glVertexAttribL4d);
+	GLAD_TRACE_WRAP(glVertexAttribL4dv);
+	GLAD_TRACE_WRAP(glVertexAttribLFormat);
+	GLAD_TRACE_WRAP(glVertexAttribLPointer);
+	GLAD_TRACE_WRAP(glVertexAttribP1ui);
+	GLAD_TRACE_WRAP(glVertexAttribP1uiv);
+	GLAD_TRACE_WRAP(glVertexAttribP2ui);
+	GLAD_TRACE_WRAP(glVertexAttribP2uiv);
+	GLAD_TRACE_WRAP(glVertexAttribP3ui);
+	GLAD_TRACE_WRAP(glVertexAttribP3uiv);
+	GLAD_TRACE_WRAP(glVertexAttribP4ui);
+	GLAD_TRACE_WRAP(glVertexAttribP4uiv);
+	GLAD_TRACE_WRAP(glVertexAttribPointer);
+	GLAD_TRACE_WRAP(glVertexBindingDivisor);
+	GLAD_TRACE_WRAP(glVertexP2ui);
+	GLAD_TRACE_WRAP(glVertexP2uiv);
+	GLAD_TRACE_WRAP(glVertexP3ui);
+	GLAD_TRACE_WRAP(glVertexP3uiv);
+	GLAD_TRACE_WRAP(glVertexP4ui);
+	GLAD_TRACE_WRAP(glVertexP4uiv);
+	GLAD_TRACE_WRAP(glViewport);
+	GLAD_TRACE_WRAP(glViewportArrayv);
+	GLAD_TRACE_WRAP(glViewportIndexedf);
+	GLAD_TRACE_WRAP(glViewportIndexedfv);
+	GLAD_TRACE_WRAP(glWaitSync);
+}
+#undef GLAD_TRACE_WRAP
+
+static int glad_trace_compare(const void *a, const void *b) {
+    khronos_uint64_t ta = glad_trace_frame[*(const int *)a].nanoseconds;
+    khronos_uint64_t tb = glad_trace_frame[*(const int *)b].nanoseconds;
+    return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+/* prints one histogram (bars scaled by call count, sorted by time) of the counters in
+ * glad_trace_frame; callers swap totals in there to reuse it for the summary */
+static void glad_trace_print(const char *title) {
+    int order[GLAD_TRACE_FUNCTIONS];
+    int used = 0, i;
+    khronos_uint64_t calls = 0, nanoseconds = 0, max_calls = 0;
+    FILE *out = glad_trace_out != NULL ? glad_trace_out : stdout;
+
+    for(i = 0; i < GLAD_TRACE_FUNCTIONS; i++) {
+        if(glad_trace_frame[i].calls == 0) continue;
+        order[used++] = i;
+        calls += glad_trace_frame[i].calls;
+        nanoseconds += glad_trace_frame[i].nanoseconds;
+        if(glad_trace_frame[i].calls > max_calls) max_calls = glad_trace_frame[i].calls;
+    }
+    qsort(order, (size_t)used, sizeof *order, glad_trace_compare);
+
+    fprintf(out, "%s: %llu GL calls, %.1f us\n", title, (unsigned long long)calls, nanoseconds / 1000.0);
+    for(i = 0; i < used; i++) {
+        const struct glad_trace_counter *c = &glad_trace_frame[order[i]];
+        int bar = (int)((c->calls * GLAD_TRACE_BAR_WIDTH + max_calls - 1) / max_calls);
+        fprintf(out, "  %-32s %8llu %10.1f us  %.*s\n", glad_trace_names[order[i]], (unsigned long long)c->calls,
+                c->nanoseconds / 1000.0, bar, "########################################");
+    }
+    fflush(out);
+}
+
+void gladTraceSetOutput(FILE *out) {
+    glad_trace_out = out;
+}
+
+void gladTraceEndFrame(void) {
+    char title[64];
+    int i;
+    snprintf(title, sizeof title, "frame %llu", (unsigned long long)glad_trace_frames++);
+    glad_trace_print(title);
+    for(i = 0; i < GLAD_TRACE_FUNCTIONS; i++) {
+        glad_trace_total[i].calls += glad_trace_frame[i].calls;
+        glad_trace_total[i].nanoseconds += glad_trace_frame[i].nanoseconds;
+        glad_trace_frame[i].calls = 0;
+        glad_trace_frame[i].nanoseconds = 0;
+    }
+}
+
+void gladTraceSummary(void) {
+    struct glad_trace_counter pending[GLAD_TRACE_FUNCTIONS];
+    char title[64];
+    int i;
+    /* calls since the last gladTraceEndFrame count towards the total too */
+    memcpy(pending, glad_trace_frame, sizeof pending);
+    for(i = 0; i < GLAD_TRACE_FUNCTIONS; i++) {
+        glad_trace_frame[i].calls += glad_trace_total[i].calls;
+        glad_trace_frame[i].nanoseconds += glad_trace_total[i].nanoseconds;
+    }
+    snprintf(title, sizeof title, "total over %llu frames", (unsigned long long)glad_trace_frames);
+    glad_trace_print(title);
+    memcpy(glad_trace_frame, pending, sizeof pending);
+}
+#endif
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
 	(void)&has_ext;
-	free_exts();
 	return 1;
 }
 
@@ -1675,6 +14480,28 @@ int gladLoadGLLoader(GLADloadproc load) {
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
+#ifdef GLAD_LAZY_LOAD
+	glad_lazy_load = load;
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+	lazy_GL_VERSION_4_2();
+	lazy_GL_VERSION_4_3();
+	lazy_GL_VERSION_4_4();
+	lazy_GL_VERSION_4_5();
+	lazy_GL_VERSION_4_6();
+#else
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
 	load_GL_VERSION_1_2(load);
@@ -1694,8 +14521,12 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_4(load);
 	load_GL_VERSION_4_5(load);
 	load_GL_VERSION_4_6(load);
+#endif
 
 	if (!find_extensionsGL()) return 0;
+#ifdef GLAD_TRACE
+	trace_install();
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
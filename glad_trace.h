@@ -0,0 +1,34 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#ifndef OPENGL_REVIEW_GLAD_TRACE_H
+#define OPENGL_REVIEW_GLAD_TRACE_H
+
+#include <stdio.h>
+
+/*
+ * GL call counting built into glad.c (CMake option GLAD_TRACE).
+ * Every loaded glad_gl* pointer is wrapped by a shim that counts calls and time spent per function.
+ *  > gladTraceEndFrame: print this frame's histogram and start the next frame (call right before swapping buffers)
+ *  > gladTraceSummary:  print totals over all frames so far
+ *  > gladTraceSetOutput: where histograms are written, stdout by default
+ * Without GLAD_TRACE these compile to nothing, so demos can call them unconditionally.
+ */
+#ifdef GLAD_TRACE
+#ifdef __cplusplus
+extern "C" {
+#endif
+void gladTraceEndFrame(void);
+void gladTraceSummary(void);
+void gladTraceSetOutput(FILE *out);
+#ifdef __cplusplus
+}
+#endif
+#else
+static inline void gladTraceEndFrame(void) {}
+static inline void gladTraceSummary(void) {}
+static inline void gladTraceSetOutput(FILE *out) { (void)out; }
+#endif
+
+#endif //OPENGL_REVIEW_GLAD_TRACE_H
@@ -0,0 +1,465 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <iostream>
+#include <math.h>
+#include <vector>
+#include <glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "../Shader.h"
+#include "../VertexLayout.h"
+#include "../ShaderReloader.h"
+#include "../glad_trace.h"
+#include "../FrameRecorder.h"
+#include "../FrameLoop.h"
+#include "../Components.h"
+#include "../GLObjects.h"
+#include "../RenderGraph.h"
+#include "../ClusteredLights.h"
+#include "../GBuffer.h"
+#include "../ThreadPool.h"
+#include "../stb_image.h"
+
+void framebuffer_size_callback(GLFWwindow *window, int width, int height);
+void processInput(GLFWwindow *window, const FrameRecorder &recorder);
+void moveCamera(GLFWwindow *window, const FrameRecorder &recorder, glm::vec3 (&camera)[3]);
+
+// Settings
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+const int FLOOR_SIZE = 24; // cubes along each side of the floor
+const int MIN_LIGHTS = 16;
+const int MAX_LIGHTS = 16384;
+
+/*
+ * Clustered lighting (ClusteredLights.h): a floor of cubes under a swarm of point lights.
+ * Every frame the lights move, get binned into the froxel grid on the worker threads and uploaded; shading only
+ * loops over the lights of the pixel's cluster, either
+ *  > forward: the cube shader does it (after a depth prepass, P toggles that), or
+ *  > deferred: the cubes fill a G-buffer (GBuffer.h) and one fullscreen pass lights every pixel from it
+ * G switches between the two, C between the G-buffer layouts (the bytes per pixel of each are printed).
+ * UP / DOWN double / halve the number of lights (starts at 1024), W/S/A/D move the camera.
+ */
+int main(int argc, char** argv) {
+
+    // Instatiate GLFW Window
+    glfwInit();
+    // We want to use glfw version 3.3
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    // --capture / --replay: record or play back time and input for reproducible runs
+    FrameRecorder recorder(argc, argv, {GLFW_KEY_ESCAPE, GLFW_KEY_L, GLFW_KEY_F, GLFW_KEY_W, GLFW_KEY_S, GLFW_KEY_A,
+                                        GLFW_KEY_D, GLFW_KEY_P, GLFW_KEY_G, GLFW_KEY_C, GLFW_KEY_UP,
+                                        GLFW_KEY_DOWN});
+    recorder.windowHints();
+    // --tick / --fps / --no-vsync: simulation rate and render rate are set independently
+    FrameLoop loop(argc, argv);
+    loop.throttle = recorder.mode != FrameRecorder::REPLAY;
+
+    // Create window object
+    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    if (window == nullptr) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    // Initialize GLAD so we can use OpenGL functions
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+    }
+    loop.contextCreated();
+    recorder.contextCreated();
+
+    // SHADER
+    // the cubes: lit by the lights of their cluster
+    Shader litShader("../shaders/lit_vertex.glsl", "../shaders/fragment_shader_clustered.glsl");
+    // depth prepass: same positions as lit_vertex.glsl (both go through camera.glsl), no fragment work
+    Shader depthShader("../shaders/coord_shader.glsl", "../shaders/depth_only.glsl");
+    // deferred: the cubes into the G-buffer, then lighting on a fullscreen triangle
+    Shader gbufferShader("../shaders/lit_vertex.glsl", "../shaders/gbuffer_fragment.glsl");
+    Shader deferredShader("../shaders/post_vertex.glsl", "../shaders/deferred_lighting.glsl");
+    // rebuild the programs in the background whenever one of their files is saved
+    ShaderReloader reloader(window);
+    reloader.watch(litShader);
+    reloader.watch(depthShader);
+    reloader.watch(gbufferShader);
+    reloader.watch(deferredShader);
+    // the fullscreen triangle comes from gl_VertexID, but core profile still wants a vertex array bound
+    GLVertexArray emptyVAO = GLVertexArray::create();
+
+    // set up vertex data (and buffer(s)) and configure vertex attributes
+    float vertices[] = {
+            -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
+            0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
+            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
+            -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
+
+            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+            0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
+            0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
+            -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,
+            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+
+            -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+            -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+            -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+
+            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+            0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+            0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+            0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+
+            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+            0.5f, -0.5f, -0.5f,  1.0f, 1.0f,
+            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+            0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
+            -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
+            -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
+
+            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
+            0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
+            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+            0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
+            -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
+            -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
+    };
+    GLBuffer VBO = GLBuffer::create();
+    glBindBuffer(GL_ARRAY_BUFFER, VBO.id());
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    // vertex position and texture attributes, locations come from the shader
+    VertexLayout layout;
+    layout.attribute("aPos", 3).attribute("aTexCoord", 2);
+    if (!layout.validate(litShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    // Vertex Array Object (which will hold a VBO+EBO)
+    GLVertexArray VAO = layout.createVertexArray(VBO.id());
+
+    // TEXTURE
+    // Create texture1
+    GLTexture texture1 = GLTexture::create(); // texture1 ID
+    glBindTexture(GL_TEXTURE_2D, texture1.id());
+    // set the texture1 wrapping/filtering options (on currently bound texture1)
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // load image for to be used as texture1
+    int width, height, nrChannels;
+    unsigned char *data = stbi_load("../textures/container.jpg", &width, &height, &nrChannels, 0);
+    if (data) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    } else {
+        std::cout << "Failed to load texture1..." << std::endl;
+    }
+    // Create texture1 2
+    GLTexture texture2 = GLTexture::create(); // texture1 ID
+    glBindTexture(GL_TEXTURE_2D, texture2.id());
+    // set the texture1 wrapping/filtering options (on currently bound texture1)
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // load image for to be used as texture1
+    stbi_set_flip_vertically_on_load(true);
+    data = stbi_load("../textures/awesomeface.png", &width, &height, &nrChannels, 0);
+    if (data) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    } else {
+        std::cout << "Failed to load texture1..." << std::endl;
+    }
+    stbi_image_free(data); // free image data from memory
+
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+    // ENTITIES
+    // a floor of cubes, every seventh with a spinning one above it
+    EntityWorld world;
+    Material material{&litShader, {texture1.id(), texture2.id()}};
+    for (int z = 0; z < FLOOR_SIZE; ++z) {
+        for (int x = 0; x < FLOOR_SIZE; ++x) {
+            glm::vec3 position(float(x - FLOOR_SIZE / 2), -1.0f, float(z - FLOOR_SIZE / 2));
+            world.create(Transform{position, glm::vec3(0.0f, 1.0f, 0.0f), 0.0f}, WorldMatrix(),
+                         MeshRenderer{VAO.id(), 0, 36}, material);
+            if ((x + z * FLOOR_SIZE) % 7 == 0) {
+                Transform above{position + glm::vec3(0.0f, 1.5f, 0.0f), glm::vec3(1.0f, 0.3f, 0.5f), 0.0f};
+                Entity cube = world.create(above, WorldMatrix(), MeshRenderer{VAO.id(), 0, 36}, material);
+                world.add(cube, Spin{0.5f + 0.1f * float(x % 5)});
+            }
+        }
+    }
+
+    // LIGHTS
+    // each light circles the middle of the floor at its own radius, height and speed
+    struct Orbit {
+        float radius, height, speed, phase;
+    };
+    std::vector<Orbit> orbits(MAX_LIGHTS);
+    std::vector<ClusteredLights::PointLight> lights(MAX_LIGHTS);
+    for (int i = 0; i < MAX_LIGHTS; ++i) {
+        // cheap deterministic spread, the same run after run (--replay)
+        float a = float((i * 7919) % 1000) / 1000.0f, b = float((i * 104729) % 1000) / 1000.0f;
+        orbits[i] = {1.0f + a * FLOOR_SIZE * 0.6f, -0.3f + b * 1.5f, (b - 0.5f) * 0.8f, a * 6.2832f * 13.0f};
+        lights[i].radius = 1.5f + 1.5f * b;
+        lights[i].color = glm::vec3(0.5f + 0.5f * cosf(6.2832f * a), 0.5f + 0.5f * cosf(6.2832f * (a + 0.33f)),
+                                    0.5f + 0.5f * cosf(6.2832f * (a + 0.67f)));
+        lights[i].intensity = 1.5f;
+    }
+    int lightCount = 1024;
+    std::vector<ClusteredLights::PointLight> activeLights;
+    ClusteredLights clustered;
+    bool printLights = true, upKeyDown = false, downKeyDown = false;
+
+    // MOVEABLE CAMERA
+    glm::vec3 camera[3] = {
+            glm::vec3(0.0f, 4.0f, 14.0f), glm::normalize(glm::vec3(0.0f, -0.35f, -1.0f)), glm::vec3(0.0f, 1.0f, 0.0f)
+    };
+    glm::mat4 view;
+    glm::vec3 previousCameraPos = camera[0]; // camera position before the last update, for interpolation
+    const float fovY = glm::radians(55.0f), zNear = 0.1f, zFar = 100.0f;
+
+    // animation before transforms (it writes what they read), drawing last and on this thread
+    float simulationTime = 0.0f;
+    // P toggles the depth prepass: depth alone first, then every pixel shaded once with GL_EQUAL
+    bool depthPrepass = true, prepassKeyDown = false;
+    // G: deferred instead of forward, C: the next G-buffer layout
+    bool deferred = false, deferredKeyDown = false, layoutKeyDown = false;
+    GBuffer::Layout gbufferLayout = GBuffer::COMPACT;
+    SystemSchedule systems;
+    systems.add("animate", EntityWorld::mask<Spin>(), EntityWorld::mask<Transform>(),
+                [&](EntityWorld &w) { Systems::animate(w, simulationTime); })
+           .add("transforms", EntityWorld::mask<Transform>(), EntityWorld::mask<WorldMatrix>(),
+                Systems::updateTransforms)
+           .add("render", EntityWorld::mask<WorldMatrix, MeshRenderer, Material>(), 0, [&](EntityWorld &w) {
+                Systems::DrawList draws = Systems::frontToBack(w, view);
+                if (deferred) {
+                    // every G-buffer write is cheap, a prepass wouldn't save anything
+                    Systems::renderShaded(draws, false, &gbufferShader);
+                    return;
+                }
+                if (depthPrepass)
+                    Systems::renderDepth(draws, depthShader);
+                Systems::renderShaded(draws, depthPrepass);
+           }, true);
+
+    // RENDER GRAPH
+    // forward: one pass to the screen; deferred: geometry into the G-buffer, lighting from it to the screen.
+    // Built again when the framebuffer size, the path or the G-buffer layout changes.
+    RenderGraph graph;
+    int graphWidth = 0, graphHeight = 0;
+    glm::mat4 projection;
+    auto buildGraph = [&](int width, int height) {
+        graph.clear();
+        RenderGraph::Resource backbuffer = graph.importBackbuffer(width, height);
+        if (!deferred) {
+            graph.addPass("forward", [&](RenderGraph::Builder &builder) {
+                builder.write(backbuffer);
+            }, [&](const RenderGraph&) {
+                glEnable(GL_DEPTH_TEST);
+                glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                systems.run(world);
+            });
+        } else {
+            GBuffer::Targets targets;
+            graph.addPass("gbuffer", [&](RenderGraph::Builder &builder) {
+                targets = GBuffer::create(builder, width, height, gbufferLayout);
+            }, [&](const RenderGraph&) {
+                glEnable(GL_DEPTH_TEST);
+                glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                systems.run(world);
+            });
+            graph.addPass("lighting", [&](RenderGraph::Builder &builder) {
+                GBuffer::read(builder, targets);
+                builder.write(backbuffer);
+            }, [&, targets](const RenderGraph &graph) {
+                glDisable(GL_DEPTH_TEST);
+                glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+                deferredShader.use();
+                GBuffer::bind(graph, targets, deferredShader, 0, projection);
+                clustered.bind(deferredShader, 3, graphWidth, graphHeight);
+                deferredShader.setVec3("ambient", glm::vec3(0.08f));
+                glBindVertexArray(emptyVAO.id());
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            });
+            std::cout << "Deferred, " << GBuffer::format(gbufferLayout).name << " G-buffer" << std::endl;
+            GBuffer::printReport(width, height);
+        }
+        graph.compile();
+        graph.print();
+        graphWidth = width;
+        graphHeight = height;
+    };
+
+    // Create render loop: each iteration of loop is called a "frame"
+    while(!glfwWindowShouldClose(window) && !recorder.finished()) {
+        recorder.beginFrame(window);
+        reloader.update();
+
+        processInput(window, recorder);
+        bool prepassKey = recorder.key(window, GLFW_KEY_P);
+        if (prepassKey && !prepassKeyDown) {
+            depthPrepass = !depthPrepass;
+            std::cout << "Depth prepass " << (depthPrepass ? "on" : "off") << std::endl;
+        }
+        prepassKeyDown = prepassKey;
+        bool upKey = recorder.key(window, GLFW_KEY_UP), downKey = recorder.key(window, GLFW_KEY_DOWN);
+        if (upKey && !upKeyDown && lightCount < MAX_LIGHTS) {
+            lightCount *= 2;
+            printLights = true;
+        }
+        if (downKey && !downKeyDown && lightCount > MIN_LIGHTS) {
+            lightCount /= 2;
+            printLights = true;
+        }
+        upKeyDown = upKey;
+        downKeyDown = downKey;
+        bool deferredKey = recorder.key(window, GLFW_KEY_G), layoutKey = recorder.key(window, GLFW_KEY_C);
+        bool rebuild = false;
+        if (deferredKey && !deferredKeyDown) {
+            deferred = !deferred;
+            rebuild = true;
+        }
+        if (layoutKey && !layoutKeyDown) {
+            gbufferLayout = GBuffer::Layout((gbufferLayout + 1) % GBuffer::LAYOUT_COUNT);
+            rebuild = deferred;
+        }
+        deferredKeyDown = deferredKey;
+        layoutKeyDown = layoutKey;
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        if (framebufferWidth > 0 && framebufferHeight > 0 &&
+            (rebuild || framebufferWidth != graphWidth || framebufferHeight != graphHeight))
+            buildGraph(framebufferWidth, framebufferHeight);
+        // move the camera at a fixed rate, however fast we happen to render
+        for (int steps = loop.advance(recorder.time()); steps > 0; --steps) {
+            previousCameraPos = camera[0];
+            moveCamera(window, recorder, camera);
+        }
+        simulationTime = (float)recorder.time();
+
+        glm::vec3 renderPos = glm::mix(previousCameraPos, camera[0], loop.alpha());
+        view = glm::lookAt(renderPos, renderPos+camera[1], camera[2]);
+        float aspect = float(std::max(graphWidth, 1)) / float(std::max(graphHeight, 1));
+        projection = glm::perspective(fovY, aspect, zNear, zFar);
+
+        // move the lights and bin them, both on the worker threads
+        activeLights.resize(lightCount);
+        ThreadPool::shared().parallelFor(activeLights.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) {
+                const Orbit &orbit = orbits[i];
+                float angle = orbit.phase + orbit.speed * simulationTime;
+                activeLights[i] = lights[i];
+                activeLights[i].position = glm::vec3(orbit.radius * cosf(angle), orbit.height, orbit.radius * sinf(angle));
+            }
+        }, 256);
+        clustered.update(activeLights, view, fovY, aspect, zNear, zFar);
+        clustered.upload();
+        if (printLights) {
+            clustered.print();
+            printLights = false;
+        }
+
+        litShader.use();
+        litShader.setInt("texture1", 0);
+        litShader.setInt("texture2", 1);
+        litShader.setMat4("view", view);
+        litShader.setMat4("projection", projection);
+        litShader.setVec3("ambient", glm::vec3(0.08f));
+        // units 0 and 1 are the material's textures, the light buffers go after them
+        clustered.bind(litShader, Material::MAX_TEXTURES, graphWidth, graphHeight);
+        depthShader.use();
+        depthShader.setMat4("view", view);
+        depthShader.setMat4("projection", projection);
+        gbufferShader.use();
+        gbufferShader.setInt("texture1", 0);
+        gbufferShader.setInt("texture2", 1);
+        gbufferShader.setMat4("view", view);
+        gbufferShader.setMat4("projection", projection);
+        graph.execute();
+
+        recorder.endFrame();
+        // per-frame scratch (FrameArena.h) of every thread goes back in one go
+        FrameArena::resetAll();
+        // GL objects released this frame wait for a fence, earlier ones the GPU is done with get recycled
+        GLObjectPool::shared().endFrame();
+        // GLAD_TRACE builds: print this frame's GL call histogram
+        gladTraceEndFrame();
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+        loop.endFrame();
+    }
+
+    // deallocate all resources
+    VAO.reset();
+    emptyVAO.reset();
+    graph.deleteObjects();
+    clustered.deleteObjects();
+    VBO.reset();
+    texture1.reset();
+    texture2.reset();
+    GLObjectPool::shared().shutdown();
+    glDeleteProgram(litShader.ID);
+    glDeleteProgram(depthShader.ID);
+    glDeleteProgram(gbufferShader.ID);
+    glDeleteProgram(deferredShader.ID);
+
+    gladTraceSummary();
+    reloader.stop();
+    // terminate GLFW
+    glfwTerminate();
+
+    return 0;
+}
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
+    /// Automatically resizes OpenGL render window with glfw window size
+    glViewport(0, 0, width, height);
+    printf("Window resized to (%i, %i)\n", width, height);
+}
+
+void processInput(GLFWwindow *window, const FrameRecorder &recorder) {
+    /// Takes the window as input together with a key
+    if (recorder.key(window, GLFW_KEY_ESCAPE))
+        glfwSetWindowShouldClose(window, true);
+    if (recorder.key(window, GLFW_KEY_L))
+        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    if (recorder.key(window, GLFW_KEY_F))
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+}
+
+void moveCamera(GLFWwindow *window, const FrameRecorder &recorder, glm::vec3 (&camera)[3]) {
+    const float cameraSpeed = 0.05f; // per update step (60 per second by default)
+    if (recorder.key(window, GLFW_KEY_W))
+        camera[0] += cameraSpeed * camera[1];
+    if (recorder.key(window, GLFW_KEY_S))
+        camera[0] -= cameraSpeed * camera[1];
+    if (recorder.key(window, GLFW_KEY_A))
+        camera[0] -= glm::normalize(glm::cross(camera[1], camera[2])) * cameraSpeed;
+    if (recorder.key(window, GLFW_KEY_D))
+        camera[0] += glm::normalize(glm::cross(camera[1], camera[2])) * cameraSpeed;
+}
\ No newline at end of file
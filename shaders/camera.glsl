@@ -0,0 +1,11 @@
+// model/view/projection shared by the vertex shaders that place geometry in the world (#include "camera.glsl")
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+// bit-identical positions in every program that uses this, so a depth prepass and GL_EQUAL shading agree
+invariant gl_Position;
+
+vec4 toClipSpace(vec3 position) {
+    return projection * view * model * vec4(position, 1.0);
+}
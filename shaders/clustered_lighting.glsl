@@ -0,0 +1,31 @@
+// lights of one cluster (ClusteredLights.h), for the forward and the deferred lighting shaders
+// (#include "clustered_lighting.glsl"); CLUSTERS has to match ClusteredLights::CLUSTERS_X/Y/Z
+const ivec3 CLUSTERS = ivec3(16, 9, 24);
+uniform samplerBuffer lights; // 2 texels per light: view space position + radius, color + intensity
+uniform usamplerBuffer clusters; // per cluster: first entry in lightIndices, count
+uniform usamplerBuffer lightIndices;
+uniform vec2 clusterTileSize; // pixels
+uniform vec2 clusterDepth; // slice = log(depth) * x + y
+uniform vec3 ambient;
+
+// diffuse light at a view space point, fragCoord picks the screen tile
+vec3 clusteredLighting(vec3 position, vec3 normal, vec2 fragCoord) {
+    ivec3 cell = ivec3(ivec2(fragCoord / clusterTileSize), int(log(-position.z) * clusterDepth.x + clusterDepth.y));
+    cell = clamp(cell, ivec3(0), CLUSTERS - 1);
+    int cluster = cell.x + CLUSTERS.x * (cell.y + CLUSTERS.y * cell.z);
+    uvec2 range = texelFetch(clusters, cluster).xy;
+
+    vec3 light = ambient;
+    for (uint i = 0u; i < range.y; ++i) {
+        int index = int(texelFetch(lightIndices, int(range.x + i)).x);
+        vec4 positionRadius = texelFetch(lights, 2 * index);
+        vec4 colorIntensity = texelFetch(lights, 2 * index + 1);
+        vec3 toLight = positionRadius.xyz - position;
+        float distance = length(toLight);
+        // smooth falloff that reaches 0 at the radius, so binning by the radius misses nothing
+        float falloff = clamp(1.0 - distance / positionRadius.w, 0.0, 1.0);
+        float diffuse = max(dot(normal, toLight / max(distance, 1e-4)), 0.0);
+        light += colorIntensity.rgb * colorIntensity.a * diffuse * falloff * falloff;
+    }
+    return light;
+}
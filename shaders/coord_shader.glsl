@@ -4,12 +4,18 @@ layout (location = 1) in vec2 aTexCoord;
 
 out vec2 TexCoord;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+#include "camera.glsl"
 
+// features (ShaderVariants): QUANTIZED (aPos is a VertexPacking position)
+#ifdef QUANTIZED
+#include "quantization.glsl"
+#endif
 
 void main() {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+#ifdef QUANTIZED
+    gl_Position = toClipSpace(dequantizePosition(aPos));
+#else
+    gl_Position = toClipSpace(aPos);
+#endif
     TexCoord = vec2(aTexCoord.x, aTexCoord.y);
 }
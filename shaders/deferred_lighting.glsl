@@ -0,0 +1,25 @@
+#version 330 core
+in vec2 TexCoord;
+
+out vec4 FragColor;
+
+// GBuffer.h
+uniform sampler2D gAlbedo;
+uniform sampler2D gNormal;
+uniform sampler2D gDepth;
+uniform mat4 inverseProjection;
+
+#include "octahedral.glsl"
+#include "clustered_lighting.glsl"
+
+void main() {
+    float depth = texture(gDepth, TexCoord).r;
+    if (depth == 1.0)
+        discard; // nothing drawn here, the clear color stays
+    // view space position from the depth buffer: NDC back through the projection
+    vec4 position = inverseProjection * vec4(vec3(TexCoord, depth) * 2.0 - 1.0, 1.0);
+    position /= position.w;
+    vec3 normal = octahedralDecode(texture(gNormal, TexCoord).rg);
+    vec4 albedo = texture(gAlbedo, TexCoord);
+    FragColor = vec4(albedo.rgb * clusteredLighting(position.xyz, normal, gl_FragCoord.xy), albedo.a);
+}
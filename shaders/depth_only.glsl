@@ -0,0 +1,4 @@
+#version 330 core
+// depth prepass: nothing to shade, the depth comes from the rasterizer
+void main() {
+}
@@ -1,7 +1,17 @@
 #version 330 core
 out vec4 FragColor;
+
+// features (ShaderVariants): COLOR_FROM_POSITION
+#ifdef COLOR_FROM_POSITION
+in vec3 vertexPosition;
+#else
 in vec3 ourColor;
+#endif
 
 void main() {
+#ifdef COLOR_FROM_POSITION
+    FragColor = vec4(vertexPosition, 1.0);
+#else
     FragColor = vec4(ourColor, 1.0);
-}
\ No newline at end of file
+#endif
+}
@@ -0,0 +1,17 @@
+#version 330 core
+in vec2 TexCoord;
+in vec3 ViewPosition;
+
+out vec4 FragColor;
+
+uniform sampler2D texture1;
+uniform sampler2D texture2;
+
+#include "clustered_lighting.glsl"
+
+void main() {
+    vec4 albedo = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.2);
+    // flat faces: the normal is the one of the triangle
+    vec3 normal = normalize(cross(dFdx(ViewPosition), dFdy(ViewPosition)));
+    FragColor = vec4(albedo.rgb * clusteredLighting(ViewPosition, normal, gl_FragCoord.xy), albedo.a);
+}
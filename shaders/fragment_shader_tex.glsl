@@ -7,6 +7,11 @@ out vec4 FragColor;
 uniform sampler2D texture1;
 uniform sampler2D texture2;
 
+// features (ShaderVariants): MIRROR_TEXTURE2
 void main() {
+#ifdef MIRROR_TEXTURE2
+    FragColor = mix(texture(texture1, TexCoord), texture(texture2, vec2(-TexCoord.x, TexCoord.y)), 0.2);
+#else
     FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.2);
+#endif
 }
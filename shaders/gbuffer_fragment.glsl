@@ -0,0 +1,18 @@
+#version 330 core
+in vec2 TexCoord;
+in vec3 ViewPosition;
+
+// GBuffer.h: no position, the lighting pass gets it back from the depth buffer
+layout (location = 0) out vec4 Albedo;
+layout (location = 1) out vec2 Normal;
+
+uniform sampler2D texture1;
+uniform sampler2D texture2;
+
+#include "octahedral.glsl"
+
+void main() {
+    Albedo = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.2);
+    // flat faces: the normal is the one of the triangle (view space)
+    Normal = octahedralEncode(normalize(cross(dFdx(ViewPosition), dFdy(ViewPosition))));
+}
@@ -8,6 +8,7 @@
 #include <GLFW/glfw3.h>
 
 #include "../Shader.h"
+#include "../ShaderVariants.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 void processInput(GLFWwindow *window);
@@ -60,10 +61,12 @@ int main(int argc, char** argv) {
         std::cout << "Failed to initialize GLAD" << std::endl;
     }
 
-    //Shader ourShader("../shaders/vertex_shader.glsl", "../shaders/fragment_shader_tex.glsl");
-    //Shader ex1Shader("../shaders/vertex_shader_ex1.glsl", "../shaders/fragment_shader_tex.glsl");
-    //Shader ex2Shader("../shaders/vertex_shader_ex2.glsl", "../shaders/fragment_shader_tex.glsl");
-    Shader ex3Shader("../shaders/vertex_shader_ex3.glsl", "../shaders/fragment_shader_ex3.glsl");
+    // one pair of files, the exercises are feature defines (listed at the top of the .glsl files)
+    ShaderVariants variants("../shaders/vertex_shader.glsl", "../shaders/fragment_shader.glsl");
+    //Shader &ourShader = variants.get({});
+    //Shader &ex1Shader = variants.get({"FLIP_Y"});
+    //Shader &ex2Shader = variants.get({"OFFSET_X"});
+    Shader &ex3Shader = variants.get({"OFFSET_X", "OFFSET_Y", "COLOR_FROM_POSITION"});
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     float vertices[] = {
@@ -138,6 +141,7 @@ int main(int argc, char** argv) {
     // deallocate all resources
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
+    variants.deletePrograms();
 
     // terminate GLFW
     glfwTerminate();
@@ -0,0 +1,15 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+
+out vec2 TexCoord;
+out vec3 ViewPosition; // lights are in view space too (ClusteredLights.h)
+
+#include "camera.glsl"
+
+void main() {
+    // through toClipSpace like coord_shader.glsl, so the depth prepass matches with GL_EQUAL
+    gl_Position = toClipSpace(aPos);
+    ViewPosition = vec3(view * model * vec4(aPos, 1.0));
+    TexCoord = aTexCoord;
+}
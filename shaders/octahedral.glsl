@@ -0,0 +1,20 @@
+// unit vectors as 2 numbers (octahedral mapping), for G-buffer normals (#include "octahedral.glsl")
+// encode gives [0, 1] so the result fits unorm (RG8) as well as float (RG16F) targets
+
+vec2 octahedralWrap(vec2 v) {
+    return (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec2 octahedralEncode(vec3 n) {
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    vec2 e = n.z >= 0.0 ? n.xy : octahedralWrap(n.xy);
+    return e * 0.5 + 0.5;
+}
+
+vec3 octahedralDecode(vec2 e) {
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
@@ -0,0 +1,20 @@
+#version 330 core
+in vec2 TexCoord;
+
+out vec4 FragColor;
+
+uniform sampler2D source;
+// one texel along the blur axis, (1/width, 0) or (0, 1/height)
+uniform vec2 direction;
+
+// 9 tap gaussian as 5 bilinear fetches
+void main() {
+    const float offsets[3] = float[](0.0, 1.3846153846, 3.2307692308);
+    const float weights[3] = float[](0.2270270270, 0.3162162162, 0.0702702703);
+    vec4 color = texture(source, TexCoord) * weights[0];
+    for (int i = 1; i < 3; ++i) {
+        color += texture(source, TexCoord + direction * offsets[i]) * weights[i];
+        color += texture(source, TexCoord - direction * offsets[i]) * weights[i];
+    }
+    FragColor = color;
+}
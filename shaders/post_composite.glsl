@@ -0,0 +1,14 @@
+#version 330 core
+in vec2 TexCoord;
+
+out vec4 FragColor;
+
+uniform sampler2D scene;
+
+// scene to the screen with a vignette
+void main() {
+    vec3 color = texture(scene, TexCoord).rgb;
+    vec2 fromCenter = TexCoord - 0.5;
+    color *= 1.0 - dot(fromCenter, fromCenter) * 0.8;
+    FragColor = vec4(color, 1.0);
+}
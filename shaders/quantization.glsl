@@ -0,0 +1,7 @@
+// positions packed by VertexPacking.h: 16 bit unorm inside the mesh bounds (PackedMesh::setUniforms)
+uniform vec3 boundsMin;
+uniform vec3 boundsExtent;
+
+vec3 dequantizePosition(vec3 position) {
+    return boundsMin + position * boundsExtent;
+}
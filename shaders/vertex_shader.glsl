@@ -2,9 +2,30 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
 
+// features (ShaderVariants): FLIP_Y, OFFSET_X, OFFSET_Y, COLOR_FROM_POSITION
+#if defined(OFFSET_X) || defined(OFFSET_Y)
+uniform float x_offset;
+#endif
+
+#ifdef COLOR_FROM_POSITION
+out vec3 vertexPosition;
+#endif
 out vec3 ourColor;
 
 void main() {
-    gl_Position = vec4(aPos, 1.0);
+    vec3 position = aPos;
+#ifdef FLIP_Y
+    position.y = -position.y;
+#endif
+#ifdef OFFSET_X
+    position.x += x_offset;
+#endif
+#ifdef OFFSET_Y
+    position.y += x_offset;
+#endif
+    gl_Position = vec4(position, 1.0);
+#ifdef COLOR_FROM_POSITION
+    vertexPosition = gl_Position.xyz;
+#endif
     ourColor = aColor;
-}
\ No newline at end of file
+}
@@ -1,14 +0,0 @@
-#version 330 core
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aColor;
-
-uniform float x_offset;
-
-out vec3 vertexPosition;
-out vec3 ourColor;
-
-void main() {
-    gl_Position = vec4(aPos.x+x_offset, x_offset+aPos.y, aPos.z, 1.0);
-    vertexPosition = gl_Position.xyz;
-    ourColor = aColor;
-}
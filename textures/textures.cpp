@@ -9,6 +9,7 @@
 #include <GLFW/glfw3.h>
 
 #include "../Shader.h"
+#include "../VertexLayout.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
@@ -66,7 +67,7 @@ int main(int argc, char** argv) {
     // tutorial & ex2
     Shader ourShader("../shaders/texture_shader.glsl", "../shaders/fragment_shader_tex.glsl");
     // ex1
-    //Shader ourShader("../textures/texture_shader.glsl", "../textures/fragment_shader_tex_ex1.glsl");
+    //Shader ourShader("../shaders/texture_shader.glsl", "../shaders/fragment_shader_tex.glsl", {"MIRROR_TEXTURE2"});
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     float vertices[] = {
@@ -80,24 +81,20 @@ int main(int argc, char** argv) {
             0,2,3,
             3,1,0
     };
-    unsigned int VAO, VBO, EBO; // Vertex Array Object (which will hold a VBO+EBO)
-    glGenVertexArrays(1, &VAO);
+    unsigned int VBO, EBO;
     glGenBuffers(1, &VBO);
     glGenBuffers(1, &EBO);
-    glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind buffer ID to unique buffer type (this is for vertices)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // copy vertex data into buffer
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO); // bind buffer ID to unique buffer type (this is for indices)
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW); // copy index data into buffer
-    // vertex position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // shader color attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void*)(3*sizeof(float)));
-    glEnableVertexAttribArray(1);
-    // texture1 attribute
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void*)(6*sizeof(float)));
-    glEnableVertexAttribArray(2);
+    // vertex position, shader color and texture1 attributes, locations come from the shader
+    VertexLayout layout;
+    layout.attribute("aPos", 3).attribute("aColor", 3).attribute("aTexCoord", 2);
+    if (!layout.validate(ourShader.reflection()))
+        std::cout << "Vertex layout doesn't match the shader" << std::endl;
+    // Vertex Array Object (which will hold a VBO+EBO), from the GLObjectPool
+    GLVertexArray VAO = layout.createVertexArray(VBO, EBO);
 
     // TEXTURE
     // Create texture1
@@ -146,9 +143,6 @@ int main(int argc, char** argv) {
     }
     stbi_image_free(data); // free image data from memory
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
     glViewport(0,0,800,600);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
@@ -175,7 +169,7 @@ int main(int argc, char** argv) {
         glBindTexture(GL_TEXTURE_2D, texture2);
 
         /*! bind the buffer and draw the shape you want... */
-        glBindVertexArray(VAO);
+        glBindVertexArray(VAO.id());
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
 
         // will swap the color buffer: a large 2D buffer that contains color values for each pixel in GLFW window
@@ -185,9 +179,13 @@ int main(int argc, char** argv) {
     }
 
     // deallocate all resources
-    glDeleteVertexArrays(1, &VAO);
+    VAO.reset();
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    glDeleteTextures(1, &texture1);
+    glDeleteTextures(1, &texture2);
+    GLObjectPool::shared().shutdown();
+    glDeleteProgram(ourShader.ID);
 
     // terminate GLFW
     glfwTerminate();
@@ -9,6 +9,7 @@
 #include <GLFW/glfw3.h>
 
 #include "../Shader.h"
+#include "../ShaderVariants.h"
 #include "../stb_image.h"
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
@@ -47,7 +48,8 @@ int main(int argc, char** argv) {
 
     // SHADER
     // ex1
-    Shader ourShader("../shaders/texture_shader.glsl", "../shaders/fragment_shader_tex_ex1.glsl");
+    ShaderVariants variants("../shaders/texture_shader.glsl", "../shaders/fragment_shader_tex.glsl");
+    Shader &ourShader = variants.get({"MIRROR_TEXTURE2"});
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     float vertices[] = {
@@ -161,6 +163,9 @@ int main(int argc, char** argv) {
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    glDeleteTextures(1, &texture1);
+    glDeleteTextures(1, &texture2);
+    variants.deletePrograms();
 
     // terminate GLFW
     glfwTerminate();
@@ -0,0 +1,60 @@
+//
+// Created by lukasz on 2026-10-19.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <glad.h>
+
+#include "../MeshImporter.h"
+#include "../MeshFile.h"
+#include "../MeshSimplifier.h"
+#include "../MeshletBuilder.h"
+
+/*
+ * mesh_convert <input.obj|input.ply> <output.mesh> [--float] [--weld <epsilon>] [--lods <levels>]
+ * Offline half of MeshFile: parse a text mesh once, write the binary file the demos mmap.
+ * Vertices are quantized (VertexPacking.h) unless --float is given. Exact duplicate vertices are always welded,
+ * --weld also merges the ones closer than epsilon.
+ * The index buffer gets a LOD chain (MeshSimplifier.h), up to 4 levels of half the triangles each; --lods 1 turns it off.
+ * The full level is also split into meshlets (MeshletBuilder.h) for per cluster culling.
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cout << "usage: mesh_convert <input.obj|input.ply> <output.mesh> [--float] [--weld <epsilon>]"
+                     " [--lods <levels>]" << std::endl;
+        return 1;
+    }
+    bool quantize = true;
+    float weldEpsilon = 0.0f;
+    int lodLevels = 4;
+    for (int i = 3; i < argc; ++i) {
+        if (std::string(argv[i]) == "--float")
+            quantize = false;
+        else if (std::string(argv[i]) == "--weld" && i + 1 < argc)
+            weldEpsilon = std::strtof(argv[++i], nullptr);
+        else if (std::string(argv[i]) == "--lods" && i + 1 < argc)
+            lodLevels = std::max(1, std::atoi(argv[++i]));
+    }
+
+    Mesh mesh;
+    if (!MeshImporter::load(argv[1], mesh, weldEpsilon))
+        return 1;
+    std::cout << argv[1] << ": " << mesh.vertexCount() << " vertices, " << mesh.triangleCount() << " triangles"
+              << std::endl;
+
+    LodChain lods = MeshSimplifier::lodChain(mesh, lodLevels);
+    for (size_t i = 0; i < lods.levels.size(); ++i)
+        std::cout << "  LOD " << i << ": " << lods.levels[i].indexCount / 3 << " triangles, error "
+                  << lods.levels[i].error << std::endl;
+    if (lods.levels.size() == 1)
+        std::cout << "  no coarser levels: nothing left to collapse off the seams and borders" << std::endl;
+    MeshletData meshlets = MeshletBuilder::build(mesh, std::vector<uint32_t>(lods.indices.begin(),
+                                                                             lods.indices.begin() + lods.levels[0].indexCount));
+    std::cout << "  " << meshlets.meshlets.size() << " meshlets" << std::endl;
+    if (!MeshFile::write(argv[2], mesh, quantize, &meshlets, &lods))
+        return 1;
+    return 0;
+}
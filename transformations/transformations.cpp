@@ -171,6 +171,9 @@ int main(int argc, char** argv) {
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    glDeleteTextures(1, &texture1);
+    glDeleteTextures(1, &texture2);
+    glDeleteProgram(ourShader.ID);
 
     // terminate GLFW
     glfwTerminate();
@@ -97,6 +97,7 @@ int main(int argc, char** argv) {
     // delete shader objects once they're linked. They're no longer needed
     glDeleteShader(vertexShader);
     glDeleteShader(orangeFragmentShader);
+    glDeleteShader(yellowFragmentShader);
 
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
@@ -163,6 +164,7 @@ int main(int argc, char** argv) {
     glDeleteVertexArrays(2, VAOs);
     glDeleteBuffers(2, VBOs);
     glDeleteProgram(orangeShaderProgram);
+    glDeleteProgram(yellowShaderProgram);
 
     // terminate GLFW
     glfwTerminate();